@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCPBenchmarkPipeline.h"
+
+#include "vtkCPDataDescription.h"
+#include "vtkCPInputDataDescription.h"
+#include "vtkContourFilter.h"
+#include "vtkDataObject.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPlane.h"
+#include "vtkPlaneCutter.h"
+#include "vtkResampleToImage.h"
+#include "vtkSmartPointer.h"
+#include "vtkTableBasedClipDataSet.h"
+
+vtkStandardNewMacro(vtkCPBenchmarkPipeline);
+
+//----------------------------------------------------------------------------
+vtkCPBenchmarkPipeline::vtkCPBenchmarkPipeline()
+{
+  this->PipelineType = SLICE;
+  this->InputName = nullptr;
+  this->SetInputName("input");
+  this->ArrayName = nullptr;
+  this->Value = 0;
+  this->Origin[0] = this->Origin[1] = this->Origin[2] = 0;
+  this->Normal[0] = 1;
+  this->Normal[1] = this->Normal[2] = 0;
+  this->ImageDimensions[0] = this->ImageDimensions[1] = this->ImageDimensions[2] = 128;
+  this->OutputFrequency = 1;
+  this->LastExtractNumberOfCells = 0;
+  this->LastExtractSize = 0;
+}
+
+//----------------------------------------------------------------------------
+vtkCPBenchmarkPipeline::~vtkCPBenchmarkPipeline()
+{
+  this->SetInputName(nullptr);
+  this->SetArrayName(nullptr);
+}
+
+//----------------------------------------------------------------------------
+int vtkCPBenchmarkPipeline::RequestDataDescription(vtkCPDataDescription* dataDescription)
+{
+  if (!dataDescription)
+  {
+    vtkWarningMacro("dataDescription is NULL.");
+    return 0;
+  }
+
+  this->LastExtractNumberOfCells = 0;
+  this->LastExtractSize = 0;
+
+  vtkCPInputDataDescription* idd = this->InputName
+    ? dataDescription->GetInputDescriptionByName(this->InputName)
+    : nullptr;
+  if (idd == nullptr)
+  {
+    return 0;
+  }
+
+  if (dataDescription->GetForceOutput() == true ||
+    dataDescription->GetTimeStep() % this->OutputFrequency == 0)
+  {
+    if (this->PipelineType == CONTOUR && this->ArrayName)
+    {
+      idd->AddField(this->ArrayName, vtkDataObject::POINT);
+    }
+    else
+    {
+      idd->AllFieldsOn();
+    }
+    idd->GenerateMeshOn();
+    return 1;
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkCPBenchmarkPipeline::CoProcess(vtkCPDataDescription* dataDescription)
+{
+  if (!dataDescription)
+  {
+    vtkWarningMacro("DataDescription is NULL");
+    return 0;
+  }
+
+  if (this->RequestDataDescription(dataDescription) == 0)
+  {
+    return 1;
+  }
+
+  vtkDataObject* grid = dataDescription->GetInputDescriptionByName(this->InputName)->GetGrid();
+  if (grid == nullptr)
+  {
+    vtkErrorMacro("Could not process " << this->InputName);
+    return 0;
+  }
+
+  vtkNew<vtkPlane> plane;
+  plane->SetOrigin(this->Origin);
+  plane->SetNormal(this->Normal);
+
+  vtkSmartPointer<vtkAlgorithm> filter;
+  switch (this->PipelineType)
+  {
+    case SLICE:
+    {
+      vtkNew<vtkPlaneCutter> cutter;
+      cutter->SetPlane(plane);
+      filter = cutter;
+      break;
+    }
+    case CONTOUR:
+    {
+      if (this->ArrayName == nullptr)
+      {
+        vtkErrorMacro("Must set ArrayName.");
+        return 0;
+      }
+      vtkNew<vtkContourFilter> contour;
+      contour->SetInputArrayToProcess(
+        0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, this->ArrayName);
+      contour->SetValue(0, this->Value);
+      filter = contour;
+      break;
+    }
+    case CLIP:
+    {
+      vtkNew<vtkTableBasedClipDataSet> clip;
+      clip->SetClipFunction(plane);
+      filter = clip;
+      break;
+    }
+    case IMAGE_EXTRACT:
+    default:
+    {
+      vtkNew<vtkResampleToImage> resample;
+      resample->SetSamplingDimensions(this->ImageDimensions);
+      resample->UseInputBoundsOn();
+      filter = resample;
+      break;
+    }
+  }
+
+  filter->SetInputDataObject(grid);
+  filter->Update();
+
+  vtkDataObject* output = filter->GetOutputDataObject(0);
+  this->LastExtractNumberOfCells = output->GetNumberOfElements(vtkDataObject::CELL);
+  // GetActualMemorySize() is in kibibytes.
+  this->LastExtractSize = static_cast<vtkTypeInt64>(output->GetActualMemorySize()) * 1024;
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkCPBenchmarkPipeline::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "PipelineType: " << this->PipelineType << "\n";
+  os << indent << "InputName: " << (this->InputName ? this->InputName : "(none)") << "\n";
+  os << indent << "ArrayName: " << (this->ArrayName ? this->ArrayName : "(none)") << "\n";
+  os << indent << "Value: " << this->Value << "\n";
+  os << indent << "Origin: " << this->Origin[0] << " " << this->Origin[1] << " " << this->Origin[2]
+     << "\n";
+  os << indent << "Normal: " << this->Normal[0] << " " << this->Normal[1] << " " << this->Normal[2]
+     << "\n";
+  os << indent << "ImageDimensions: " << this->ImageDimensions[0] << " "
+     << this->ImageDimensions[1] << " " << this->ImageDimensions[2] << "\n";
+  os << indent << "OutputFrequency: " << this->OutputFrequency << "\n";
+  os << indent << "LastExtractNumberOfCells: " << this->LastExtractNumberOfCells << "\n";
+  os << indent << "LastExtractSize: " << this->LastExtractSize << "\n";
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCPBenchmarkPipeline
+ * @brief   Class for creating typical in situ pipelines.
+ *
+ * Class for creating a co-processing pipeline representative of the in situ
+ * analyses run by simulations, to benchmark Catalyst with vtkCPTestDriver.
+ * PipelineType selects the analysis applied to the input:
+ *
+ * - SLICE cuts the input with the plane defined by Origin and Normal,
+ * - CONTOUR computes the iso-surface of the point array ArrayName at Value,
+ * - CLIP clips the input with the plane defined by Origin and Normal,
+ * - IMAGE_EXTRACT resamples the input on an image of ImageDimensions points.
+ *
+ * The output is not written; its number of cells and its size are recorded
+ * as the extract volume of the last execution.
+ */
+
+#ifndef vtkCPBenchmarkPipeline_h
+#define vtkCPBenchmarkPipeline_h
+
+#include "vtkCPPipeline.h"
+#include "vtkPVCatalystTestDriverModule.h" // needed for export macros
+
+class VTKPVCATALYSTTESTDRIVER_EXPORT vtkCPBenchmarkPipeline : public vtkCPPipeline
+{
+public:
+  static vtkCPBenchmarkPipeline* New();
+  vtkTypeMacro(vtkCPBenchmarkPipeline, vtkCPPipeline);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  int RequestDataDescription(vtkCPDataDescription* dataDescription) override;
+
+  int CoProcess(vtkCPDataDescription* dataDescription) override;
+
+  enum PipelineTypes
+  {
+    SLICE = 0,
+    CONTOUR = 1,
+    CLIP = 2,
+    IMAGE_EXTRACT = 3
+  };
+
+  ///@{
+  /**
+   * Set/get the analysis performed by the pipeline. Default is SLICE.
+   */
+  vtkSetClampMacro(PipelineType, int, SLICE, IMAGE_EXTRACT);
+  vtkGetMacro(PipelineType, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the name of the input the pipeline operates on. Default is
+   * "input", the name used by vtkCPTestDriver.
+   */
+  vtkSetStringMacro(InputName);
+  vtkGetStringMacro(InputName);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the name of the point array to contour.
+   */
+  vtkSetStringMacro(ArrayName);
+  vtkGetStringMacro(ArrayName);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the iso-value used by CONTOUR. Default is 0.
+   */
+  vtkSetMacro(Value, double);
+  vtkGetMacro(Value, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the plane used by SLICE and CLIP. Default is the plane through
+   * (0, 0, 0) with normal (1, 0, 0).
+   */
+  vtkSetVector3Macro(Origin, double);
+  vtkGetVector3Macro(Origin, double);
+  vtkSetVector3Macro(Normal, double);
+  vtkGetVector3Macro(Normal, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the dimensions of the image computed by IMAGE_EXTRACT. Default is
+   * 128 x 128 x 128.
+   */
+  vtkSetVector3Macro(ImageDimensions, int);
+  vtkGetVector3Macro(ImageDimensions, int);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get how often, in time steps, the pipeline executes. Default is 1.
+   */
+  vtkSetClampMacro(OutputFrequency, int, 1, VTK_INT_MAX);
+  vtkGetMacro(OutputFrequency, int);
+  ///@}
+
+  ///@{
+  /**
+   * Get the number of cells and the size in bytes of the output of the last
+   * execution on this process, or 0 if the pipeline did not execute at the
+   * last time step.
+   */
+  vtkGetMacro(LastExtractNumberOfCells, vtkIdType);
+  vtkGetMacro(LastExtractSize, vtkTypeInt64);
+  ///@}
+
+protected:
+  vtkCPBenchmarkPipeline();
+  ~vtkCPBenchmarkPipeline() override;
+
+private:
+  vtkCPBenchmarkPipeline(const vtkCPBenchmarkPipeline&) = delete;
+  void operator=(const vtkCPBenchmarkPipeline&) = delete;
+
+  int PipelineType;
+  char* InputName;
+  char* ArrayName;
+  double Value;
+  double Origin[3];
+  double Normal[3];
+  int ImageDimensions[3];
+  int OutputFrequency;
+  vtkIdType LastExtractNumberOfCells;
+  vtkTypeInt64 LastExtractSize;
+};
+
+#endif
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCPSinusoidalScalarFieldFunction.h"
+
+#include "vtkObjectFactory.h"
+
+#include <cmath>
+
+vtkStandardNewMacro(vtkCPSinusoidalScalarFieldFunction);
+
+//----------------------------------------------------------------------------
+vtkCPSinusoidalScalarFieldFunction::vtkCPSinusoidalScalarFieldFunction()
+{
+  this->Offset = 0;
+  this->Amplitude = 1;
+  this->WaveNumber[0] = this->WaveNumber[1] = this->WaveNumber[2] = 1;
+  this->AngularFrequency = 1;
+}
+
+//----------------------------------------------------------------------------
+vtkCPSinusoidalScalarFieldFunction::~vtkCPSinusoidalScalarFieldFunction() = default;
+
+//----------------------------------------------------------------------------
+double vtkCPSinusoidalScalarFieldFunction::ComputeComponenentAtPoint(
+  unsigned int component, double point[3], unsigned long vtkNotUsed(timeStep), double time)
+{
+  if (component != 0)
+  {
+    vtkWarningMacro("Bad component value");
+  }
+  const double phase = point[0] * this->WaveNumber[0] + point[1] * this->WaveNumber[1] +
+    point[2] * this->WaveNumber[2] - time * this->AngularFrequency;
+  return this->Offset + this->Amplitude * std::sin(phase);
+}
+
+//----------------------------------------------------------------------------
+void vtkCPSinusoidalScalarFieldFunction::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Offset: " << this->Offset << endl;
+  os << indent << "Amplitude: " << this->Amplitude << endl;
+  os << indent << "WaveNumber: " << this->WaveNumber[0] << " " << this->WaveNumber[1] << " "
+     << this->WaveNumber[2] << endl;
+  os << indent << "AngularFrequency: " << this->AngularFrequency << endl;
+}
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkCPSinusoidalScalarFieldFunction
+ * @brief   Class for specifying scalars at points.
+ *
+ * Class for specifying a scalar field that is a plane wave travelling through
+ * the domain:
+ *
+ *   Offset + Amplitude * sin(WaveNumber . point - AngularFrequency * time)
+ *
+ * Unlike linear fields, its iso-surfaces and clips change shape and size
+ * over time, which makes it suited to benchmark in situ pipelines.
+ */
+
+#ifndef vtkCPSinusoidalScalarFieldFunction_h
+#define vtkCPSinusoidalScalarFieldFunction_h
+
+#include "vtkCPScalarFieldFunction.h"
+#include "vtkPVCatalystTestDriverModule.h" // needed for export macros
+
+class VTKPVCATALYSTTESTDRIVER_EXPORT vtkCPSinusoidalScalarFieldFunction
+  : public vtkCPScalarFieldFunction
+{
+public:
+  static vtkCPSinusoidalScalarFieldFunction* New();
+  vtkTypeMacro(vtkCPSinusoidalScalarFieldFunction, vtkCPScalarFieldFunction);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Compute the field value at Point.
+   */
+  double ComputeComponenentAtPoint(
+    unsigned int component, double point[3], unsigned long timeStep, double time) override;
+
+  ///@{
+  /**
+   * Set/get the value around which the field oscillates. Default is 0.
+   */
+  vtkSetMacro(Offset, double);
+  vtkGetMacro(Offset, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the amplitude of the wave. Default is 1.
+   */
+  vtkSetMacro(Amplitude, double);
+  vtkGetMacro(Amplitude, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the wave vector. Default is (1, 1, 1).
+   */
+  vtkSetVector3Macro(WaveNumber, double);
+  vtkGetVector3Macro(WaveNumber, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the angular frequency of the wave. Default is 1.
+   */
+  vtkSetMacro(AngularFrequency, double);
+  vtkGetMacro(AngularFrequency, double);
+  ///@}
+
+protected:
+  vtkCPSinusoidalScalarFieldFunction();
+  ~vtkCPSinusoidalScalarFieldFunction() override;
+
+private:
+  vtkCPSinusoidalScalarFieldFunction(const vtkCPSinusoidalScalarFieldFunction&) = delete;
+  void operator=(const vtkCPSinusoidalScalarFieldFunction&) = delete;
+
+  double Offset;
+  double Amplitude;
+  double WaveNumber[3];
+  double AngularFrequency;
+};
+
+#endif
@@ -3,12 +3,165 @@
 #include "vtkCPTestDriver.h"
 
 #include "vtkCPBaseGridBuilder.h"
+#include "vtkCPBenchmarkPipeline.h"
 #include "vtkCPDataDescription.h"
 #include "vtkCPInputDataDescription.h"
+#include "vtkCPPipeline.h"
 #include "vtkCPProcessor.h"
+#include "vtkCommunicator.h"
+#include "vtkDataObject.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
+#include "vtk_nlohmannjson.h"
+// clang-format off
+#include VTK_NLOHMANN_JSON(json.hpp) // for json
+// clang-format on
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemInformation.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+using vtkNJson = nlohmann::json;
+
+namespace
+{
+// Peak resident memory of the process since it started, in bytes.
+vtkTypeInt64 GetPeakResidentMemory(vtksys::SystemInformation& systemInformation)
+{
+#if !defined(_WIN32)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) == 0)
+  {
+#if defined(__APPLE__)
+    return static_cast<vtkTypeInt64>(usage.ru_maxrss);
+#else
+    // given in KiB.
+    return static_cast<vtkTypeInt64>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+  // no peak available: the current resident memory, given in KiB.
+  return static_cast<vtkTypeInt64>(systemInformation.GetProcMemoryUsed()) * 1024;
+}
+}
+
+class vtkCPTestDriver::vtkInternals
+{
+public:
+  std::vector<vtkSmartPointer<vtkCPPipeline>> Pipelines;
+
+  // benchmark report, filled on process 0.
+  vtkNJson Cycles = vtkNJson::array();
+  vtksys::SystemInformation SystemInformation;
+  vtkTypeInt64 MemoryHighWaterMark = 0;
+
+  void RecordCycle(unsigned long timeStep, double time, double gridTime, double catalystTime,
+    vtkTypeInt64 numberOfCells)
+  {
+    this->MemoryHighWaterMark =
+      std::max(this->MemoryHighWaterMark, ::GetPeakResidentMemory(this->SystemInformation));
+
+    vtkTypeInt64 extractNumberOfCells = 0;
+    vtkTypeInt64 extractSize = 0;
+    for (const auto& pipeline : this->Pipelines)
+    {
+      if (auto benchmarkPipeline = vtkCPBenchmarkPipeline::SafeDownCast(pipeline))
+      {
+        extractNumberOfCells += benchmarkPipeline->GetLastExtractNumberOfCells();
+        extractSize += benchmarkPipeline->GetLastExtractSize();
+      }
+    }
+
+    // the slowest process sets the pace of the simulation; volumes add up.
+    double times[3] = { gridTime, catalystTime,
+      static_cast<double>(this->MemoryHighWaterMark) };
+    double maxTimes[3] = { gridTime, catalystTime, times[2] };
+    vtkTypeInt64 volumes[3] = { numberOfCells, extractNumberOfCells, extractSize };
+    vtkTypeInt64 sumVolumes[3] = { numberOfCells, extractNumberOfCells, extractSize };
+    vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+    if (controller && controller->GetNumberOfProcesses() > 1)
+    {
+      controller->Reduce(times, maxTimes, 3, vtkCommunicator::MAX_OP, 0);
+      controller->Reduce(volumes, sumVolumes, 3, vtkCommunicator::SUM_OP, 0);
+      if (controller->GetLocalProcessId() != 0)
+      {
+        return;
+      }
+    }
+
+    vtkNJson cycle;
+    cycle["time_step"] = timeStep;
+    cycle["time"] = time;
+    cycle["grid_time"] = maxTimes[0];
+    cycle["catalyst_time"] = maxTimes[1];
+    cycle["memory_high_water_mark"] = static_cast<vtkTypeInt64>(maxTimes[2]);
+    cycle["number_of_cells"] = sumVolumes[0];
+    cycle["extract_number_of_cells"] = sumVolumes[1];
+    cycle["extract_size"] = sumVolumes[2];
+    this->Cycles.push_back(cycle);
+  }
+
+  bool WriteReport(const char* fileName)
+  {
+    vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+    const int numberOfProcesses = controller ? controller->GetNumberOfProcesses() : 1;
+    if (controller && controller->GetLocalProcessId() != 0)
+    {
+      return true;
+    }
+
+    double totalCatalystTime = 0;
+    vtkTypeInt64 memoryHighWaterMark = 0;
+    for (const auto& cycle : this->Cycles)
+    {
+      totalCatalystTime += cycle["catalyst_time"].get<double>();
+      memoryHighWaterMark =
+        std::max(memoryHighWaterMark, cycle["memory_high_water_mark"].get<vtkTypeInt64>());
+    }
+
+    vtkNJson pipelines = vtkNJson::array();
+    for (const auto& pipeline : this->Pipelines)
+    {
+      vtkNJson description;
+      description["class"] = pipeline->GetClassName();
+      if (auto benchmarkPipeline = vtkCPBenchmarkPipeline::SafeDownCast(pipeline))
+      {
+        static const char* types[] = { "slice", "contour", "clip", "image_extract" };
+        description["type"] = types[benchmarkPipeline->GetPipelineType()];
+        description["output_frequency"] = benchmarkPipeline->GetOutputFrequency();
+      }
+      pipelines.push_back(description);
+    }
+
+    vtkNJson report;
+    report["number_of_processes"] = numberOfProcesses;
+    report["number_of_time_steps"] = this->Cycles.size();
+    report["pipelines"] = pipelines;
+    report["total_catalyst_time"] = totalCatalystTime;
+    report["average_catalyst_time"] =
+      this->Cycles.empty() ? 0.0 : totalCatalystTime / this->Cycles.size();
+    report["memory_high_water_mark"] = memoryHighWaterMark;
+    report["cycles"] = this->Cycles;
+
+    vtksys::ofstream output(fileName);
+    if (!output)
+    {
+      return false;
+    }
+    output << report.dump(2) << endl;
+    return static_cast<bool>(output);
+  }
+};
+
 vtkStandardNewMacro(vtkCPTestDriver);
 vtkCxxSetObjectMacro(vtkCPTestDriver, GridBuilder, vtkCPBaseGridBuilder);
 
@@ -20,13 +173,38 @@ vtkCPTestDriver::vtkCPTestDriver()
   this->GridBuilder = nullptr;
   this->StartTime = 0;
   this->EndTime = 1;
+  this->BenchmarkFileName = nullptr;
+  this->Internals = new vtkInternals();
 }
 
 //----------------------------------------------------------------------------
 vtkCPTestDriver::~vtkCPTestDriver()
 {
   this->SetGridBuilder(nullptr);
+  this->SetBenchmarkFileName(nullptr);
+  delete this->Internals;
+}
+
+//----------------------------------------------------------------------------
+void vtkCPTestDriver::AddPipeline(vtkCPPipeline* pipeline)
+{
+  if (pipeline)
+  {
+    this->Internals->Pipelines.emplace_back(pipeline);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkCPTestDriver::RemoveAllPipelines()
+{
+  if (!this->Internals->Pipelines.empty())
+  {
+    this->Internals->Pipelines.clear();
+    this->Modified();
+  }
 }
+
 //----------------------------------------------------------------------------
 int vtkCPTestDriver::Run()
 {
@@ -38,10 +216,22 @@ int vtkCPTestDriver::Run()
 
   // create the coprocessor
   vtkSmartPointer<vtkCPProcessor> processor = vtkSmartPointer<vtkCPProcessor>::New();
-  // here we should add in a pipeline for the processor to use
+  for (const auto& pipeline : this->Internals->Pipelines)
+  {
+    processor->AddPipeline(pipeline);
+  }
+
+  using clock = std::chrono::steady_clock;
+  const bool benchmark = this->BenchmarkFileName != nullptr;
+  this->Internals->Cycles = vtkNJson::array();
+  this->Internals->MemoryHighWaterMark = 0;
 
   for (unsigned long i = 0; i < this->NumberOfTimeSteps; i++)
   {
+    const auto cycleStart = clock::now();
+    double gridTime = 0;
+    vtkTypeInt64 numberOfCells = 0;
+
     vtkSmartPointer<vtkCPDataDescription> dataDescription =
       vtkSmartPointer<vtkCPDataDescription>::New();
     dataDescription->SetTimeData(this->GetTime(i), i);
@@ -49,11 +239,29 @@ int vtkCPTestDriver::Run()
     if (processor->RequestDataDescription(dataDescription))
     {
       int builtNewGrid = 0;
-      dataDescription->GetInputDescriptionByName("input")->SetGrid(
-        this->GridBuilder->GetGrid(i, this->GetTime(i), builtNewGrid));
+      const auto gridStart = clock::now();
+      vtkDataObject* grid = this->GridBuilder->GetGrid(i, this->GetTime(i), builtNewGrid);
+      gridTime = std::chrono::duration<double>(clock::now() - gridStart).count();
+      numberOfCells = grid ? grid->GetNumberOfElements(vtkDataObject::CELL) : 0;
+      dataDescription->GetInputDescriptionByName("input")->SetGrid(grid);
       // now call the coprocessing library
       processor->CoProcess(dataDescription);
     }
+
+    if (benchmark)
+    {
+      const double cycleTime = std::chrono::duration<double>(clock::now() - cycleStart).count();
+      this->Internals->RecordCycle(
+        i, this->GetTime(i), gridTime, cycleTime - gridTime, numberOfCells);
+    }
+  }
+  // finalizes the pipelines, once.
+  processor->Finalize();
+
+  if (benchmark && !this->Internals->WriteReport(this->BenchmarkFileName))
+  {
+    vtkErrorMacro("Failed to write benchmark report to " << this->BenchmarkFileName);
+    return 1;
   }
   return 0;
 }
@@ -83,4 +291,8 @@ void vtkCPTestDriver::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "GridBuilder: " << this->GridBuilder << endl;
   os << indent << "StartTime: " << this->StartTime << endl;
   os << indent << "EndTime: " << this->EndTime << endl;
+  os << indent << "NumberOfPipelines: " << this->Internals->Pipelines.size() << endl;
+  os << indent
+     << "BenchmarkFileName: " << (this->BenchmarkFileName ? this->BenchmarkFileName : "(none)")
+     << endl;
 }
@@ -7,6 +7,11 @@
  * Class for creating a co-processor test driver.  It is intended
  * as a framework for creating custom inputs replicating a simulation for
  * the co-processing library.
+ *
+ * The test driver doubles as an in situ benchmark: combine a grid builder
+ * (e.g. vtkCPUniformGridBuilder in WEAK_SCALING mode) with
+ * vtkCPBenchmarkPipeline instances and set BenchmarkFileName to get a JSON
+ * report of the cost of every time step.
  */
 
 #ifndef vtkCPTestDriver_h
@@ -16,6 +21,7 @@
 #include "vtkPVCatalystTestDriverModule.h" // needed for export macros
 
 class vtkCPBaseGridBuilder;
+class vtkCPPipeline;
 
 class VTKPVCATALYSTTESTDRIVER_EXPORT vtkCPTestDriver : public vtkObject
 {
@@ -62,6 +68,29 @@ public:
   vtkGetMacro(EndTime, double);
   ///@}
 
+  ///@{
+  /**
+   * Add/remove the co-processing pipelines executed by Run().
+   */
+  void AddPipeline(vtkCPPipeline* pipeline);
+  void RemoveAllPipelines();
+  ///@}
+
+  ///@{
+  /**
+   * Set/get the name of the JSON file where Run() writes its benchmark
+   * report. When not set (the default), no measurement is made. For each
+   * time step, the report gives the time spent building the grid and in
+   * Catalyst (maximum over processes), the peak resident memory of the
+   * processes so far (maximum over processes),
+   * and the number of cells of the grid and of the extracts computed by
+   * vtkCPBenchmarkPipeline instances (sum over processes). Only process 0
+   * writes the file.
+   */
+  vtkSetStringMacro(BenchmarkFileName);
+  vtkGetStringMacro(BenchmarkFileName);
+  ///@}
+
 protected:
   vtkCPTestDriver();
   ~vtkCPTestDriver() override;
@@ -87,6 +116,15 @@ private:
    */
   double StartTime;
   double EndTime;
+  ///@}
+
+  /**
+   * The name of the file the benchmark report is written to.
+   */
+  char* BenchmarkFileName;
+
+  class vtkInternals;
+  vtkInternals* Internals;
 };
 //@}
 
@@ -7,12 +7,54 @@
 #include "vtkObjectFactory.h"
 #include "vtkUniformGrid.h"
 
+#include <vector>
+
+namespace
+{
+//----------------------------------------------------------------------------
+// Arranges numberOfProcesses blocks in a grid so that the blocks of a domain
+// of `cells` cells are as close to cubes as possible.
+void ComputeProcessGrid(int numberOfProcesses, const int cells[3], int grid[3])
+{
+  std::vector<int> factors;
+  for (int factor = 2; numberOfProcesses > 1;)
+  {
+    if (numberOfProcesses % factor == 0)
+    {
+      factors.push_back(factor);
+      numberOfProcesses /= factor;
+    }
+    else
+    {
+      factor = factor * factor > numberOfProcesses ? numberOfProcesses : factor + 1;
+    }
+  }
+
+  grid[0] = grid[1] = grid[2] = 1;
+  // split the longest side of the blocks first, with the largest factors.
+  for (auto factor = factors.rbegin(); factor != factors.rend(); ++factor)
+  {
+    int axis = 0;
+    for (int cc = 1; cc < 3; ++cc)
+    {
+      if (static_cast<double>(cells[cc]) / grid[cc] >
+        static_cast<double>(cells[axis]) / grid[axis])
+      {
+        axis = cc;
+      }
+    }
+    grid[axis] *= *factor;
+  }
+}
+}
+
 vtkStandardNewMacro(vtkCPUniformGridBuilder);
 vtkCxxSetObjectMacro(vtkCPUniformGridBuilder, UniformGrid, vtkUniformGrid);
 
 //----------------------------------------------------------------------------
 vtkCPUniformGridBuilder::vtkCPUniformGridBuilder()
 {
+  this->ScalingMode = X_SLABS;
   for (int i = 0; i < 3; i++)
   {
     this->Dimensions[i] = 0;
@@ -70,9 +112,64 @@ double* vtkCPUniformGridBuilder::GetOrigin()
   return this->Origin;
 }
 
+//----------------------------------------------------------------------------
+vtkIdType vtkCPUniformGridBuilder::GetGlobalNumberOfCells()
+{
+  vtkIdType numberOfCells = static_cast<vtkIdType>(this->Dimensions[0]) * this->Dimensions[1] *
+    this->Dimensions[2];
+  if (this->ScalingMode == WEAK_SCALING)
+  {
+    numberOfCells *= vtkMultiProcessController::GetGlobalController()->GetNumberOfProcesses();
+  }
+  return numberOfCells;
+}
+
+//----------------------------------------------------------------------------
+void vtkCPUniformGridBuilder::ComputeLocalExtent(int extent[6])
+{
+  vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+  int numberOfProcesses = controller->GetNumberOfProcesses();
+  int processId = controller->GetLocalProcessId();
+
+  if (this->ScalingMode == X_SLABS)
+  {
+    // partition in the x-direction
+    extent[0] = this->Dimensions[0] * processId / numberOfProcesses;
+    extent[1] = this->Dimensions[0] * (processId + 1) / numberOfProcesses;
+    extent[2] = 0;
+    extent[3] = this->Dimensions[1];
+    extent[4] = 0;
+    extent[5] = this->Dimensions[2];
+    return;
+  }
+
+  int grid[3];
+  ::ComputeProcessGrid(numberOfProcesses, this->Dimensions, grid);
+  const int block[3] = { processId % grid[0], (processId / grid[0]) % grid[1],
+    processId / (grid[0] * grid[1]) };
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    if (this->ScalingMode == WEAK_SCALING)
+    {
+      extent[2 * axis] = this->Dimensions[axis] * block[axis];
+      extent[2 * axis + 1] = this->Dimensions[axis] * (block[axis] + 1);
+    }
+    else
+    {
+      // 64-bit arithmetic so that large grids do not overflow.
+      const vtkTypeInt64 cells = this->Dimensions[axis];
+      extent[2 * axis] = static_cast<int>(cells * block[axis] / grid[axis]);
+      extent[2 * axis + 1] = static_cast<int>(cells * (block[axis] + 1) / grid[axis]);
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 bool vtkCPUniformGridBuilder::CreateUniformGrid()
 {
+  int extents[6];
+  this->ComputeLocalExtent(extents);
+
   bool builtNewGrid = 0;
   if (this->UniformGrid == nullptr)
   {
@@ -82,7 +179,8 @@ bool vtkCPUniformGridBuilder::CreateUniformGrid()
   {
     for (int i = 0; i < 3; i++)
     {
-      if (this->Dimensions[i] != this->UniformGrid->GetDimensions()[i] ||
+      if (extents[2 * i] != this->UniformGrid->GetExtent()[2 * i] ||
+        extents[2 * i + 1] != this->UniformGrid->GetExtent()[2 * i + 1] ||
         this->Spacing[i] != this->UniformGrid->GetSpacing()[i] ||
         this->Origin[i] != this->UniformGrid->GetOrigin()[i])
       {
@@ -96,20 +194,12 @@ bool vtkCPUniformGridBuilder::CreateUniformGrid()
     vtkUniformGrid* newGrid = vtkUniformGrid::New();
     newGrid->SetSpacing(this->Spacing);
     newGrid->SetOrigin(this->Origin);
-
-    vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
-    int numberOfProcesses = controller->GetNumberOfProcesses();
-    int processId = controller->GetLocalProcessId();
-    // partition in the x-direction
-    int extents[6] = { this->Dimensions[0] * processId / numberOfProcesses,
-      this->Dimensions[0] * (processId + 1) / numberOfProcesses, 0, this->Dimensions[1], 0,
-      this->Dimensions[2] };
     newGrid->SetExtent(extents);
 
     this->SetUniformGrid(newGrid);
     newGrid->Delete();
   }
-  return true;
+  return builtNewGrid;
 }
 
 //----------------------------------------------------------------------------
@@ -117,6 +207,7 @@ void vtkCPUniformGridBuilder::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "UniformGrid: " << this->UniformGrid << "\n";
+  os << indent << "ScalingMode: " << this->ScalingMode << "\n";
   os << indent << "Dimensions: " << this->Dimensions[0] << " " << this->Dimensions[1] << " "
      << this->Dimensions[2] << "\n";
   os << indent << "Spacing: " << this->Spacing[0] << " " << this->Spacing[1] << " "
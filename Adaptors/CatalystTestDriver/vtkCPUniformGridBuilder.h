@@ -5,6 +5,15 @@
  * @brief   Class for creating uniform grids.
  *
  * Class for creating vtkUniformGrids for a test driver.
+ *
+ * The grid is partitioned among the processes of the global controller
+ * according to ScalingMode. X_SLABS (the default) splits the Dimensions
+ * cells in slabs along the x axis. STRONG_SCALING splits the Dimensions cells
+ * in blocks as close to cubes as possible, so that the global problem size
+ * does not depend on the number of processes. WEAK_SCALING gives every
+ * process a block of Dimensions cells, so that the global problem size grows
+ * with the number of processes; this is the mode to use to reach billions
+ * of cells.
  */
 
 #ifndef vtkCPUniformGridBuilder_h
@@ -30,9 +39,30 @@ public:
    */
   vtkDataObject* GetGrid(unsigned long timeStep, double time, int& builtNewGrid) override;
 
+  enum ScalingModes
+  {
+    X_SLABS = 0,
+    STRONG_SCALING = 1,
+    WEAK_SCALING = 2
+  };
+
   ///@{
   /**
-   * Set/get the Dimensions of the uniform grid.
+   * Set/get how the grid is partitioned among processes. Default is X_SLABS.
+   */
+  vtkSetClampMacro(ScalingMode, int, X_SLABS, WEAK_SCALING);
+  vtkGetMacro(ScalingMode, int);
+  ///@}
+
+  /**
+   * Returns the number of cells of the grid summed over all processes.
+   */
+  vtkIdType GetGlobalNumberOfCells();
+
+  ///@{
+  /**
+   * Set/get the Dimensions of the uniform grid, in cells. With WEAK_SCALING,
+   * these are the dimensions of the block of each process.
    */
   vtkSetVector3Macro(Dimensions, int);
   int* GetDimensions();
@@ -73,6 +103,16 @@ private:
   vtkCPUniformGridBuilder(const vtkCPUniformGridBuilder&) = delete;
   void operator=(const vtkCPUniformGridBuilder&) = delete;
 
+  /**
+   * Computes the extent of the block owned by this process.
+   */
+  void ComputeLocalExtent(int extent[6]);
+
+  /**
+   * How the grid is partitioned among processes.
+   */
+  int ScalingMode;
+
   /**
    * The dimensions of the vtkUniformGrid.
    */
@@ -719,7 +719,16 @@ static void ${_paraview_build_target_safe}_initialize()
       endif ()
       set(_paraview_build_delayed_load 0)
       if (_paraview_build_plugin IN_LIST _paraview_build_DELAYED_LOAD)
-        set(_paraview_build_delayed_load 1)
+        get_property(_paraview_build_plugin_delayed_load_xmls GLOBAL
+          PROPERTY "_paraview_plugin_${_paraview_build_plugin}_xmls")
+        if (_paraview_build_plugin_delayed_load_xmls)
+          set(_paraview_build_delayed_load 1)
+        else ()
+          # Nothing would trigger the load of a plugin without proxies.
+          message(AUTHOR_WARNING
+            "The ${_paraview_build_plugin} plugin has no server manager XMLs and "
+            "cannot be delay loaded; it will be loaded as usual.")
+        endif ()
       endif ()
       string(APPEND _paraview_build_xml_content
         "  <Plugin name=\"${_paraview_build_plugin}\" auto_load=\"${_paraview_build_autoload}\" delayed_load=\"${_paraview_build_delayed_load}\"")
@@ -727,8 +736,6 @@ static void ${_paraview_build_target_safe}_initialize()
       if (_paraview_build_delayed_load)
         string(APPEND _paraview_build_xml_content ">\n")
 
-        get_property(_paraview_build_plugin_delayed_load_xmls GLOBAL
-          PROPERTY "_paraview_plugin_${_paraview_build_plugin}_xmls")
         foreach (_paraview_build_plugin_delayed_load_xml IN LISTS _paraview_build_plugin_delayed_load_xmls)
           # Copy XML to build for easier usage
           configure_file(${_paraview_build_plugin_delayed_load_xml} "${CMAKE_BINARY_DIR}/${_paraview_build_plugin_directory}" COPYONLY)
@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+// Run the test driver in benchmark mode with one pipeline of each type
+// and check the JSON report it writes.
+
+#include "vtkCPBenchmarkPipeline.h"
+#include "vtkCPNodalFieldBuilder.h"
+#include "vtkCPSinusoidalScalarFieldFunction.h"
+#include "vtkCPTestDriver.h"
+#include "vtkCPUniformGridBuilder.h"
+#include "vtkNew.h"
+#include "vtkTestUtilities.h"
+
+#include "vtk_nlohmannjson.h"
+// clang-format off
+#include VTK_NLOHMANN_JSON(json.hpp) // for json
+// clang-format on
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <string>
+
+namespace
+{
+constexpr int NumberOfTimeSteps = 4;
+constexpr int NumberOfPipelines = 4;
+
+bool Check(bool condition, const char* message)
+{
+  if (!condition)
+  {
+    vtkGenericWarningMacro(<< message);
+  }
+  return condition;
+}
+
+bool CheckReport(const std::string& fileName)
+{
+  vtksys::ifstream input(fileName.c_str());
+  const nlohmann::json report = nlohmann::json::parse(input, nullptr, false);
+  if (!Check(!report.is_discarded() && report.is_object() && report.contains("pipelines") &&
+        report.contains("cycles"),
+        "Invalid benchmark report."))
+  {
+    return false;
+  }
+
+  bool success = Check(report.value("number_of_time_steps", 0) == NumberOfTimeSteps &&
+      report["pipelines"].size() == NumberOfPipelines,
+    "Unexpected number of time steps or pipelines.");
+  const auto& cycles = report["cycles"];
+  if (!Check(cycles.is_array() && cycles.size() == NumberOfTimeSteps, "Unexpected cycles."))
+  {
+    return false;
+  }
+
+  // weak scaling: 20^3 cells per process.
+  const vtkTypeInt64 numberOfCells = 8000 * report.value("number_of_processes", 1);
+  vtkTypeInt64 memoryHighWaterMark = 0;
+  for (int step = 0; step < NumberOfTimeSteps; ++step)
+  {
+    const auto& cycle = cycles[step];
+    for (const char* key : { "time_step", "time", "grid_time", "catalyst_time",
+           "memory_high_water_mark", "number_of_cells", "extract_number_of_cells",
+           "extract_size" })
+    {
+      if (!Check(cycle.contains(key) && cycle[key].is_number(), "Missing cycle value."))
+      {
+        vtkGenericWarningMacro("Missing " << key << " at time step " << step << ".");
+        return false;
+      }
+    }
+    success &= Check(cycle["time_step"].get<int>() == step, "Unexpected time step.");
+    success &= Check(cycle["grid_time"].get<double>() >= 0 &&
+        cycle["catalyst_time"].get<double>() > 0,
+      "Unexpected times.");
+    success &= Check(cycle["number_of_cells"].get<vtkTypeInt64>() == numberOfCells,
+      "Unexpected number of cells.");
+    success &= Check(cycle["extract_number_of_cells"].get<vtkTypeInt64>() > 0 &&
+        cycle["extract_size"].get<vtkTypeInt64>() > 0,
+      "Unexpected extracts.");
+
+    // a peak, so it never decreases.
+    const auto memory = cycle["memory_high_water_mark"].get<vtkTypeInt64>();
+    success &= Check(memory > 0 && memory >= memoryHighWaterMark,
+      "Unexpected memory high-water mark.");
+    memoryHighWaterMark = memory;
+  }
+  success &= Check(report.value("memory_high_water_mark", vtkTypeInt64(0)) == memoryHighWaterMark,
+    "Unexpected overall memory high-water mark.");
+  return success;
+}
+}
+
+int BenchmarkDriver(int argc, char* argv[])
+{
+  vtkNew<vtkCPSinusoidalScalarFieldFunction> fieldFunction;
+  fieldFunction->SetAmplitude(1.);
+  fieldFunction->SetWaveNumber(.5, .25, .1);
+
+  vtkNew<vtkCPNodalFieldBuilder> fieldBuilder;
+  fieldBuilder->SetArrayName("Pressure");
+  fieldBuilder->SetTensorFieldFunction(fieldFunction);
+
+  vtkNew<vtkCPUniformGridBuilder> gridBuilder;
+  gridBuilder->SetScalingMode(vtkCPUniformGridBuilder::WEAK_SCALING);
+  gridBuilder->SetDimensions(20, 20, 20);
+  gridBuilder->SetSpacing(1., 1., 1.);
+  gridBuilder->SetOrigin(0., 0., 0.);
+  gridBuilder->SetFieldBuilder(fieldBuilder);
+
+  vtkNew<vtkCPTestDriver> testDriver;
+  testDriver->SetNumberOfTimeSteps(NumberOfTimeSteps);
+  testDriver->SetGridBuilder(gridBuilder);
+  for (int type = vtkCPBenchmarkPipeline::SLICE; type <= vtkCPBenchmarkPipeline::IMAGE_EXTRACT;
+       ++type)
+  {
+    vtkNew<vtkCPBenchmarkPipeline> pipeline;
+    pipeline->SetPipelineType(type);
+    pipeline->SetArrayName("Pressure");
+    pipeline->SetOrigin(10., 10., 10.);
+    pipeline->SetImageDimensions(16, 16, 16);
+    testDriver->AddPipeline(pipeline);
+  }
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  const std::string fileName = std::string(tempDir) + "/BenchmarkDriver.json";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveFile(fileName);
+  testDriver->SetBenchmarkFileName(fileName.c_str());
+
+  if (testDriver->Run() != 0)
+  {
+    return 1;
+  }
+  if (!vtksys::SystemTools::FileExists(fileName, true))
+  {
+    vtkGenericWarningMacro("Benchmark report " << fileName << " was not written.");
+    return 1;
+  }
+  return CheckReport(fileName) ? 0 : 1;
+}
@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include <catalyst_conduit.hpp>
+
+#include "vtkCatalystInTransitBuffer.h"
+#include "vtkNew.h"
+
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+constexpr int NumberOfSteps = 10;
+constexpr vtkTypeUInt64 SlotSize = 1 << 16;
+
+std::string GetSegmentName(const char* suffix)
+{
+  return "/pvcatalyst-test-" + std::to_string(getpid()) + "-" + suffix;
+}
+
+bool Check(bool condition, const char* message)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << message << std::endl;
+  }
+  return condition;
+}
+
+double GetElapsedTime(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool PushMessage(vtkCatalystInTransitBuffer* buffer, int step)
+{
+  conduit_cpp::Node node;
+  node["catalyst/state/timestep"].set(step);
+  node["catalyst/channels/grid/type"].set("mesh");
+  std::vector<double> values(100, step);
+  node["catalyst/channels/grid/data/values"].set(values.data(), values.size());
+  return buffer->Push(vtkCatalystInTransitBuffer::EXECUTE, node);
+}
+
+bool IsMessage(const conduit_cpp::Node& node, int step)
+{
+  if (!node.has_path("catalyst/state/timestep") ||
+    node["catalyst/state/timestep"].to_int() != step ||
+    node["catalyst/channels/grid/type"].as_string() != "mesh")
+  {
+    return false;
+  }
+  const auto values = node["catalyst/channels/grid/data/values"];
+  if (values.dtype().number_of_elements() != 100)
+  {
+    return false;
+  }
+  for (conduit_index_t cc = 0; cc < 100; ++cc)
+  {
+    if (*static_cast<const double*>(values.element_ptr(cc)) != step)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Runs in the consumer process: reads every message the producer sends.
+ */
+int Consume(const std::string& name)
+{
+  vtkNew<vtkCatalystInTransitBuffer> buffer;
+  if (!buffer->Open(name, 10))
+  {
+    return 1;
+  }
+  vtkCatalystInTransitBuffer::MessageKind kind;
+  conduit_cpp::Node node;
+  if (!buffer->Pop(kind, node) || kind != vtkCatalystInTransitBuffer::INITIALIZE)
+  {
+    return 2;
+  }
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    // slower than the producer, so that it has to wait for free slots.
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (!buffer->Pop(kind, node) || kind != vtkCatalystInTransitBuffer::EXECUTE ||
+      !IsMessage(node, step))
+    {
+      return 3;
+    }
+  }
+  if (!buffer->Pop(kind, node) || kind != vtkCatalystInTransitBuffer::FINALIZE)
+  {
+    return 4;
+  }
+  buffer->Close();
+  return 0;
+}
+
+bool WaitForChild(pid_t child, int expected)
+{
+  int status = 0;
+  return waitpid(child, &status, 0) == child && WIFEXITED(status) &&
+    WEXITSTATUS(status) == expected;
+}
+
+bool TestProducerConsumer()
+{
+  const std::string name = GetSegmentName("exchange");
+  vtkNew<vtkCatalystInTransitBuffer> buffer;
+  if (!Check(buffer->Create(name, 2, SlotSize), "Failed to create the segment."))
+  {
+    return false;
+  }
+  const pid_t child = fork();
+  if (child == 0)
+  {
+    _exit(Consume(name));
+  }
+
+  conduit_cpp::Node empty;
+  bool success = Check(buffer->Push(vtkCatalystInTransitBuffer::INITIALIZE, empty),
+    "Failed to push the initialization.");
+  for (int step = 0; step < NumberOfSteps && success; ++step)
+  {
+    success = Check(PushMessage(buffer, step), "Failed to push a message.");
+  }
+  success = success &&
+    Check(buffer->Push(vtkCatalystInTransitBuffer::FINALIZE, empty),
+      "Failed to push the finalization.") &&
+    Check(buffer->WaitUntilEmpty(), "Failed to wait for the consumer.");
+  buffer->Close();
+  success &= Check(WaitForChild(child, 0), "The consumer did not read the expected messages.");
+  return success;
+}
+
+bool TestDeadConsumer()
+{
+  const std::string name = GetSegmentName("dead-consumer");
+  vtkNew<vtkCatalystInTransitBuffer> buffer;
+  if (!Check(buffer->Create(name, 1, SlotSize), "Failed to create the segment."))
+  {
+    return false;
+  }
+  const pid_t child = fork();
+  if (child == 0)
+  {
+    // dies without closing the segment.
+    vtkNew<vtkCatalystInTransitBuffer> consumer;
+    _exit(consumer->Open(name, 10) ? 0 : 1);
+  }
+  bool success = Check(WaitForChild(child, 0), "The consumer failed to open the segment.");
+
+  const auto start = std::chrono::steady_clock::now();
+  success &= Check(PushMessage(buffer, 0), "Failed to push to a free slot.");
+  success &= Check(!PushMessage(buffer, 1), "Pushing to a full buffer without consumer succeeded.");
+  success &= Check(!buffer->WaitUntilEmpty(), "Waiting for a dead consumer succeeded.");
+  success &= Check(GetElapsedTime(start) < buffer->GetTimeout() / 2,
+    "Waited for a dead consumer.");
+  buffer->Close();
+  return success;
+}
+
+bool TestMissingConsumer()
+{
+  const std::string name = GetSegmentName("missing-consumer");
+  vtkNew<vtkCatalystInTransitBuffer> buffer;
+  if (!Check(buffer->Create(name, 1, SlotSize), "Failed to create the segment."))
+  {
+    return false;
+  }
+  buffer->SetTimeout(1);
+
+  bool success = Check(PushMessage(buffer, 0), "Failed to push to a free slot.");
+  auto start = std::chrono::steady_clock::now();
+  success &= Check(!PushMessage(buffer, 1), "Pushing to a full buffer without consumer succeeded.");
+  success &= Check(GetElapsedTime(start) < 10, "Did not time out waiting for a consumer.");
+
+  // once timed out, the next calls fail right away.
+  start = std::chrono::steady_clock::now();
+  success &= Check(!PushMessage(buffer, 2), "Pushing after a time out succeeded.");
+  success &= Check(GetElapsedTime(start) < 0.5, "Waited again for a missing consumer.");
+  buffer->Close();
+  return success;
+}
+
+bool TestDeadProducer()
+{
+  // the producer is not waited for: have its zombie reaped by the system.
+  signal(SIGCHLD, SIG_IGN);
+
+  const std::string name = GetSegmentName("dead-producer");
+  const pid_t child = fork();
+  if (child == 0)
+  {
+    // publishes a message and dies without closing the segment.
+    vtkNew<vtkCatalystInTransitBuffer> producer;
+    if (producer->Create(name, 2, SlotSize))
+    {
+      producer->Push(vtkCatalystInTransitBuffer::INITIALIZE, conduit_cpp::Node());
+      std::this_thread::sleep_for(std::chrono::seconds(2));
+    }
+    _exit(0);
+  }
+
+  vtkNew<vtkCatalystInTransitBuffer> buffer;
+  bool success = Check(buffer->Open(name, 10), "Failed to open the segment.");
+  vtkCatalystInTransitBuffer::MessageKind kind;
+  conduit_cpp::Node node;
+  success &= Check(buffer->Pop(kind, node) && kind == vtkCatalystInTransitBuffer::INITIALIZE,
+    "Failed to read the message published before the producer died.");
+  const auto start = std::chrono::steady_clock::now();
+  success &= Check(!buffer->Pop(kind, node), "Reading from a dead producer succeeded.");
+  success &= Check(GetElapsedTime(start) < 30, "Waited for a dead producer.");
+  buffer->Close();
+  shm_unlink(name.c_str());
+  signal(SIGCHLD, SIG_DFL);
+  return success;
+}
+}
+
+int TestCatalystInTransitBuffer(int, char*[])
+{
+  bool success = TestProducerConsumer();
+  success &= TestDeadConsumer();
+  success &= TestMissingConsumer();
+  success &= TestDeadProducer();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,238 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include <catalyst.h>
+#include <catalyst_conduit.hpp>
+
+#include "vtkAlgorithm.h"
+#include "vtkCallbackCommand.h"
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkCommand.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataSet.h"
+#include "vtkFieldData.h"
+#include "vtkIdList.h"
+#include "vtkInSituInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkSMSourceProxy.h"
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+/**
+ * Memory of the simulation: the coordinates of a single hexahedron.
+ */
+struct Simulation
+{
+  std::vector<double> Points;
+
+  Simulation()
+  {
+    for (int cc = 0; cc < 8; ++cc)
+    {
+      this->Points.push_back((cc & 1) ^ ((cc >> 1) & 1));
+      this->Points.push_back((cc >> 1) & 1);
+      this->Points.push_back((cc >> 2) & 1);
+    }
+  }
+};
+
+/**
+ * Value of `state/unchanged` passed by the adaptor, if any.
+ */
+enum class ChannelState
+{
+  Changed,
+  Unchanged,
+  Unset
+};
+
+/**
+ * Calls `catalyst_execute` with a node built like an adaptor would: the
+ * coordinates reference the simulation's memory, everything else is owned by
+ * the node. The node is scribbled over and destroyed before returning.
+ */
+bool Execute(Simulation& sim, int timestep, ChannelState state)
+{
+  conduit_cpp::Node node;
+  node["catalyst/state/timestep"].set(timestep);
+  node["catalyst/state/time"].set(timestep * 0.5);
+
+  auto channel = node["catalyst/channels/grid"];
+  channel["type"].set("mesh");
+  if (state != ChannelState::Unset)
+  {
+    channel["state/unchanged"].set(state == ChannelState::Unchanged ? 1 : 0);
+  }
+
+  auto mesh = channel["data"];
+  mesh["coordsets/coords/type"].set("explicit");
+  for (int cc = 0; cc < 3; ++cc)
+  {
+    const char* names[] = { "x", "y", "z" };
+    mesh["coordsets/coords/values"][names[cc]].set_external(
+      sim.Points.data(), 8, /*offset=*/cc * sizeof(double), /*stride=*/3 * sizeof(double));
+  }
+  mesh["topologies/mesh/type"].set("unstructured");
+  mesh["topologies/mesh/coordset"].set("coords");
+  mesh["topologies/mesh/elements/shape"].set("hex");
+  const conduit_int32 connectivity[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  mesh["topologies/mesh/elements/connectivity"].set(connectivity, 8);
+  mesh["fields/level/association"].set("element");
+  mesh["fields/level/topology"].set("mesh");
+  const conduit_float64 level = 42.0;
+  mesh["fields/level/values"].set(&level, 1);
+
+  const bool success = catalyst_execute(conduit_cpp::c_node(&node)) == catalyst_status_ok;
+
+  // leave nothing the implementation could still be reading by mistake.
+  auto connectivity_node = mesh["topologies/mesh/elements/connectivity"];
+  std::memset(connectivity_node.element_ptr(0), 0xff, 8 * sizeof(conduit_int32));
+  mesh["topologies/mesh/elements/shape"].set("line");
+  node.reset();
+  return success;
+}
+
+bool Check(bool condition, const char* message)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << message << std::endl;
+  }
+  return condition;
+}
+
+double GetFieldValue(vtkDataObject* output, const char* name)
+{
+  auto array = output ? vtkDataArray::SafeDownCast(output->GetFieldData()->GetAbstractArray(name))
+                      : nullptr;
+  return array && array->GetNumberOfTuples() == 1 ? array->GetComponent(0, 0) : -1.0;
+}
+
+/**
+ * Returns true if `output` holds the hexahedron of `sim` with its cell field.
+ */
+bool IsValid(vtkDataObject* output, const Simulation& sim)
+{
+  const auto datasets = vtkCompositeDataSet::GetDataSets(output);
+  if (datasets.size() != 1 || datasets[0]->GetNumberOfPoints() != 8 ||
+    datasets[0]->GetNumberOfCells() != 1 || datasets[0]->GetCellType(0) != VTK_HEXAHEDRON)
+  {
+    return false;
+  }
+  auto dataset = datasets[0];
+  vtkNew<vtkIdList> ids;
+  dataset->GetCellPoints(0, ids);
+  for (vtkIdType cc = 0; cc < 8; ++cc)
+  {
+    double point[3];
+    dataset->GetPoint(ids->GetId(cc), point);
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      if (point[comp] != sim.Points[cc * 3 + comp])
+      {
+        return false;
+      }
+    }
+  }
+  auto level = dataset->GetCellData()->GetArray("level");
+  return level != nullptr && level->GetComponent(0, 0) == 42.0;
+}
+
+void CountExecutions(vtkObject*, unsigned long, void* clientdata, void*)
+{
+  ++(*static_cast<int*>(clientdata));
+}
+}
+
+int TestCatalystUnchangedChannel(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " <catalyst implementation directory>" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  conduit_cpp::Node params;
+  params["catalyst_load/implementation"].set("paraview");
+  params["catalyst_load/search_paths/paraview"].set(argv[1]);
+  if (catalyst_initialize(conduit_cpp::c_node(&params)) != catalyst_status_ok)
+  {
+    std::cerr << "Failed to initialize Catalyst." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  Simulation sim;
+  bool success = Check(::Execute(sim, 0, ChannelState::Changed), "First execution failed.");
+  auto producer = vtkInSituInitializationHelper::GetProducer("grid");
+  auto algo = producer ? vtkAlgorithm::SafeDownCast(producer->GetClientSideObject()) : nullptr;
+  conduit_cpp::Node finalize;
+  if (!Check(algo != nullptr, "No producer for channel 'grid'."))
+  {
+    catalyst_finalize(conduit_cpp::c_node(&finalize));
+    return EXIT_FAILURE;
+  }
+
+  int executions = 0;
+  vtkNew<vtkCallbackCommand> observer;
+  observer->SetCallback(&CountExecutions);
+  observer->SetClientData(&executions);
+  algo->AddObserver(vtkCommand::StartEvent, observer);
+
+  algo->Update();
+  success &= Check(executions == 1, "Producer did not execute.");
+  success &= Check(IsValid(algo->GetOutputDataObject(0), sim), "Invalid output.");
+
+  // the producer is not modified, only the field data is refreshed.
+  success &= Check(::Execute(sim, 1, ChannelState::Unchanged),
+    "Execution with an unchanged channel failed.");
+  algo->Update();
+  success &= Check(executions == 1, "Producer re-executed for an unchanged channel.");
+  success &= Check(IsValid(algo->GetOutputDataObject(0), sim), "Invalid unchanged output.");
+  success &= Check(GetFieldValue(algo->GetOutputDataObject(0), "time") == 0.5 &&
+      GetFieldValue(algo->GetOutputDataObject(0), "timestep") == 1,
+    "Field data of an unchanged channel was not updated.");
+
+  // the adaptor's node is gone: the producer must still be able to re-execute
+  // from what ParaView kept.
+  algo->Modified();
+  algo->Update();
+  success &= Check(executions == 2, "Producer did not re-execute.");
+  success &= Check(IsValid(algo->GetOutputDataObject(0), sim),
+    "Invalid output when re-executing for an unchanged channel.");
+  success &= Check(GetFieldValue(algo->GetOutputDataObject(0), "time") == 0.5,
+    "Stale field data when re-executing for an unchanged channel.");
+
+  // a changed channel is converted again.
+  for (size_t cc = 0; cc < sim.Points.size(); cc += 3)
+  {
+    sim.Points[cc] += 1.0;
+  }
+  success &= Check(
+    ::Execute(sim, 2, ChannelState::Changed), "Execution with a changed channel failed.");
+  algo->Update();
+  success &= Check(executions == 3, "Producer did not re-execute for a changed channel.");
+  success &= Check(IsValid(algo->GetOutputDataObject(0), sim), "Invalid changed output.");
+  success &= Check(GetFieldValue(algo->GetOutputDataObject(0), "time") == 1.0,
+    "Field data of a changed channel was not updated.");
+
+  // a channel that does not set the flag is not kept: marking it unchanged
+  // afterwards converts it again.
+  success &= Check(::Execute(sim, 3, ChannelState::Unset), "Execution without the flag failed.");
+  success &= Check(::Execute(sim, 4, ChannelState::Unchanged),
+    "Execution with an unchanged channel failed.");
+  algo->Update();
+  success &= Check(executions == 4, "Producer did not re-execute for a channel not kept.");
+  success &= Check(IsValid(algo->GetOutputDataObject(0), sim), "Invalid output after opting in.");
+  success &= Check(GetFieldValue(algo->GetOutputDataObject(0), "time") == 2.0,
+    "Field data was not updated after opting in.");
+
+  algo->RemoveObserver(observer);
+  success &= Check(catalyst_finalize(conduit_cpp::c_node(&finalize)) == catalyst_status_ok,
+    "Failed to finalize Catalyst.");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -9,21 +9,35 @@
 
 #include "vtkCallbackCommand.h"
 #include "vtkCatalystBlueprint.h"
+#include "vtkCatalystInTransitBuffer.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
 #include "vtkCommand.h"
+#include "vtkCompositeDataSet.h"
 #include "vtkConduitSource.h"
+#include "vtkDataArray.h"
 #include "vtkDataObjectToConduit.h"
+#include "vtkFieldData.h"
 #include "vtkInSituInitializationHelper.h"
 #include "vtkInSituPipelineIO.h"
 #include "vtkInSituPipelinePython.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkPVLogger.h"
 #include "vtkPartitionedDataSet.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkSMPluginManager.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMProxyManager.h"
 #include "vtkSMSessionProxyManager.h"
 #include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
 
 #if VTK_MODULE_ENABLE_VTK_ParallelMPI
 #include "vtkMPI.h"
@@ -39,6 +53,11 @@
 
 #include "catalyst_impl_paraview.h"
 
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
 static bool update_producer_mesh_blueprint(const std::string& channel_name,
   const conduit_node* node, const conduit_node* global_fields, bool multimesh,
   const conduit_node* assemblyNode, bool multiblock, bool amr)
@@ -68,6 +87,356 @@ static bool update_producer_mesh_blueprint(const std::string& channel_name,
   return true;
 }
 
+namespace
+{
+/**
+ * Accounts for the bytes of the arrays produced by vtkConduitSource that
+ * reference the memory passed by the simulation (borrowed) and those that had
+ * to be allocated by the conversion (copied).
+ */
+class IngestionReport
+{
+public:
+  explicit IngestionReport(conduit_node* node) { this->AddBuffers(node); }
+
+  void AddDataObject(vtkDataObject* dobj)
+  {
+    for (auto ds : vtkCompositeDataSet::GetDataSets(dobj))
+    {
+      this->AddDataSet(ds);
+    }
+  }
+
+  void Log(const std::string& channel_name) const
+  {
+    std::string copied;
+    for (const auto& name : this->CopiedArrays)
+    {
+      copied += (copied.empty() ? "" : ", ") + name;
+    }
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+      "channel '%s': %llu bytes borrowed, %llu bytes copied [%s]", channel_name.c_str(),
+      static_cast<unsigned long long>(this->BytesBorrowed),
+      static_cast<unsigned long long>(this->BytesCopied), copied.c_str());
+  }
+
+private:
+  using BufferT = std::pair<const char*, const char*>;
+
+  void AddBuffers(conduit_node* c_node)
+  {
+    auto node = conduit_cpp::cpp_node(c_node);
+    const conduit_index_t nchildren = node.number_of_children();
+    if (nchildren == 0)
+    {
+      const auto dtype = node.dtype();
+      const conduit_index_t count = dtype.number_of_elements();
+      if (dtype.is_number() && count > 0)
+      {
+        auto begin = static_cast<const char*>(node.element_ptr(0));
+        this->Buffers.emplace_back(
+          begin, begin + dtype.stride() * (count - 1) + dtype.element_bytes());
+      }
+      return;
+    }
+    for (conduit_index_t i = 0; i < nchildren; ++i)
+    {
+      auto child = node.child(i);
+      this->AddBuffers(conduit_cpp::c_node(&child));
+    }
+  }
+
+  bool IsBorrowed(const void* ptr) const
+  {
+    auto cptr = static_cast<const char*>(ptr);
+    return std::any_of(this->Buffers.begin(), this->Buffers.end(),
+      [cptr](const BufferT& buffer) { return cptr >= buffer.first && cptr < buffer.second; });
+  }
+
+  template <typename ValueT>
+  bool IsSOABorrowed(vtkSOADataArrayTemplate<ValueT>* array) const
+  {
+    for (int cc = 0; cc < array->GetNumberOfComponents(); ++cc)
+    {
+      auto ptr = array->GetComponentArrayPointer(cc);
+      if (ptr == nullptr || !this->IsBorrowed(ptr))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void AddArray(vtkAbstractArray* array, const char* name)
+  {
+    if (array == nullptr || array->GetNumberOfValues() == 0)
+    {
+      return;
+    }
+
+    const auto bytes = static_cast<vtkTypeUInt64>(array->GetNumberOfValues()) *
+      static_cast<vtkTypeUInt64>(array->GetDataTypeSize());
+    // string or variant arrays are always converted.
+    auto darray = vtkDataArray::SafeDownCast(array);
+    bool borrowed = false;
+    if (darray == nullptr)
+    {
+      borrowed = false;
+    }
+    else if (darray->HasStandardMemoryLayout())
+    {
+      borrowed = this->IsBorrowed(darray->GetVoidPointer(0));
+    }
+    else if (darray->GetArrayType() == vtkAbstractArray::SoADataArrayTemplate)
+    {
+      switch (darray->GetDataType())
+      {
+        vtkTemplateMacro(
+          borrowed = this->IsSOABorrowed(static_cast<vtkSOADataArrayTemplate<VTK_TT>*>(darray)));
+      }
+    }
+    else
+    {
+      // implicit arrays compute or index into their values without owning a
+      // copy of them.
+      borrowed = true;
+    }
+
+    if (borrowed)
+    {
+      this->BytesBorrowed += bytes;
+    }
+    else
+    {
+      this->BytesCopied += bytes;
+      this->CopiedArrays.emplace_back(name ? name : "(unnamed)");
+    }
+  }
+
+  void AddCells(vtkCellArray* cells, const char* name)
+  {
+    if (cells)
+    {
+      this->AddArray(cells->GetOffsetsArray(), name);
+      this->AddArray(cells->GetConnectivityArray(), name);
+    }
+  }
+
+  void AddFields(vtkFieldData* fd)
+  {
+    for (int cc = 0, max = fd->GetNumberOfArrays(); cc < max; ++cc)
+    {
+      auto array = fd->GetAbstractArray(cc);
+      this->AddArray(array, array->GetName());
+    }
+  }
+
+  void AddDataSet(vtkDataSet* ds)
+  {
+    this->AddFields(ds->GetPointData());
+    this->AddFields(ds->GetCellData());
+    this->AddFields(ds->GetFieldData());
+    if (auto ps = vtkPointSet::SafeDownCast(ds))
+    {
+      this->AddArray(ps->GetPoints() ? ps->GetPoints()->GetData() : nullptr, "coordinates");
+    }
+    if (auto rg = vtkRectilinearGrid::SafeDownCast(ds))
+    {
+      this->AddArray(rg->GetXCoordinates(), "coordinates/x");
+      this->AddArray(rg->GetYCoordinates(), "coordinates/y");
+      this->AddArray(rg->GetZCoordinates(), "coordinates/z");
+    }
+    if (auto ug = vtkUnstructuredGrid::SafeDownCast(ds))
+    {
+      this->AddCells(ug->GetCells(), "connectivity");
+      this->AddArray(ug->GetCellTypesArray(), "shapes");
+    }
+    else if (auto pd = vtkPolyData::SafeDownCast(ds))
+    {
+      this->AddCells(pd->GetVerts(), "verts");
+      this->AddCells(pd->GetLines(), "lines");
+      this->AddCells(pd->GetPolys(), "polys");
+      this->AddCells(pd->GetStrips(), "strips");
+    }
+  }
+
+  std::vector<BufferT> Buffers;
+  vtkTypeUInt64 BytesBorrowed = 0;
+  vtkTypeUInt64 BytesCopied = 0;
+  std::vector<std::string> CopiedArrays;
+};
+}
+
+/**
+ * Logs how much of the data produced for a Blueprint mesh channel references
+ * the simulation's memory and how much was copied. Only done when the
+ * producer was updated during this `catalyst_execute` call, while the
+ * channel's node still holds the simulation's memory.
+ */
+static void report_mesh_ingestion(const std::string& channel_name, conduit_node* node)
+{
+  auto producer = vtkInSituInitializationHelper::GetProducer(channel_name);
+  auto algo = producer ? vtkAlgorithm::SafeDownCast(producer->GetClientSideObject()) : nullptr;
+  auto output = algo ? algo->GetOutputDataObject(0) : nullptr;
+  if (output == nullptr || output->GetMTime() < algo->GetMTime())
+  {
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+      "channel '%s': not converted during this execution.", channel_name.c_str());
+    return;
+  }
+
+  IngestionReport report(node);
+  report.AddDataObject(output);
+  report.Log(channel_name);
+}
+
+/**
+ * Nodes handed over to the producers of Blueprint mesh channels that set
+ * `state/unchanged`. Unlike the nodes passed to `catalyst_execute`, they
+ * remain valid between calls: see `persist_channel_node`. This lets a channel
+ * marked unchanged keep its producer, and everything downstream of it,
+ * untouched while the producer can still re-execute if a new request requires
+ * it.
+ */
+static std::map<std::string, conduit_cpp::Node>& get_channel_nodes()
+{
+  static std::map<std::string, conduit_cpp::Node> nodes;
+  return nodes;
+}
+
+/**
+ * Copies `src` in `dst`, except for the numeric arrays `src` references
+ * externally: `dst` references them too. The structure, the strings and the
+ * arrays owned by `src` do not outlive the `catalyst_execute` call they are
+ * passed to, while the external arrays are the simulation's memory.
+ */
+static void persist_channel_node(const conduit_cpp::Node& src, conduit_cpp::Node& dst)
+{
+  const auto dtype = src.dtype();
+  if (dtype.is_object() || dtype.is_list())
+  {
+    for (conduit_index_t cc = 0, max = src.number_of_children(); cc < max; ++cc)
+    {
+      const auto child = src.child(cc);
+      auto dst_child = dtype.is_list() ? dst.append() : dst[child.name()];
+      persist_channel_node(child, dst_child);
+    }
+  }
+  else if (dtype.is_number() && conduit_node_is_data_external(conduit_cpp::c_node(&src)))
+  {
+    dst.set_external(const_cast<conduit_cpp::Node&>(src));
+  }
+  else
+  {
+    dst.set(src);
+  }
+}
+
+/**
+ * Replaces the time, timestep and cycle arrays of the field data of the output
+ * of a channel's producer that is not re-executed. The new arrays are copies:
+ * the previous ones may reference the memory of the previous `fields` node.
+ */
+static void update_producer_global_fields(
+  const std::string& channel_name, const conduit_cpp::Node& fields)
+{
+  auto producer = vtkInSituInitializationHelper::GetProducer(channel_name);
+  auto algo = producer ? vtkAlgorithm::SafeDownCast(producer->GetClientSideObject()) : nullptr;
+  auto output = algo ? algo->GetOutputDataObject(0) : nullptr;
+  if (output == nullptr)
+  {
+    return;
+  }
+
+  auto fieldData = output->GetFieldData();
+  for (const char* name : { "time", "timestep", "cycle" })
+  {
+    auto current = vtkDataArray::SafeDownCast(fieldData->GetAbstractArray(name));
+    if (current == nullptr || !fields.has_child(name))
+    {
+      continue;
+    }
+    auto array = vtk::TakeSmartPointer(current->NewInstance());
+    array->SetName(name);
+    array->SetNumberOfTuples(1);
+    array->SetComponent(0, 0, fields[name].to_float64());
+    fieldData->AddArray(array);
+  }
+}
+
+/**
+ * Buffer the Catalyst calls are forwarded to when the in-transit mode is
+ * enabled with `catalyst/in_transit`; nullptr otherwise.
+ */
+static vtkSmartPointer<vtkCatalystInTransitBuffer>& get_in_transit_buffer()
+{
+  static vtkSmartPointer<vtkCatalystInTransitBuffer> buffer;
+  return buffer;
+}
+
+/**
+ * Creates the shared-memory buffer described by `catalyst/in_transit` and
+ * forwards the initialization parameters to the consumer process. No pipeline
+ * is set up in this process.
+ */
+static bool initialize_in_transit(const conduit_cpp::Node& params)
+{
+  const auto shm = params["catalyst/in_transit/shared_memory"];
+  std::string name = shm["name"].as_string();
+  const vtkTypeUInt64 slots = shm.has_child("slots") ? shm["slots"].to_int64() : 2;
+  const vtkTypeUInt64 slot_size =
+    shm.has_child("slot_size") ? shm["slot_size"].to_int64() : (256ull << 20);
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  // each rank feeds the matching rank of the consumer.
+  int isMPIInitialized = 0;
+  if (MPI_Initialized(&isMPIInitialized) == MPI_SUCCESS && isMPIInitialized)
+  {
+    MPI_Comm comm = params.has_path("catalyst/mpi_comm")
+      ? MPI_Comm_f2c(static_cast<MPI_Fint>(params["catalyst/mpi_comm"].to_int64()))
+      : MPI_COMM_WORLD;
+    int rank = 0;
+    int size = 1;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+    if (size > 1)
+    {
+      name += "." + std::to_string(rank);
+    }
+  }
+#endif
+
+  vtkNew<vtkCatalystInTransitBuffer> buffer;
+  if (!buffer->Create(name, slots, slot_size))
+  {
+    return false;
+  }
+  if (shm.has_child("timeout"))
+  {
+    buffer->SetTimeout(shm["timeout"].to_float64());
+  }
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "in-transit mode: forwarding to shared-memory segment '%s' (%llu slots of %llu bytes).",
+    name.c_str(), static_cast<unsigned long long>(buffer->GetNumberOfSlots()),
+    static_cast<unsigned long long>(buffer->GetSlotSize()));
+
+  // the consumer runs the pipelines in situ, on its own communicator.
+  conduit_cpp::Node forwarded;
+  forwarded.set(params);
+  auto catalyst = forwarded["catalyst"];
+  catalyst.remove("in_transit");
+  if (catalyst.has_child("mpi_comm"))
+  {
+    catalyst.remove("mpi_comm");
+  }
+  if (!buffer->Push(vtkCatalystInTransitBuffer::INITIALIZE, forwarded))
+  {
+    return false;
+  }
+  get_in_transit_buffer() = buffer;
+  return true;
+}
+
 static vtkSmartPointer<vtkInSituPipeline> create_precompiled_pipeline(const conduit_cpp::Node& node)
 {
   if (node["type"].as_string() == "io")
@@ -220,6 +589,7 @@ enum paraview_catalyst_status
 {
   paraview_catalyst_status_invalid_node = 100,
   paraview_catalyst_status_results = 101,
+  paraview_catalyst_status_in_transit = 102,
 };
 #define pvcatalyst_err(name) static_cast<enum catalyst_status>(paraview_catalyst_status_##name)
 
@@ -243,6 +613,11 @@ enum catalyst_status catalyst_initialize_paraview(const conduit_node* params)
     return pvcatalyst_err(invalid_node);
   }
 
+  if (cpp_params.has_path("catalyst/in_transit"))
+  {
+    return ::initialize_in_transit(cpp_params) ? catalyst_status_ok : pvcatalyst_err(in_transit);
+  }
+
 #if VTK_MODULE_ENABLE_VTK_ParallelMPI
   static_assert(sizeof(MPI_Fint) <= sizeof(vtkTypeUInt64),
     "MPI_Fint size is greater than 64bit! That is not supported.");
@@ -350,6 +725,15 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
     return pvcatalyst_err(invalid_node);
   }
 
+  if (auto buffer = get_in_transit_buffer())
+  {
+    // the node is verified by the consumer; only copy it here.
+    vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "publish to in-transit buffer");
+    return buffer->Push(vtkCatalystInTransitBuffer::EXECUTE, cpp_params)
+      ? catalyst_status_ok
+      : pvcatalyst_err(in_transit);
+  }
+
   const auto& root = cpp_params["catalyst"];
   if (!vtkCatalystBlueprint::Verify("execute", root))
   {
@@ -371,6 +755,7 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
     PARAVIEW_LOG_CATALYST_VERBOSITY(), "co-processing for timestep=%d, time=%f", timestep, time);
 
   conduit_cpp::Node globalFields;
+  std::vector<std::pair<std::string, conduit_node*>> meshChannels;
 
   // catalyst/channels are used to communicate meshes.
   if (root.has_child("channels"))
@@ -483,15 +868,59 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
       fields["channel"].set(channel_name);
       if (type == "mesh" || type == "multimesh" || type == "amrmesh")
       {
-        conduit_node* assembly = nullptr;
-        if (channel_node.has_path("assembly"))
+        // only channels of adaptors that use `state/unchanged` are copied to
+        // a persistent node; the others are converted from the node passed to
+        // this call, which is not used once it returns.
+        auto& persisted_nodes = get_channel_nodes();
+        const bool persist = channel_node.has_path("state/unchanged");
+        if (!persist)
+        {
+          persisted_nodes.erase(channel_name);
+        }
+
+        // the adaptor may mark a channel unchanged when its mesh and fields
+        // are the same, in the same memory, as in the previous call.
+        const bool unchanged = persist && channel_node["state/unchanged"].to_int() != 0 &&
+          persisted_nodes[channel_name].has_child("data");
+        if (unchanged)
+        {
+          vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+            "channel '%s' is unchanged; its producer is not modified.", channel_name.c_str());
+          auto persistent_fields = persisted_nodes[channel_name]["fields"];
+          persistent_fields.set(fields);
+          update_producer_global_fields(channel_name, persistent_fields);
+        }
+        else
         {
-          auto anode = channel_node["assembly"];
-          assembly = conduit_cpp::c_node(&anode);
+          conduit_node* mesh = conduit_cpp::c_node(&data_node);
+          conduit_node* mesh_fields = conduit_cpp::c_node(&fields);
+          conduit_node* assembly = nullptr;
+          if (persist)
+          {
+            auto& channel_nodes = persisted_nodes[channel_name];
+            channel_nodes.reset();
+            auto persistent_fields = channel_nodes["fields"];
+            persistent_fields.set(fields);
+            mesh_fields = conduit_cpp::c_node(&persistent_fields);
+            auto persistent_data = channel_nodes["data"];
+            persist_channel_node(data_node, persistent_data);
+            mesh = conduit_cpp::c_node(&persistent_data);
+            if (channel_node.has_path("assembly"))
+            {
+              auto anode = channel_nodes["assembly"];
+              anode.set(channel_node["assembly"]);
+              assembly = conduit_cpp::c_node(&anode);
+            }
+          }
+          else if (channel_node.has_path("assembly"))
+          {
+            auto anode = channel_node["assembly"];
+            assembly = conduit_cpp::c_node(&anode);
+          }
+          update_producer_mesh_blueprint(channel_name, mesh, mesh_fields, type == "multimesh",
+            assembly, channel_output_multiblock != 0, type == "amrmesh");
+          meshChannels.emplace_back(channel_name, conduit_cpp::c_node(&data_node));
         }
-        update_producer_mesh_blueprint(channel_name, conduit_cpp::c_node(&data_node),
-          conduit_cpp::c_node(&fields), type == "multimesh", assembly,
-          channel_output_multiblock != 0, type == "amrmesh");
       }
       else if (type == "ioss")
       {
@@ -519,6 +948,16 @@ enum catalyst_status catalyst_execute_paraview(const conduit_node* params)
 
   vtkInSituInitializationHelper::ExecutePipelines(params);
 
+  // Reports are only useful when Catalyst logging is enabled; avoid walking
+  // the nodes and arrays otherwise.
+  if (vtkLogger::GetCurrentVerbosityCutoff() >= PARAVIEW_LOG_CATALYST_VERBOSITY())
+  {
+    for (const auto& channel : meshChannels)
+    {
+      report_mesh_ingestion(channel.first, channel.second);
+    }
+  }
+
   return catalyst_status_ok;
 }
 
@@ -534,7 +973,19 @@ enum catalyst_status catalyst_finalize_paraview(const conduit_node* params)
     vtkLogF(ERROR, "invalid 'catalyst' node passed to 'catalyst_finalize'. Finalization may fail.");
   }
 
+  if (auto buffer = get_in_transit_buffer())
+  {
+    get_in_transit_buffer() = nullptr;
+    // wait for the consumer to pick everything up before removing the
+    // segment.
+    const bool forwarded =
+      buffer->Push(vtkCatalystInTransitBuffer::FINALIZE, cpp_params) && buffer->WaitUntilEmpty();
+    buffer->Close();
+    return forwarded ? catalyst_status_ok : pvcatalyst_err(in_transit);
+  }
+
   vtkInSituInitializationHelper::Finalize();
+  get_channel_nodes().clear();
 
   return catalyst_status_ok;
 }
@@ -545,6 +996,10 @@ enum catalyst_status catalyst_about_paraview(conduit_node* params)
   catalyst_stub_about(params);
   conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(params);
   cpp_params["catalyst"]["capabilities"].append().set("paraview");
+  if (vtkCatalystInTransitBuffer::IsSupported())
+  {
+    cpp_params["catalyst"]["capabilities"].append().set("in_transit");
+  }
   if (vtkInSituInitializationHelper::IsPythonSupported())
   {
     cpp_params["catalyst"]["capabilities"].append().set("python");
@@ -564,6 +1019,12 @@ enum catalyst_status catalyst_results_paraview(conduit_node* params)
     return stub_error_status;
   }
 
+  if (get_in_transit_buffer())
+  {
+    vtkLogF(WARNING, "'catalyst_results' is not supported in in-transit mode.");
+    return catalyst_status_ok;
+  }
+
   conduit_cpp::Node cpp_params = conduit_cpp::cpp_node(params);
   auto catalyst_node = cpp_params["catalyst"];
 
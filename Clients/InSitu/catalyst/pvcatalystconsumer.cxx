@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+/**
+ * pvcatalystconsumer runs the Catalyst analysis of a simulation using the
+ * ParaView Catalyst in-transit mode. It reads the `catalyst_initialize`,
+ * `catalyst_execute` and `catalyst_finalize` calls the simulation publishes in
+ * a shared-memory segment and replays them, in situ, in this process.
+ *
+ * Usage:
+ *
+ *    pvcatalystconsumer --name <segment> [--timeout <seconds>]
+ *      [--implementation-path <dir>]
+ *
+ * `<segment>` is the value of `catalyst/in_transit/shared_memory/name` given
+ * to the simulation. When running with MPI, rank `r` of the consumer reads the
+ * segment of rank `r` of the simulation.
+ */
+
+#include <catalyst.h>
+#include <catalyst_conduit.hpp>
+
+#include "vtkCatalystInTransitBuffer.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPI.h"
+#endif
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace
+{
+void print_usage(const char* exe)
+{
+  std::cerr << "Usage: " << exe
+            << " --name <segment> [--timeout <seconds>] [--implementation-path <dir>]"
+            << std::endl;
+}
+}
+
+int main(int argc, char* argv[])
+{
+  // consumes the `-v` verbosity options.
+  vtkLogger::Init(argc, argv);
+
+  std::string name;
+  std::string implementation_path;
+  double timeout = 60;
+  for (int cc = 1; cc < argc; ++cc)
+  {
+    if (std::strcmp(argv[cc], "--name") == 0 && cc + 1 < argc)
+    {
+      name = argv[++cc];
+    }
+    else if (std::strcmp(argv[cc], "--timeout") == 0 && cc + 1 < argc)
+    {
+      timeout = std::atof(argv[++cc]);
+    }
+    else if (std::strcmp(argv[cc], "--implementation-path") == 0 && cc + 1 < argc)
+    {
+      implementation_path = argv[++cc];
+    }
+    else
+    {
+      print_usage(argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (name.empty())
+  {
+    print_usage(argv[0]);
+    return EXIT_FAILURE;
+  }
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  MPI_Init(&argc, &argv);
+  int rank = 0;
+  int size = 1;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+  if (size > 1)
+  {
+    name += "." + std::to_string(rank);
+  }
+#endif
+
+  vtkNew<vtkCatalystInTransitBuffer> buffer;
+  bool success = buffer->Open(name, timeout);
+  bool done = !success;
+  while (!done)
+  {
+    vtkCatalystInTransitBuffer::MessageKind kind;
+    conduit_cpp::Node node;
+    if (!buffer->Pop(kind, node))
+    {
+      success = false;
+      break;
+    }
+
+    enum catalyst_status status = catalyst_status_ok;
+    switch (kind)
+    {
+      case vtkCatalystInTransitBuffer::INITIALIZE:
+        // run the analysis in this process with the ParaView implementation.
+        if (!node.has_path("catalyst_load/implementation"))
+        {
+          node["catalyst_load/implementation"] = "paraview";
+        }
+        if (!implementation_path.empty())
+        {
+          node["catalyst_load/search_paths/paraview"].set(implementation_path);
+        }
+        status = catalyst_initialize(conduit_cpp::c_node(&node));
+        break;
+
+      case vtkCatalystInTransitBuffer::EXECUTE:
+        status = catalyst_execute(conduit_cpp::c_node(&node));
+        break;
+
+      case vtkCatalystInTransitBuffer::FINALIZE:
+        status = catalyst_finalize(conduit_cpp::c_node(&node));
+        done = true;
+        break;
+
+      default:
+        vtkLogF(ERROR, "unknown message kind %d.", static_cast<int>(kind));
+        success = false;
+        continue;
+    }
+
+    if (status != catalyst_status_ok)
+    {
+      vtkLogF(ERROR, "Catalyst call failed with status %d.", static_cast<int>(status));
+      success = false;
+    }
+  }
+  buffer->Close();
+
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  MPI_Finalize();
+#endif
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -201,6 +201,41 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
 }
 } // namespace pipelines
 
+namespace in_transit
+{
+bool verify(const std::string& protocol, const conduit_cpp::Node& n)
+{
+  vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "%s: verify", protocol.c_str());
+  if (!n.dtype().is_object() || !n.has_child("shared_memory"))
+  {
+    vtkLogF(ERROR, "node must be an 'object' with a 'shared_memory' child.");
+    return false;
+  }
+
+  const auto shm = n["shared_memory"];
+  if (!shm.has_child("name") || !shm["name"].dtype().is_string())
+  {
+    vtkLogF(ERROR, "missing 'shared_memory/name' or not of type 'string'.");
+    return false;
+  }
+  for (const char* key : { "slots", "slot_size" })
+  {
+    if (shm.has_child(key) && (!shm[key].dtype().is_integer() || shm[key].to_int64() <= 0))
+    {
+      vtkLogF(ERROR, "'shared_memory/%s' must be a positive integer.", key);
+      return false;
+    }
+  }
+  if (shm.has_child("timeout") &&
+    (!shm["timeout"].dtype().is_number() || shm["timeout"].to_float64() <= 0))
+  {
+    vtkLogF(ERROR, "'shared_memory/timeout' must be a positive number.");
+    return false;
+  }
+  return true;
+}
+} // namespace in_transit
+
 bool verify(const std::string& protocol, const conduit_cpp::Node& n)
 {
   vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "%s: verify", protocol.c_str());
@@ -240,6 +275,13 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
       return false;
     }
   }
+  if (n.has_child("in_transit"))
+  {
+    if (!in_transit::verify(protocol + "::in_transit", n["in_transit"]))
+    {
+      return false;
+    }
+  }
   return true;
 }
 
@@ -455,6 +497,19 @@ bool verify(const std::string& protocol, const conduit_cpp::Node& n)
     vtkLogF(ERROR, "unsupported channel type '%s' specified.", type.c_str());
     return false;
   }
+
+  if (n.has_path("state/unchanged"))
+  {
+    if (!n["state/unchanged"].dtype().is_integer())
+    {
+      vtkLogF(ERROR, "'state/unchanged' must be an integral.");
+      return false;
+    }
+    else if (type != "mesh" && type != "multimesh" && type != "amrmesh")
+    {
+      vtkLogF(WARNING, "'state/unchanged' is ignored for channels of type '%s'.", type.c_str());
+    }
+  }
   return true;
 }
 }
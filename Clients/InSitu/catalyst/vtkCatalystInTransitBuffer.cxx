@@ -0,0 +1,574 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCatalystInTransitBuffer.h"
+
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVSharedMemoryChannel.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+//============================================================================
+// Serialized form of a conduit node. Every record starts on an 8-byte
+// boundary so that numeric arrays are aligned in the slots.
+//============================================================================
+enum NodeKind : vtkTypeUInt32
+{
+  KIND_EMPTY = 0,
+  KIND_OBJECT = 1,
+  KIND_LIST = 2,
+  KIND_STRING = 3,
+  KIND_NUMBER = 4
+};
+
+enum NumberType : vtkTypeUInt32
+{
+  TYPE_INT8 = 0,
+  TYPE_INT16,
+  TYPE_INT32,
+  TYPE_INT64,
+  TYPE_UINT8,
+  TYPE_UINT16,
+  TYPE_UINT32,
+  TYPE_UINT64,
+  TYPE_FLOAT32,
+  TYPE_FLOAT64
+};
+
+struct NodeRecord
+{
+  vtkTypeUInt32 Kind;
+  vtkTypeUInt32 NameLength;
+  // number of children, string length or number of elements.
+  vtkTypeUInt64 Size;
+  // NumberType for KIND_NUMBER.
+  vtkTypeUInt64 Type;
+};
+
+size_t padded(size_t size)
+{
+  return (size + 7) & ~static_cast<size_t>(7);
+}
+
+bool get_number_type(const conduit_cpp::DataType& dtype, vtkTypeUInt32& type, size_t& bytes)
+{
+  if (dtype.is_int8())
+  {
+    type = TYPE_INT8;
+    bytes = sizeof(conduit_int8);
+  }
+  else if (dtype.is_int16())
+  {
+    type = TYPE_INT16;
+    bytes = sizeof(conduit_int16);
+  }
+  else if (dtype.is_int32())
+  {
+    type = TYPE_INT32;
+    bytes = sizeof(conduit_int32);
+  }
+  else if (dtype.is_int64())
+  {
+    type = TYPE_INT64;
+    bytes = sizeof(conduit_int64);
+  }
+  else if (dtype.is_uint8())
+  {
+    type = TYPE_UINT8;
+    bytes = sizeof(conduit_uint8);
+  }
+  else if (dtype.is_uint16())
+  {
+    type = TYPE_UINT16;
+    bytes = sizeof(conduit_uint16);
+  }
+  else if (dtype.is_uint32())
+  {
+    type = TYPE_UINT32;
+    bytes = sizeof(conduit_uint32);
+  }
+  else if (dtype.is_uint64())
+  {
+    type = TYPE_UINT64;
+    bytes = sizeof(conduit_uint64);
+  }
+  else if (dtype.is_float32())
+  {
+    type = TYPE_FLOAT32;
+    bytes = sizeof(conduit_float32);
+  }
+  else if (dtype.is_float64())
+  {
+    type = TYPE_FLOAT64;
+    bytes = sizeof(conduit_float64);
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+NodeKind get_kind(const conduit_cpp::Node& node)
+{
+  const auto dtype = node.dtype();
+  if (dtype.is_object())
+  {
+    return KIND_OBJECT;
+  }
+  if (dtype.is_list())
+  {
+    return KIND_LIST;
+  }
+  if (dtype.is_string())
+  {
+    return KIND_STRING;
+  }
+  if (dtype.is_number())
+  {
+    return KIND_NUMBER;
+  }
+  return KIND_EMPTY;
+}
+
+size_t serialized_size(const conduit_cpp::Node& node)
+{
+  size_t size = sizeof(NodeRecord) + padded(node.name().size());
+  switch (get_kind(node))
+  {
+    case KIND_OBJECT:
+    case KIND_LIST:
+      for (conduit_index_t cc = 0, max = node.number_of_children(); cc < max; ++cc)
+      {
+        size += serialized_size(node.child(cc));
+      }
+      break;
+
+    case KIND_STRING:
+      size += padded(node.as_string().size());
+      break;
+
+    case KIND_NUMBER:
+    {
+      vtkTypeUInt32 type;
+      size_t bytes;
+      if (get_number_type(node.dtype(), type, bytes))
+      {
+        size += padded(bytes * static_cast<size_t>(node.dtype().number_of_elements()));
+      }
+      break;
+    }
+
+    default:
+      break;
+  }
+  return size;
+}
+
+char* serialize(const conduit_cpp::Node& node, char* out)
+{
+  const std::string name = node.name();
+  auto record = reinterpret_cast<NodeRecord*>(out);
+  record->Kind = get_kind(node);
+  record->NameLength = static_cast<vtkTypeUInt32>(name.size());
+  record->Size = 0;
+  record->Type = 0;
+  out += sizeof(NodeRecord);
+  std::copy(name.begin(), name.end(), out);
+  out += padded(name.size());
+
+  switch (record->Kind)
+  {
+    case KIND_OBJECT:
+    case KIND_LIST:
+      record->Size = static_cast<vtkTypeUInt64>(node.number_of_children());
+      for (conduit_index_t cc = 0, max = node.number_of_children(); cc < max; ++cc)
+      {
+        out = serialize(node.child(cc), out);
+      }
+      break;
+
+    case KIND_STRING:
+    {
+      const std::string value = node.as_string();
+      record->Size = value.size();
+      std::copy(value.begin(), value.end(), out);
+      out += padded(value.size());
+      break;
+    }
+
+    case KIND_NUMBER:
+    {
+      const auto dtype = node.dtype();
+      vtkTypeUInt32 type;
+      size_t bytes;
+      if (!get_number_type(dtype, type, bytes))
+      {
+        // unsupported number types are sent as empty nodes.
+        record->Kind = KIND_EMPTY;
+        break;
+      }
+      const auto count = static_cast<size_t>(dtype.number_of_elements());
+      record->Size = count;
+      record->Type = type;
+      if (count > 0 && static_cast<size_t>(dtype.stride()) == bytes)
+      {
+        std::memcpy(out, node.element_ptr(0), count * bytes);
+      }
+      else
+      {
+        for (size_t cc = 0; cc < count; ++cc)
+        {
+          std::memcpy(
+            out + cc * bytes, node.element_ptr(static_cast<conduit_index_t>(cc)), bytes);
+        }
+      }
+      out += padded(count * bytes);
+      break;
+    }
+
+    default:
+      break;
+  }
+  return out;
+}
+
+const char* read_record(
+  const char* in, const char* end, const NodeRecord*& record, std::string& name)
+{
+  if (in == nullptr || end - in < static_cast<std::ptrdiff_t>(sizeof(NodeRecord)))
+  {
+    return nullptr;
+  }
+  record = reinterpret_cast<const NodeRecord*>(in);
+  in += sizeof(NodeRecord);
+  if (end - in < static_cast<std::ptrdiff_t>(padded(record->NameLength)))
+  {
+    return nullptr;
+  }
+  name.assign(in, record->NameLength);
+  return in + padded(record->NameLength);
+}
+
+template <typename T>
+const char* set_values(conduit_cpp::Node& node, const char* in, size_t count)
+{
+  node.set(reinterpret_cast<const T*>(in), count);
+  return in + padded(count * sizeof(T));
+}
+
+const char* read_content(
+  const NodeRecord& record, const char* in, const char* end, conduit_cpp::Node& node)
+{
+  switch (record.Kind)
+  {
+    case KIND_OBJECT:
+    case KIND_LIST:
+      for (vtkTypeUInt64 cc = 0; cc < record.Size && in != nullptr; ++cc)
+      {
+        const NodeRecord* child_record = nullptr;
+        std::string name;
+        in = read_record(in, end, child_record, name);
+        if (in != nullptr)
+        {
+          auto child = record.Kind == KIND_LIST ? node.append() : node[name];
+          in = read_content(*child_record, in, end, child);
+        }
+      }
+      return in;
+
+    case KIND_STRING:
+      if (end - in < static_cast<std::ptrdiff_t>(padded(record.Size)))
+      {
+        return nullptr;
+      }
+      node.set(std::string(in, static_cast<size_t>(record.Size)));
+      return in + padded(record.Size);
+
+    case KIND_NUMBER:
+    {
+      const auto count = static_cast<size_t>(record.Size);
+      static const size_t sizes[] = { 1, 2, 4, 8, 1, 2, 4, 8, 4, 8 };
+      if (record.Type > TYPE_FLOAT64 ||
+        end - in < static_cast<std::ptrdiff_t>(padded(count * sizes[record.Type])))
+      {
+        return nullptr;
+      }
+      switch (record.Type)
+      {
+        case TYPE_INT8:
+          return set_values<conduit_int8>(node, in, count);
+        case TYPE_INT16:
+          return set_values<conduit_int16>(node, in, count);
+        case TYPE_INT32:
+          return set_values<conduit_int32>(node, in, count);
+        case TYPE_INT64:
+          return set_values<conduit_int64>(node, in, count);
+        case TYPE_UINT8:
+          return set_values<conduit_uint8>(node, in, count);
+        case TYPE_UINT16:
+          return set_values<conduit_uint16>(node, in, count);
+        case TYPE_UINT32:
+          return set_values<conduit_uint32>(node, in, count);
+        case TYPE_UINT64:
+          return set_values<conduit_uint64>(node, in, count);
+        case TYPE_FLOAT32:
+          return set_values<conduit_float32>(node, in, count);
+        default:
+          return set_values<conduit_float64>(node, in, count);
+      }
+    }
+
+    default:
+      return in;
+  }
+}
+
+//============================================================================
+// The messages go through the ring buffer of a vtkPVSharedMemoryChannel
+// created by the producer, of `NumberOfSlots * SlotSize` bytes. Each message
+// takes a whole slot, which never wraps around the end of the ring buffer: a
+// SlotHeader followed by the serialized node.
+//============================================================================
+constexpr size_t SlotAlignment = 64;
+
+size_t aligned(size_t size)
+{
+  return (size + SlotAlignment - 1) & ~(SlotAlignment - 1);
+}
+
+struct SlotHeader
+{
+  vtkTypeUInt64 Kind;
+  vtkTypeUInt64 Size;
+  vtkTypeUInt64 SlotSize;
+};
+}
+
+class vtkCatalystInTransitBuffer::vtkInternals
+{
+public:
+  vtkNew<vtkPVSharedMemoryChannel> Channel;
+  bool Owner = false;
+  // known to the consumer once it read a message.
+  vtkTypeUInt64 SlotSize = 0;
+};
+
+vtkStandardNewMacro(vtkCatalystInTransitBuffer);
+//----------------------------------------------------------------------------
+vtkCatalystInTransitBuffer::vtkCatalystInTransitBuffer()
+  : Internals(new vtkCatalystInTransitBuffer::vtkInternals())
+{
+  this->Internals->Channel->SetTimeout(60.0);
+}
+
+//----------------------------------------------------------------------------
+vtkCatalystInTransitBuffer::~vtkCatalystInTransitBuffer()
+{
+  this->Close();
+}
+
+//----------------------------------------------------------------------------
+bool vtkCatalystInTransitBuffer::IsSupported()
+{
+  return vtkPVSharedMemoryChannel::IsSupported();
+}
+
+//----------------------------------------------------------------------------
+bool vtkCatalystInTransitBuffer::Create(
+  const std::string& name, vtkTypeUInt64 numberOfSlots, vtkTypeUInt64 slotSize)
+{
+  this->Close();
+  if (!vtkCatalystInTransitBuffer::IsSupported())
+  {
+    vtkLogF(ERROR, "shared-memory in-transit buffers are not supported on this platform.");
+    return false;
+  }
+  if (numberOfSlots == 0 || slotSize <= sizeof(SlotHeader))
+  {
+    vtkLogF(ERROR, "invalid in-transit buffer geometry (%llu slots of %llu bytes).",
+      static_cast<unsigned long long>(numberOfSlots), static_cast<unsigned long long>(slotSize));
+    return false;
+  }
+
+  // the consumer does not send anything back.
+  auto& internals = *this->Internals;
+  slotSize = aligned(slotSize);
+  if (!internals.Channel->Create(name, numberOfSlots * slotSize, 0))
+  {
+    vtkLogF(ERROR, "failed to create shared-memory segment '%s'.", name.c_str());
+    return false;
+  }
+  internals.Owner = true;
+  internals.SlotSize = slotSize;
+  vtkVLogF(vtkLogger::VERBOSITY_TRACE, "created shared-memory segment '%s' (%llu x %llu bytes).",
+    name.c_str(), static_cast<unsigned long long>(numberOfSlots),
+    static_cast<unsigned long long>(slotSize));
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkCatalystInTransitBuffer::Open(const std::string& name, double timeout)
+{
+  this->Close();
+  if (!vtkCatalystInTransitBuffer::IsSupported())
+  {
+    vtkLogF(ERROR, "shared-memory in-transit buffers are not supported on this platform.");
+    return false;
+  }
+  return this->Internals->Channel->WaitAndOpen(name, timeout);
+}
+
+//----------------------------------------------------------------------------
+void vtkCatalystInTransitBuffer::Close()
+{
+  auto& internals = *this->Internals;
+  // the producer's channel unlinks the segment; processes that mapped it keep
+  // their mapping.
+  internals.Channel->Close();
+  internals.Owner = false;
+  internals.SlotSize = 0;
+}
+
+//----------------------------------------------------------------------------
+bool vtkCatalystInTransitBuffer::IsOpen() const
+{
+  return this->Internals->Channel->IsOpen();
+}
+
+//----------------------------------------------------------------------------
+bool vtkCatalystInTransitBuffer::Push(MessageKind kind, const conduit_cpp::Node& node)
+{
+  auto& internals = *this->Internals;
+  if (!this->IsOpen() || !internals.Owner)
+  {
+    vtkLogF(ERROR, "no shared-memory segment created.");
+    return false;
+  }
+
+  const size_t size = serialized_size(node);
+  if (sizeof(SlotHeader) + size > internals.SlotSize)
+  {
+    vtkLogF(ERROR,
+      "message of %llu bytes does not fit in a %llu bytes slot of '%s'; increase the slot size.",
+      static_cast<unsigned long long>(size),
+      static_cast<unsigned long long>(internals.SlotSize),
+      internals.Channel->GetName().c_str());
+    return false;
+  }
+
+  // waits for a free slot; the consumer does not read it before `EndWrite()`,
+  // so it is filled in place.
+  vtkVLogScopeF(vtkLogger::VERBOSITY_TRACE, "push to '%s'", internals.Channel->GetName().c_str());
+  const auto slotSize = static_cast<size_t>(internals.SlotSize);
+  auto slot = static_cast<SlotHeader*>(internals.Channel->BeginWrite(slotSize));
+  if (slot == nullptr)
+  {
+    return false;
+  }
+  slot->Kind = kind;
+  slot->Size = size;
+  slot->SlotSize = internals.SlotSize;
+  serialize(node, reinterpret_cast<char*>(slot + 1));
+  internals.Channel->EndWrite(slotSize);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkCatalystInTransitBuffer::Pop(MessageKind& kind, conduit_cpp::Node& node)
+{
+  auto& internals = *this->Internals;
+  if (!this->IsOpen() || internals.Owner)
+  {
+    vtkLogF(ERROR, "no shared-memory segment opened.");
+    return false;
+  }
+
+  // the simulation may compute for a long time between two messages: the
+  // channel only gives up once it is gone. The producer makes a whole slot
+  // available at once, so the slot is complete once its header is.
+  auto slot = static_cast<const SlotHeader*>(internals.Channel->BeginRead(sizeof(SlotHeader)));
+  if (slot == nullptr)
+  {
+    return false;
+  }
+  const vtkTypeUInt64 slotSize = slot->SlotSize;
+  if (slotSize < sizeof(SlotHeader) + slot->Size ||
+    internals.Channel->BeginRead(static_cast<size_t>(slotSize)) != slot)
+  {
+    vtkLogF(ERROR, "corrupted message in shared-memory segment '%s'.",
+      internals.Channel->GetName().c_str());
+    return false;
+  }
+  internals.SlotSize = slotSize;
+
+  // the message is copied in `node` so that the slot is released before the
+  // (possibly long) analysis runs, and so that `node` can be kept, e.g. for
+  // channels marked unchanged in the next messages.
+  kind = static_cast<MessageKind>(slot->Kind);
+  node.reset();
+  const char* in = reinterpret_cast<const char*>(slot + 1);
+  const char* end = in + slot->Size;
+  const NodeRecord* record = nullptr;
+  std::string name;
+  in = read_record(in, end, record, name);
+  const bool valid = in != nullptr && read_content(*record, in, end, node) != nullptr;
+  internals.Channel->EndRead(static_cast<size_t>(slotSize));
+
+  if (!valid)
+  {
+    vtkLogF(ERROR, "corrupted message in shared-memory segment '%s'.",
+      internals.Channel->GetName().c_str());
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkCatalystInTransitBuffer::WaitUntilEmpty()
+{
+  auto& internals = *this->Internals;
+  return this->IsOpen() && internals.Owner && internals.Channel->WaitUntilRead();
+}
+
+//----------------------------------------------------------------------------
+void vtkCatalystInTransitBuffer::SetTimeout(double timeout)
+{
+  this->Internals->Channel->SetTimeout(timeout);
+}
+
+//----------------------------------------------------------------------------
+double vtkCatalystInTransitBuffer::GetTimeout() const
+{
+  return this->Internals->Channel->GetTimeout();
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkCatalystInTransitBuffer::GetNumberOfSlots() const
+{
+  auto& internals = *this->Internals;
+  return internals.SlotSize > 0
+    ? internals.Channel->GetBufferSize(internals.Owner) / internals.SlotSize
+    : 0;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkCatalystInTransitBuffer::GetSlotSize() const
+{
+  return this->Internals->SlotSize;
+}
+
+//----------------------------------------------------------------------------
+void vtkCatalystInTransitBuffer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Name: " << this->Internals->Channel->GetName() << endl;
+  os << indent << "Owner: " << this->Internals->Owner << endl;
+  os << indent << "Timeout: " << this->GetTimeout() << endl;
+  os << indent << "NumberOfSlots: " << this->GetNumberOfSlots() << endl;
+  os << indent << "SlotSize: " << this->GetSlotSize() << endl;
+}
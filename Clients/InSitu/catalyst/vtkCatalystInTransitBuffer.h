@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkCatalystInTransitBuffer
+ * @brief shared-memory ring buffer carrying Catalyst calls to another process
+ *
+ * vtkCatalystInTransitBuffer is used by ParaView Catalyst in-transit mode to
+ * hand the Conduit nodes passed to `catalyst_initialize`, `catalyst_execute`
+ * and `catalyst_finalize` over to a consumer process running on the same
+ * node (see `pvcatalystconsumer`).
+ *
+ * The simulation side calls `Create()` to create a vtkPVSharedMemoryChannel
+ * whose ring buffer is split in a fixed number of slots of fixed size. `Push()` serializes
+ * a node directly into the next free slot and returns as soon as the copy is
+ * done; it only blocks when all slots hold messages the consumer has not read
+ * yet. The consumer side calls `Open()` and `Pop()` to read the messages in
+ * order.
+ *
+ * Neither side waits for a process that is gone: the calls fail once the
+ * other process closed the segment or died, or, on the simulation side, when
+ * no consumer opened the segment within `Timeout` seconds.
+ *
+ * The serialized form uses the native byte order and type sizes; both
+ * processes are expected to run on the same machine. Only supported on Linux.
+ */
+
+#ifndef vtkCatalystInTransitBuffer_h
+#define vtkCatalystInTransitBuffer_h
+
+#include "vtkObject.h"
+
+#include <catalyst_conduit.hpp> // for conduit_cpp::Node
+
+#include <memory> // for std::unique_ptr
+#include <string> // for std::string
+
+class vtkCatalystInTransitBuffer : public vtkObject
+{
+public:
+  static vtkCatalystInTransitBuffer* New();
+  vtkTypeMacro(vtkCatalystInTransitBuffer, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Kind of Catalyst call a message corresponds to.
+   */
+  enum MessageKind
+  {
+    INITIALIZE = 1,
+    EXECUTE = 2,
+    FINALIZE = 3
+  };
+
+  /**
+   * Returns true if shared-memory buffers are supported on this platform.
+   */
+  static bool IsSupported();
+
+  /**
+   * Creates the shared-memory segment `name` (e.g. "/catalyst") with
+   * `numberOfSlots` slots able to hold a serialized node of up to `slotSize`
+   * bytes each. A stale segment with the same name is replaced. Fails if the
+   * memory of the segment cannot be reserved. The segment is unlinked on
+   * `Close()`.
+   */
+  bool Create(const std::string& name, vtkTypeUInt64 numberOfSlots, vtkTypeUInt64 slotSize);
+
+  /**
+   * Opens a segment created by `Create()` in another process, waiting up to
+   * `timeout` seconds for it to be created.
+   */
+  bool Open(const std::string& name, double timeout);
+
+  /**
+   * Releases the segment. Does nothing if none is open.
+   */
+  void Close();
+
+  /**
+   * Returns true if a segment is open.
+   */
+  bool IsOpen() const;
+
+  /**
+   * Serializes `node` in the next free slot, waiting for the consumer to free
+   * one if needed. Fails if the serialized node does not fit in a slot or if
+   * the consumer is gone.
+   */
+  bool Push(MessageKind kind, const conduit_cpp::Node& node);
+
+  /**
+   * Waits for the next message and fills `node` with a copy of it. Fails if
+   * the producer is gone and every message has been read.
+   */
+  bool Pop(MessageKind& kind, conduit_cpp::Node& node);
+
+  /**
+   * Waits until the consumer has read every message pushed so far. Fails if
+   * the consumer is gone.
+   */
+  bool WaitUntilEmpty();
+
+  ///@{
+  /**
+   * Maximum time, in seconds, `Push()` and `WaitUntilEmpty()` wait for a
+   * consumer that has not opened the segment yet. Defaults to 60.
+   */
+  void SetTimeout(double timeout);
+  double GetTimeout() const;
+  ///@}
+
+  ///@{
+  /**
+   * Geometry of the open segment. The consumer only knows it once it read a
+   * message.
+   */
+  vtkTypeUInt64 GetNumberOfSlots() const;
+  vtkTypeUInt64 GetSlotSize() const;
+  ///@}
+
+protected:
+  vtkCatalystInTransitBuffer();
+  ~vtkCatalystInTransitBuffer() override;
+
+private:
+  vtkCatalystInTransitBuffer(const vtkCatalystInTransitBuffer&) = delete;
+  void operator=(const vtkCatalystInTransitBuffer&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
@@ -30,10 +30,12 @@
 #include "vtkSMSourceProxy.h"
 #include "vtkSmartPointer.h"
 #include "vtkSteeringDataGenerator.h"
+#include "vtksys/SystemInformation.hxx"
 #include "vtksys/SystemTools.hxx"
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <map>
 #include <set>
 #include <string>
@@ -78,6 +80,11 @@ public:
   bool InResultsPipelines = false;
   int TimeStep = 0;
   double Time = 0.0;
+  // used to account for the cost of each pipeline and the time spent in the
+  // simulation between two calls to `ExecutePipelines`.
+  vtksys::SystemInformation SystemInformation;
+  bool HasExecuted = false;
+  std::chrono::steady_clock::time_point LastExecutionEnd;
 #if VTK_MODULE_ENABLE_VTK_IOCatalystConduit
   // pointer arguments of the current catalyst call
   conduit_node* catalyst_params = nullptr;
@@ -213,6 +220,11 @@ void vtkInSituInitializationHelper::Finalize()
     if (item.Initialized && !item.InitializationFailed)
     {
       item.Pipeline->Finalize();
+      vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+        "pipeline '%s': %d executions, %.3f s in total, up to %lld KiB",
+        item.Pipeline->GetName() ? item.Pipeline->GetName() : "(unnamed)",
+        item.Pipeline->GetNumberOfExecutions(), item.Pipeline->GetTotalExecutionTime(),
+        static_cast<long long>(item.Pipeline->GetMaximumExecutionMemory()));
     }
   }
 
@@ -459,6 +471,12 @@ bool vtkInSituInitializationHelper::ExecutePipelines(int timestep, double time,
   internals.TimeStep = timestep;
   internals.Time = time;
 
+  using clock = std::chrono::steady_clock;
+  const auto executionStart = clock::now();
+  const double solverTime = internals.HasExecuted
+    ? std::chrono::duration<double>(executionStart - internals.LastExecutionEnd).count()
+    : 0.0;
+
   UpdateSteerableProxies();
 
   std::set<std::string> toExecute;
@@ -491,10 +509,25 @@ bool vtkInSituInitializationHelper::ExecutePipelines(int timestep, double time,
       // If `Initialize` failed, don't call `Execute` on the Pipeline.
       // If Execute fails even once, we no longer call Execute on this pipeline
       // in subsequent calls to `ExecutePipelines`.
+      const auto start = clock::now();
+      const auto memory = internals.SystemInformation.GetProcMemoryUsed();
       item.ExecuteFailed = !item.Pipeline->Execute(timestep, time);
+      const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+      item.Pipeline->AddExecutionCost(seconds,
+        static_cast<vtkTypeInt64>(internals.SystemInformation.GetProcMemoryUsed() - memory));
+      vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+        "pipeline '%s': %.3f s (%.1f%% of the %.3f s spent in the simulation since the previous "
+        "cycle), %lld KiB",
+        item.Pipeline->GetName() ? item.Pipeline->GetName() : "(unnamed)", seconds,
+        solverTime > 0 ? 100.0 * seconds / solverTime : 0.0, solverTime,
+        static_cast<long long>(item.Pipeline->GetLastExecutionMemory()));
     }
   }
 
+  internals.HasExecuted = true;
+  internals.LastExecutionEnd = clock::now();
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "all pipelines: %.3f s",
+    std::chrono::duration<double>(internals.LastExecutionEnd - executionStart).count());
   internals.InExecutePipelines = false;
   return true;
 }
@@ -4,6 +4,8 @@
 
 #include "vtkObjectFactory.h"
 
+#include <algorithm>
+
 //----------------------------------------------------------------------------
 vtkInSituPipeline::vtkInSituPipeline()
 {
@@ -16,8 +18,24 @@ vtkInSituPipeline::~vtkInSituPipeline()
   delete[] this->Name;
 }
 
+//----------------------------------------------------------------------------
+void vtkInSituPipeline::AddExecutionCost(double seconds, vtkTypeInt64 memory)
+{
+  ++this->NumberOfExecutions;
+  this->LastExecutionTime = seconds;
+  this->TotalExecutionTime += seconds;
+  this->LastExecutionMemory = memory;
+  this->MaximumExecutionMemory = std::max(this->MaximumExecutionMemory, memory);
+}
+
 //----------------------------------------------------------------------------
 void vtkInSituPipeline::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "Name: " << (this->Name ? this->Name : "(nullptr)") << endl;
+  os << indent << "NumberOfExecutions: " << this->NumberOfExecutions << endl;
+  os << indent << "LastExecutionTime: " << this->LastExecutionTime << endl;
+  os << indent << "TotalExecutionTime: " << this->TotalExecutionTime << endl;
+  os << indent << "LastExecutionMemory: " << this->LastExecutionMemory << endl;
+  os << indent << "MaximumExecutionMemory: " << this->MaximumExecutionMemory << endl;
 }
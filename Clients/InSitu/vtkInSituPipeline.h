@@ -64,11 +64,36 @@ public:
   vtkGetStringMacro(Name);
   vtkSetStringMacro(Name);
 
+  ///@{
+  /**
+   * Cost of the calls to `Execute` so far, as measured by
+   * vtkInSituInitializationHelper: number of calls, wall-clock time in seconds
+   * of the last call and of all calls, and change in the resident memory of
+   * the process, in KiB, during the last call and the largest such change.
+   */
+  vtkGetMacro(NumberOfExecutions, int);
+  vtkGetMacro(LastExecutionTime, double);
+  vtkGetMacro(TotalExecutionTime, double);
+  vtkGetMacro(LastExecutionMemory, vtkTypeInt64);
+  vtkGetMacro(MaximumExecutionMemory, vtkTypeInt64);
+  ///@}
+
+  /**
+   * Called by vtkInSituInitializationHelper after each call to `Execute` to
+   * account for its cost.
+   */
+  void AddExecutionCost(double seconds, vtkTypeInt64 memory);
+
 protected:
   vtkInSituPipeline();
   ~vtkInSituPipeline() override;
 
   char* Name;
+  int NumberOfExecutions = 0;
+  double LastExecutionTime = 0.0;
+  double TotalExecutionTime = 0.0;
+  vtkTypeInt64 LastExecutionMemory = 0;
+  vtkTypeInt64 MaximumExecutionMemory = 0;
 
 private:
   vtkInSituPipeline(const vtkInSituPipeline&) = delete;
@@ -0,0 +1,102 @@
+from paraview import servermanager
+import paraview.simple as smp
+
+
+# Make sure the test driver know that process has properly started
+print ("Process started")
+
+
+def getHost(url):
+   return url.split(':')[1][2:]
+
+
+def getPort(url):
+   return int(url.split(':')[2])
+
+
+def numberOfSphereCells(theta, phi):
+    return 2 * theta * (phi - 2)
+
+
+def runTest():
+
+    options = servermanager.vtkRemotingCoreConfiguration.GetInstance()
+    url = options.GetServerURL()
+
+    smp.Connect(getHost(url), getPort(url))
+    session = servermanager.ActiveConnection.Session
+    assert session.IsA("vtkSMSessionClient")
+
+    sphere = smp.Sphere(ThetaResolution=8, PhiResolution=8)
+    sphere.UpdatePipeline()
+
+    # without a batch, each update is sent on its own.
+    pushes = session.GetNumberOfPushMessages()
+    batches = session.GetNumberOfPushBatchMessages()
+    sphere.ThetaResolution = 10
+    assert session.GetNumberOfPushMessages() == pushes + 1
+    assert session.GetNumberOfPushBatchMessages() == batches
+
+    # successive updates of the same proxy are folded into a single state, sent
+    # as one PUSH_BATCH message when the batch ends.
+    pushes = session.GetNumberOfPushMessages()
+    with servermanager.PushBatch():
+        sphere.ThetaResolution = 20
+        sphere.PhiResolution = 12
+        sphere.ThetaResolution = 30
+        assert session.GetNumberOfPendingPushes() == 1
+        assert session.GetNumberOfPushBatchMessages() == batches
+    assert session.GetNumberOfPendingPushes() == 0
+    assert session.GetNumberOfPushMessages() == pushes
+    assert session.GetNumberOfPushBatchMessages() == batches + 1
+
+    # the server received the last value of each property.
+    sphere.UpdatePipeline()
+    assert sphere.GetDataInformation().GetNumberOfCells() == numberOfSphereCells(30, 12)
+
+    # executing a stream sends the pending states first.
+    batches = session.GetNumberOfPushBatchMessages()
+    with servermanager.PushBatch():
+        sphere.ThetaResolution = 16
+        sphere.UpdatePipeline()
+        assert session.GetNumberOfPendingPushes() == 0
+        assert session.GetNumberOfPushBatchMessages() == batches + 1
+        assert sphere.GetDataInformation().GetNumberOfCells() == numberOfSphereCells(16, 12)
+    assert session.GetNumberOfPushBatchMessages() == batches + 1
+
+    # so does pulling the state of a proxy.
+    timeSource = smp.TimeSource()
+    batches = session.GetNumberOfPushBatchMessages()
+    with servermanager.PushBatch():
+        timeSource.Analytic = 1
+        assert session.GetNumberOfPendingPushes() == 1
+        timeSource.SMProxy.UpdatePropertyInformation()
+        assert session.GetNumberOfPendingPushes() == 0
+        assert session.GetNumberOfPushBatchMessages() == batches + 1
+
+    # and deleting the server-side objects of a proxy.
+    cone = smp.Cone()
+    batches = session.GetNumberOfPushBatchMessages()
+    with servermanager.PushBatch():
+        cone.Resolution = 5
+        assert session.GetNumberOfPendingPushes() == 1
+        smp.Delete(cone)
+        del cone
+        assert session.GetNumberOfPendingPushes() == 0
+        assert session.GetNumberOfPushBatchMessages() > batches
+
+    # closing the session sends the states of an unfinished batch.
+    batches = session.GetNumberOfPushBatchMessages()
+    session.BeginPushBatch()
+    sphere.ThetaResolution = 40
+    assert session.GetNumberOfPendingPushes() == 1
+    # no state is sent while disconnecting.
+    session.PreDisconnection()
+    session.CloseSession()
+    assert session.GetNumberOfPendingPushes() == 0
+    assert session.GetNumberOfPushBatchMessages() == batches + 1
+
+    smp.Disconnect()
+
+
+runTest()
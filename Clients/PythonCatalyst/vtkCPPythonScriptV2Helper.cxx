@@ -53,6 +53,23 @@ public:
   }
   ~vtkScopedSet() { this->Ref = this->Value; }
 };
+
+/**
+ * Delimits the Catalyst processing of a simulation cycle for the extracts
+ * controller to account for the time spent in Catalyst and in the simulation.
+ */
+class vtkScopedCycle
+{
+  vtkSMExtractsController* Controller;
+
+public:
+  explicit vtkScopedCycle(vtkSMExtractsController* controller)
+    : Controller(controller)
+  {
+    this->Controller->BeginCycle();
+  }
+  ~vtkScopedCycle() { this->Controller->EndCycle(); }
+};
 }
 
 class vtkCPPythonScriptV2Helper::vtkInternals
@@ -332,6 +349,10 @@ bool vtkCPPythonScriptV2Helper::CatalystInitialize()
   {
     internals.ExtractsController->SetExtractsOutputDirectory(
       vtkSMPropertyHelper(this->Options, "ExtractsOutputDirectory").GetAsString());
+    internals.ExtractsController->SetAsynchronous(
+      vtkSMPropertyHelper(this->Options, "AsynchronousExtracts").GetAsInt() != 0);
+    internals.ExtractsController->SetMaximumNumberOfPendingExtracts(
+      vtkSMPropertyHelper(this->Options, "MaximumNumberOfPendingExtracts").GetAsInt());
   }
 
   return true;
@@ -359,6 +380,10 @@ bool vtkCPPythonScriptV2Helper::CatalystFinalize()
     return false;
   }
 
+  // complete extracts still being written in the background.
+  internals.ExtractsController->Flush();
+  internals.ExtractsController->LogExtractCosts();
+
   if (this->Options &&
     vtkSMPropertyHelper(this->Options, "GenerateCinemaSpecification").GetAsInt() == 1)
   {
@@ -382,6 +407,7 @@ bool vtkCPPythonScriptV2Helper::CatalystExecute(
     return false;
   }
 
+  vtkScopedCycle scopedCycle(this->Internals->ExtractsController);
   if (!this->IsActivated(timestep, time))
   {
     // skip calling RequestDataDescription.
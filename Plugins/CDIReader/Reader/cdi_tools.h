@@ -7,7 +7,11 @@
 #define CDI_TOOLS
 
 #include "cdi.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
 #include <string>
+#include <vector>
 
 namespace cdi_tools
 {
@@ -89,15 +93,15 @@ template <class T>
 void cdi_get_part_struct(CDIVar* cdiVar, int start, size_t size, T* buffer, int nlevels)
 {
   const size_t gridsize = cdiVar->GridSize;
-  T fullbuff[gridsize * nlevels];
-  cdi_get_full(cdiVar, fullbuff, nlevels);
-  for (size_t lev = 0; lev < nlevels; lev++)
-  {
-    for (size_t i = 0; i < size; i++)
+  std::vector<T> fullbuff(gridsize * nlevels);
+  cdi_get_full(cdiVar, fullbuff.data(), nlevels);
+  // CDI streams are not thread safe, only the extraction of the levels runs in parallel.
+  vtkSMPTools::For(0, nlevels, [&](int beginLevel, int endLevel) {
+    for (int lev = beginLevel; lev < endLevel; lev++)
     {
-      buffer[i + lev * size] = fullbuff[(lev * gridsize) + start + i];
+      std::copy_n(fullbuff.begin() + (lev * gridsize) + start, size, buffer + lev * size);
     }
-  }
+  });
 }
 
 template <class T>
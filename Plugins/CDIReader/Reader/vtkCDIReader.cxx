@@ -18,6 +18,7 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkPointData.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkUnstructuredGrid.h"
@@ -27,6 +28,7 @@
 
 #include "cdi_tools.h"
 
+#include <map>
 #include <set>
 #include <sstream>
 
@@ -129,6 +131,63 @@ struct Grid
   size_t Size;
   int PointsPerCell;
 };
+
+// File, time index and vertical level a cached variable array was read for.
+// Level is -1 for arrays that do not depend on the selected level.
+struct LoadedVar
+{
+  int FileSeriesNumber;
+  int TimeIndex;
+  int Level;
+
+  bool operator==(const LoadedVar& other) const
+  {
+    return this->FileSeriesNumber == other.FileSeriesNumber &&
+      this->TimeIndex == other.TimeIndex && this->Level == other.Level;
+  }
+};
+
+bool IsVarLoaded(
+  const std::map<std::string, LoadedVar>& loaded, const std::string& name, const LoadedVar& key)
+{
+  auto iter = loaded.find(name);
+  return iter != loaded.end() && iter->second == key;
+}
+
+// Returns the cached array to read a variable into. A cached array is only
+// overwritten when the reader holds the only references to it; once it was
+// passed on in an output, a new array replaces it in the cache so that the
+// data already delivered is left untouched.
+vtkSmartPointer<vtkDataArray> GetArrayToLoad(vtkFieldData* cache, vtkFieldData* output,
+  const char* name, vtkIdType numberOfTuples, bool doublePrecision)
+{
+  vtkSmartPointer<vtkDataArray> dataArray = cache->GetArray(name);
+  if (dataArray)
+  {
+    // the cache, the reader's own output and dataArray itself.
+    const int ownReferences = output->GetArray(name) == dataArray ? 3 : 2;
+    if (dataArray->GetReferenceCount() == ownReferences &&
+      dataArray->GetNumberOfTuples() == numberOfTuples)
+    {
+      return dataArray;
+    }
+  }
+
+  if (doublePrecision)
+  {
+    dataArray = vtkSmartPointer<vtkDoubleArray>::New();
+  }
+  else
+  {
+    dataArray = vtkSmartPointer<vtkFloatArray>::New();
+  }
+  dataArray->SetName(name);
+  dataArray->SetNumberOfComponents(1);
+  dataArray->SetNumberOfTuples(numberOfTuples);
+  // replaces the array of the same name, if any.
+  cache->AddArray(dataArray);
+  return dataArray;
+}
 }
 
 //----------------------------------------------------------------------------
@@ -164,6 +223,24 @@ public:
   std::map<std::string, Dimset> DimensionSets;
   std::vector<Grid> Grids;
   CDIObject DataFile, GridFile, VGridFile;
+
+  // Variable arrays currently held in CellVarDataArray / PointVarDataArray.
+  std::map<std::string, LoadedVar> LoadedCellVars;
+  std::map<std::string, LoadedVar> LoadedPointVars;
+
+  // Partition and vertical level the cached grid was built for. GridValid is
+  // cleared together with the cached variables in DestroyData().
+  bool GridValid = false;
+  int GridPiece = -1;
+  int GridNumPieces = -1;
+  int GridVerticalLevel = -1;
+
+  LoadedVar MakeLoadedVarKey(vtkCDIReader* self, int varType, double dTimeStep)
+  {
+    const bool levelDependent = varType == 3 && !self->ShowMultilayerView;
+    return { self->FileSeriesNumber, self->GetTimeIndex(dTimeStep),
+      levelDependent ? self->VerticalLevelSelected : -1 };
+  }
 };
 
 namespace
@@ -268,6 +345,10 @@ void vtkCDIReader::DestroyData()
 
   this->DomainVarDataArray->Initialize();
 
+  this->Internals->LoadedCellVars.clear();
+  this->Internals->LoadedPointVars.clear();
+  this->Internals->GridValid = false;
+
   vtkDebugMacro("Out DestroyData...");
 }
 
@@ -571,15 +652,25 @@ int vtkCDIReader::RequestData(vtkInformation* vtkNotUsed(reqInfo),
   this->NumberLocalCells = this->GetPartitioning(this->Piece, this->NumPieces, this->NumberOfCells,
     this->PointsPerCell, this->BeginPoint, this->EndPoint, this->BeginCell, this->EndCell);
 
-  if (this->DataRequested)
-  {
-    this->DestroyData();
-  }
-  if ((!this->Initialized) || (!this->SkipGrid))
+  // The grid and the variables loaded so far stay valid until the partition,
+  // the vertical level or one of the geometry settings changes. Settings that
+  // affect the geometry call DestroyData(), which invalidates both.
+  const bool gridValid = this->Internals->GridValid &&
+    this->Internals->GridPiece == this->Piece &&
+    this->Internals->GridNumPieces == this->NumPieces &&
+    this->Internals->GridVerticalLevel == this->VerticalLevelSelected;
+  if (!gridValid)
   {
-    if (!this->ReadAndOutputGrid(true))
+    if (this->DataRequested)
     {
-      return 0;
+      this->DestroyData();
+    }
+    if ((!this->Initialized) || (!this->SkipGrid))
+    {
+      if (!this->ReadAndOutputGrid(true))
+      {
+        return 0;
+      }
     }
   }
   this->Initialized = true;
@@ -607,34 +698,64 @@ int vtkCDIReader::RequestData(vtkInformation* vtkNotUsed(reqInfo),
   vtkDebugMacro("dTimeTemp: " << dTimeTemp);
   this->DTime = dTimeTemp;
 
+  // Only read variables that were not loaded yet for this time step and
+  // level; arrays that got deselected are dropped from the cache.
   for (int var = 0; var < this->NumberOfCellVars; var++)
   {
-    if (this->GetCellArrayStatus(this->Internals->CellVars[var].Name))
+    const cdi_tools::CDIVar& cdiVar = this->Internals->CellVars[var];
+    if (this->GetCellArrayStatus(cdiVar.Name))
     {
-      vtkDebugMacro("Loading Cell Variable: " << this->Internals->CellVars[var].Name);
+      if (IsVarLoaded(this->Internals->LoadedCellVars, cdiVar.Name,
+            this->Internals->MakeLoadedVarKey(this, cdiVar.Type, this->DTime)))
+      {
+        vtkDebugMacro("Reusing Cell Variable: " << cdiVar.Name);
+        continue;
+      }
+      vtkDebugMacro("Loading Cell Variable: " << cdiVar.Name);
       this->LoadCellVarData(var, this->DTime);
     }
     else
-      vtkDebugMacro(
-        "Ignoring Cell Variable: " << this->Internals->CellVars[var].Name << " as requested ");
+    {
+      vtkDebugMacro("Ignoring Cell Variable: " << cdiVar.Name << " as requested ");
+      this->CellVarDataArray->RemoveArray(cdiVar.Name);
+      this->Internals->LoadedCellVars.erase(cdiVar.Name);
+    }
   }
   this->Output->GetCellData()->ShallowCopy(this->CellVarDataArray);
 
   for (int var = 0; var < this->NumberOfPointVars; var++)
   {
-    if (this->GetPointArrayStatus(this->Internals->PointVars[var].Name))
+    const cdi_tools::CDIVar& cdiVar = this->Internals->PointVars[var];
+    if (this->GetPointArrayStatus(cdiVar.Name))
     {
+      if (IsVarLoaded(this->Internals->LoadedPointVars, cdiVar.Name,
+            this->Internals->MakeLoadedVarKey(this, cdiVar.Type, this->DTime)))
+      {
+        vtkDebugMacro("Reusing Point Variable: " << cdiVar.Name);
+        continue;
+      }
       vtkDebugMacro("Loading Point Variable: " << var);
       this->LoadPointVarData(var, this->DTime);
     }
+    else
+    {
+      this->PointVarDataArray->RemoveArray(cdiVar.Name);
+      this->Internals->LoadedPointVars.erase(cdiVar.Name);
+    }
   }
   this->Output->GetPointData()->ShallowCopy(this->PointVarDataArray);
 
+  // Domain variables do not depend on time or level, keep them once read.
   for (int var = 0; var < this->NumberOfDomainVars; var++)
   {
-    if (this->GetDomainArrayStatus(this->Internals->DomainVars[var].c_str()))
+    const char* name = this->Internals->DomainVars[var].c_str();
+    if (!this->GetDomainArrayStatus(name))
     {
-      vtkDebugMacro("Loading Domain Variable: " << this->Internals->DomainVars[var].c_str());
+      this->DomainVarDataArray->RemoveArray(name);
+    }
+    else if (!this->DomainVarDataArray->HasArray(name))
+    {
+      vtkDebugMacro("Loading Domain Variable: " << name);
       this->LoadDomainVarData(var);
     }
   }
@@ -1264,6 +1385,11 @@ int vtkCDIReader::ReadAndOutputGrid(bool init)
   this->OutputPoints(init);
   this->OutputCells(init);
 
+  this->Internals->GridValid = true;
+  this->Internals->GridPiece = this->Piece;
+  this->Internals->GridNumPieces = this->NumPieces;
+  this->Internals->GridVerticalLevel = this->VerticalLevelSelected;
+
   vtkDebugMacro("Leaving vtkCDIReader::ReadAndOutputGrid");
 
   return 1;
@@ -2577,28 +2703,9 @@ int vtkCDIReader::LoadPointVarData(int variableIndex, double dTimeStep)
 
   this->PointDataSelected = variableIndex;
 
-  vtkSmartPointer<vtkDataArray> dataArray =
-    this->PointVarDataArray->GetArray(this->Internals->PointVars[variableIndex].Name);
-
-  // Allocate data array for this variable
-  if (dataArray == nullptr)
-  {
-    if (this->DoublePrecision)
-    {
-      dataArray = vtkSmartPointer<vtkDoubleArray>::New();
-    }
-    else
-    {
-      dataArray = vtkSmartPointer<vtkFloatArray>::New();
-    }
-
-    vtkDebugMacro("Allocated Point var index: " << this->Internals->PointVars[variableIndex].Name);
-    dataArray->SetName(this->Internals->PointVars[variableIndex].Name);
-    dataArray->SetNumberOfTuples(this->MaximumPoints);
-    dataArray->SetNumberOfComponents(1);
-
-    this->PointVarDataArray->AddArray(dataArray);
-  }
+  vtkSmartPointer<vtkDataArray> dataArray = ::GetArrayToLoad(this->PointVarDataArray,
+    this->Output->GetPointData(), this->Internals->PointVars[variableIndex].Name,
+    this->MaximumPoints, this->DoublePrecision);
 
   int success = false;
   if (this->DoublePrecision)
@@ -2614,6 +2721,14 @@ int vtkCDIReader::LoadPointVarData(int variableIndex, double dTimeStep)
       success = this->LoadPointVarDataTemplate<VTK_TT>(variableIndex, dTimeStep, dataArray););
   }
 
+  if (success)
+  {
+    dataArray->Modified();
+    const cdi_tools::CDIVar& cdiVar = this->Internals->PointVars[variableIndex];
+    this->Internals->LoadedPointVars[cdiVar.Name] =
+      this->Internals->MakeLoadedVarKey(this, cdiVar.Type, dTimeStep);
+  }
+
   return success;
 }
 
@@ -2624,27 +2739,9 @@ int vtkCDIReader::LoadCellVarData(int variableIndex, double dTimeStep)
 {
   this->CellDataSelected = variableIndex;
 
-  vtkSmartPointer<vtkDataArray> dataArray =
-    this->CellVarDataArray->GetArray(this->Internals->CellVars[variableIndex].Name);
-  // Allocate data array for this variable
-  if (dataArray == nullptr)
-  {
-    if (this->DoublePrecision)
-    {
-      dataArray = vtkSmartPointer<vtkDoubleArray>::New();
-    }
-    else
-    {
-      dataArray = vtkSmartPointer<vtkFloatArray>::New();
-    }
-
-    vtkDebugMacro("Allocated cell var index: " << this->Internals->CellVars[variableIndex].Name);
-    dataArray->SetName(this->Internals->CellVars[variableIndex].Name);
-    dataArray->SetNumberOfTuples(this->MaximumCells);
-    dataArray->SetNumberOfComponents(1);
-
-    this->CellVarDataArray->AddArray(dataArray);
-  }
+  vtkSmartPointer<vtkDataArray> dataArray = ::GetArrayToLoad(this->CellVarDataArray,
+    this->Output->GetCellData(), this->Internals->CellVars[variableIndex].Name,
+    this->MaximumCells, this->DoublePrecision);
 
   int success = false;
   if (this->DoublePrecision)
@@ -2660,6 +2757,14 @@ int vtkCDIReader::LoadCellVarData(int variableIndex, double dTimeStep)
       success = this->LoadCellVarDataTemplate<VTK_TT>(variableIndex, dTimeStep, dataArray););
   }
 
+  if (success)
+  {
+    dataArray->Modified();
+    const cdi_tools::CDIVar& cdiVar = this->Internals->CellVars[variableIndex];
+    this->Internals->LoadedCellVars[cdiVar.Name] =
+      this->Internals->MakeLoadedVarKey(this, cdiVar.Type, dTimeStep);
+  }
+
   return success;
 }
 
@@ -2701,26 +2806,28 @@ int vtkCDIReader::LoadCellVarDataTemplate(
       cdi_tools::cdi_get_part<ValueType>(cdiVar, this->BeginCell, this->NumberLocalCells, dataTmp,
         this->MaximumNVertLevels, this->Grib);
 
-      // readjust the data
-      for (int j = 0; j < this->NumberLocalCells; j++)
-      {
-        for (int levelNum = 0; levelNum < this->MaximumNVertLevels; levelNum++)
+      // readjust the data from level-major to cell-major order, levels are
+      // independent of each other and copied in parallel
+      const int numLocalCells = this->NumberLocalCells;
+      const int numLevels = this->MaximumNVertLevels;
+      const int numExtraCells = this->CurrentExtraCell;
+      const unsigned int* cellMap = this->CellMap.data();
+      vtkSMPTools::For(0, numLevels, [&](int beginLevel, int endLevel) {
+        for (int levelNum = beginLevel; levelNum < endLevel; levelNum++)
         {
-          int i = j * this->MaximumNVertLevels;
-          dataBlock[i + levelNum] = dataTmp[j + (levelNum * this->NumberLocalCells)];
-        }
-      }
+          const ValueType* levelData = dataTmp + (levelNum * numLocalCells);
+          for (int j = 0; j < numLocalCells; j++)
+          {
+            dataBlock[j * numLevels + levelNum] = levelData[j];
+          }
 
-      // put out data for extra cells
-      for (int j = this->NumberLocalCells; j < this->CurrentExtraCell; j++)
-      {
-        for (int levelNum = 0; levelNum < this->MaximumNVertLevels; levelNum++)
-        {
-          int l = j * this->MaximumNVertLevels;
-          int k = this->CellMap[j - this->NumberLocalCells];
-          dataBlock[l + levelNum] = dataTmp[k + (levelNum * this->NumberLocalCells)];
+          // put out data for extra cells
+          for (int j = numLocalCells; j < numExtraCells; j++)
+          {
+            dataBlock[j * numLevels + levelNum] = levelData[cellMap[j - numLocalCells]];
+          }
         }
-      }
+      });
 
       delete[] dataTmp;
     }
@@ -2908,19 +3015,23 @@ int vtkCDIReader::LoadPointVarDataTemplate(
         dataTmp[this->MaximumNVertLevels + this->MaximumNVertLevels - 1];
       vtkDebugMacro("Wrote dummy vtkICONReader::LoadPointVarDataSP");
 
-      // readjust the data
-      for (int j = 0; j < this->NumberLocalPoints; j++)
-      {
-        int i = j * (this->MaximumNVertLevels + 1);
-        // write data for one Point -- lowest level to highest
-        for (int levelNum = 0; levelNum < this->MaximumNVertLevels; levelNum++)
+      // readjust the data, each point column is written independently
+      const int numLocalPoints = this->NumberLocalPoints;
+      const int numLevels = this->MaximumNVertLevels;
+      vtkSMPTools::For(0, numLocalPoints, [&](int begin, int end) {
+        for (int j = begin; j < end; j++)
         {
-          dataBlock[i++] = dataTmp[j + (levelNum * this->NumberLocalPoints)];
-        }
+          int i = j * (numLevels + 1);
+          // write data for one Point -- lowest level to highest
+          for (int levelNum = 0; levelNum < numLevels; levelNum++)
+          {
+            dataBlock[i++] = dataTmp[j + (levelNum * numLocalPoints)];
+          }
 
-        // layer below, which is repeated ...
-        dataBlock[i++] = dataTmp[j + ((this->MaximumNVertLevels - 1) * this->NumberLocalPoints)];
-      }
+          // layer below, which is repeated ...
+          dataBlock[i] = dataTmp[j + ((numLevels - 1) * numLocalPoints)];
+        }
+      });
     }
   }
   else
@@ -3391,33 +3502,8 @@ void vtkCDIReader::SetVerticalLevel(int level)
     this->Modified();
     vtkDebugMacro("Set VerticalLevelSelected to: " << level);
   }
-  vtkDebugMacro("InfoRequested?: " << this->InfoRequested);
-
-  if (!this->InfoRequested || !this->DataRequested)
-  {
-    return;
-  }
-
-  for (int var = 0; var < this->NumberOfPointVars; var++)
-  {
-    if (this->PointDataArraySelection->GetArraySetting(var))
-    {
-      vtkDebugMacro("Loading Point Variable: " << this->Internals->PointVars[var].Name);
-      this->LoadPointVarData(var, this->DTime);
-    }
-  }
-
-  for (int var = 0; var < this->NumberOfCellVars; var++)
-  {
-    if (this->CellDataArraySelection->GetArraySetting(var))
-    {
-      vtkDebugMacro("Loading Cell Variable: " << this->Internals->CellVars[var].Name);
-      this->LoadCellVarData(var, this->DTime);
-    }
-  }
-
-  this->PointDataArraySelection->Modified();
-  this->CellDataArraySelection->Modified();
+  // The grid and the variables are reloaded for the new level by the next
+  // RequestData, since the cached grid was built for the previous level.
 }
 
 //----------------------------------------------------------------------------
@@ -116,9 +116,21 @@ vtkGenIOReader::vtkGenIOReader()
   // % loading
   dataPercentage = 0.1;
   percentageType = 1; // 0:normal, 1:power cube
+  samplingMethod = 0; // random
+
+  // Spatial range
+  useRange = false;
+  for (int i = 0; i < 3; i++)
+  {
+    rangeBounds[2 * i] = 0.0;
+    rangeBounds[2 * i + 1] = 1.0;
+    decompositionDims[i] = 0;
+    physOrigin[i] = physScale[i] = 0.0;
+  }
 
   // Selections
   selectionChanged = false;
+  userRandomSeed = 0;
   randomSeed = std::chrono::system_clock::now().time_since_epoch().count();
   CellDataArraySelection = vtkDataArraySelection::New();
 
@@ -192,6 +204,48 @@ void vtkGenIOReader::SetPercentageType(int _type)
   }
 }
 
+void vtkGenIOReader::SetSamplingMethod(int _method)
+{
+  if (samplingMethod != _method)
+  {
+    samplingMethod = _method;
+    this->Modified();
+  }
+}
+
+void vtkGenIOReader::SetRandomSeed(int _seed)
+{
+  if (userRandomSeed != _seed)
+  {
+    userRandomSeed = _seed;
+    randomSeed = (_seed != 0)
+      ? static_cast<unsigned>(_seed)
+      : static_cast<unsigned>(std::chrono::system_clock::now().time_since_epoch().count());
+    randomNumGenerated = false;
+    this->Modified();
+  }
+}
+
+void vtkGenIOReader::SetUseRange(int _useRange)
+{
+  if (useRange != (_useRange != 0))
+  {
+    useRange = _useRange != 0;
+    this->Modified();
+  }
+}
+
+void vtkGenIOReader::SetRangeBounds(
+  double xMin, double xMax, double yMin, double yMax, double zMin, double zMax)
+{
+  const double bounds[6] = { xMin, xMax, yMin, yMax, zMin, zMax };
+  if (!std::equal(bounds, bounds + 6, rangeBounds))
+  {
+    std::copy(bounds, bounds + 6, rangeBounds);
+    this->Modified();
+  }
+}
+
 void vtkGenIOReader::SetResetSelection(int /* _x */)
 {
   selections.clear();
@@ -272,6 +326,12 @@ void vtkGenIOReader::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
   os << indent << "File: " << (this->dataFilename.c_str() ? this->dataFilename.c_str() : "none")
      << "\n";
+  os << indent << "SamplingMethod: " << this->samplingMethod << "\n";
+  os << indent << "RandomSeed: " << this->userRandomSeed << "\n";
+  os << indent << "UseRange: " << this->useRange << "\n";
+  os << indent << "RangeBounds: " << this->rangeBounds[0] << ", " << this->rangeBounds[1] << ", "
+     << this->rangeBounds[2] << ", " << this->rangeBounds[3] << ", " << this->rangeBounds[4]
+     << ", " << this->rangeBounds[5] << "\n";
 }
 
 void vtkGenIOReader::displayMsg(std::string msg)
@@ -371,6 +431,55 @@ bool vtkGenIOReader::doMPIDataSplitting(int numDataRanksTmp, int numMPIranks, in
   return splitReading;
 }
 
+//
+// The physical extent of a data rank follows from its coordinates in the
+// rank decomposition, so ranks outside of the range can be skipped before
+// anything is read from them.
+bool vtkGenIOReader::blockOverlapsRange(int dataRank)
+{
+  for (int d = 0; d < 3; d++)
+  {
+    // Unknown physical layout, the rank has to be read
+    if (physScale[d] <= 0.0 || decompositionDims[d] <= 0)
+      return true;
+  }
+
+  int coords[3];
+  gioReader->readCoords(coords, dataRank);
+  for (int d = 0; d < 3; d++)
+  {
+    double width = physScale[d] / decompositionDims[d];
+    double blockMin = physOrigin[d] + coords[d] * width;
+    double blockMax = blockMin + width;
+    if (blockMax < rangeBounds[2 * d] || blockMin > rangeBounds[2 * d + 1])
+      return false;
+  }
+  return true;
+}
+
+bool vtkGenIOReader::pointInRange(size_t row)
+{
+  double pnt[3] = { 0.0, 0.0, 0.0 };
+  for (size_t k = 0; k < paraviewData.size(); k++)
+  {
+    if (paraviewData[k].xVar)
+      pnt[0] = ((float*)readInData[k].data)[row];
+
+    if (paraviewData[k].yVar)
+      pnt[1] = ((float*)readInData[k].data)[row];
+
+    if (paraviewData[k].zVar)
+      pnt[2] = ((float*)readInData[k].data)[row];
+  }
+
+  for (int d = 0; d < 3; d++)
+  {
+    if (pnt[d] < rangeBounds[2 * d] || pnt[d] > rangeBounds[2 * d + 1])
+      return false;
+  }
+  return true;
+}
+
 void vtkGenIOReader::theadedParsing(int threadId, int numThreads, size_t numRowsToSample,
   size_t numLoadingRows, vtkSmartPointer<vtkCellArray> cells, vtkSmartPointer<vtkPoints> pnts,
   int numSelections)
@@ -383,6 +492,8 @@ void vtkGenIOReader::theadedParsing(int threadId, int numThreads, size_t numRows
   size_t rowsPerThread = floor(numLoadingRows / (float)numThreads);
   size_t startRow = rowsPerThread * threadId;
   size_t numRowsToSamplePerThread = floor(numRowsToSample / (float)numThreads);
+  size_t firstSample = numRowsToSamplePerThread * threadId;
+  double stride = numRowsToSample > 0 ? numLoadingRows / (double)numRowsToSample : 1.0;
   if (threadId == numThreads - 1)
   {
     size_t count = (numThreads - 1) * numRowsToSamplePerThread;
@@ -394,18 +505,34 @@ void vtkGenIOReader::theadedParsing(int threadId, int numThreads, size_t numRows
   double pnt[3];
   for (size_t j = startRow; j < (startRow + numRowsToSamplePerThread); ++j)
   {
-    // Choose random element to load
-    size_t _j = _num[j];
-    while (_j >= numLoadingRows)
+    size_t _j;
+    if (samplingMethod == 1)
     {
-      mtx.lock();
-      size_t _nextHash = nextHash;
-      nextHash++;
-      mtx.unlock();
+      // Take every stride-th element
+      _j = static_cast<size_t>((firstSample + (j - startRow)) * stride);
+      if (_j >= numLoadingRows)
+        break;
+    }
+    else
+    {
+      // Choose random element to load
+      _j = _num[j];
+      while (_j >= numLoadingRows)
+      {
+        mtx.lock();
+        size_t _nextHash = nextHash;
+        nextHash++;
+        mtx.unlock();
 
-      _j = _num[_nextHash];
+        _j = _num[_nextHash];
+      }
     }
 
+    //
+    // Spatial range
+    if (useRange && !pointInRange(_j))
+      continue;
+
     //
     // Selection
     if (numSelections != -1)
@@ -566,6 +693,9 @@ int vtkGenIOReader::RequestInformation(vtkInformation* /*rqst*/,
 
     totalNumberOfElements = 0;
     numDataRanks = this->gioReader->readNRanks();
+    this->gioReader->readDims(decompositionDims);
+    this->gioReader->readPhysOrigin(physOrigin);
+    this->gioReader->readPhysScale(physScale);
     msgLog << "numDataRanks: " << numDataRanks << "\n";
     for (int i = 0; i < numDataRanks; ++i)
       totalNumberOfElements += this->gioReader->readNumElems(i);
@@ -838,7 +968,7 @@ int vtkGenIOReader::RequestData(
 
   //
   // Generate a random number, sort of hashing really where each key is unique
-  if (!randomNumGenerated)
+  if (!randomNumGenerated && samplingMethod == 0)
   {
     hashClock.start();
     _num.resize(maxRowsInRank);
@@ -910,6 +1040,8 @@ int vtkGenIOReader::RequestData(
 
   totalPoints = 0;
   size_t totalPointsProcessed = 0;
+  size_t numSkippedRanks = 0;
+  splitReadingCount = 0;
   populatingClock.start();
   switch (this->sampleType)
   {
@@ -919,6 +1051,14 @@ int vtkGenIOReader::RequestData(
 
       for (int i = ranksRangeToLoad[0]; i <= ranksRangeToLoad[1]; ++i)
       {
+        if (useRange && !blockOverlapsRange(i))
+        {
+          if (splitReading)
+            splitReadingCount++;
+          numSkippedRanks++;
+          continue;
+        }
+
         size_t Np = gioReader->readNumElems(i);
         totalPointsProcessed += Np;
 
@@ -1059,6 +1199,14 @@ int vtkGenIOReader::RequestData(
 
       for (int i = ranksRangeToLoad[0]; i <= ranksRangeToLoad[1]; ++i)
       {
+        if (useRange && !blockOverlapsRange(i))
+        {
+          if (splitReading)
+            splitReadingCount++;
+          numSkippedRanks++;
+          continue;
+        }
+
         size_t Np = gioReader->readNumElems(i);
         totalPointsProcessed += Np;
 
@@ -1191,6 +1339,7 @@ int vtkGenIOReader::RequestData(
   cleanupClock.stop();
 
   msgLog << "\ntotalPoints " << totalPoints << " out of " << totalPointsProcessed << "\n";
+  msgLog << "data ranks skipped (outside of range): " << numSkippedRanks << "\n";
   msgLog << "numActiveTuples: " << numActiveTuples << "\n";
 
   msgLog << "\nTiming:\n";
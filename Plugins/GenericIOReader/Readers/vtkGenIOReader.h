@@ -86,6 +86,14 @@ public:
   void SetSampleType(int s);
   void SetDataPercentToShow(double t);
   void SetPercentageType(int _type);
+  void SetSamplingMethod(int _method);
+  void SetRandomSeed(int _seed);
+
+  //
+  // Spatial range: only particles inside the bounds are shown, and data ranks
+  // whose physical block lies outside of them are not read at all
+  void SetUseRange(int _useRange);
+  void SetRangeBounds(double xMin, double xMax, double yMin, double yMax, double zMin, double zMax);
 
   void SetResetSelection(int _x);
   void SelectScalar(const char* selectedScalar);
@@ -122,6 +130,9 @@ protected:
 
   void displayMsg(std::string msg);
 
+  bool blockOverlapsRange(int dataRank);
+  bool pointInRange(size_t row);
+
 private:
   // MPI Stuff
   vtkMultiProcessController* Controller;
@@ -136,9 +147,15 @@ private:
 
   // Loading
   int percentageType; // 0:normal, 1:power cubelog
+  int samplingMethod; // 0:random, 1:strided
   double dataPercentage;
   size_t dataNumShowElements;
   unsigned randomSeed;
+  int userRandomSeed; // 0: seed from the clock
+
+  // Spatial range
+  bool useRange;
+  double rangeBounds[6];
 
   // Selection
   bool selectionChanged;
@@ -154,6 +171,8 @@ private:
   bool metaDataBuilt;
   int numDataRanks;
   int numVars;                                  // number of variables in the data (vx, vy, ...)
+  int decompositionDims[3];                     // rank decomposition of the simulation
+  double physOrigin[3], physScale[3];           // physical domain, scale is 0 when unknown
   std::vector<GIOPvPlugin::GioData> readInData; // the data readin
 
   std::vector<vtkDataArray*> tupleArray;
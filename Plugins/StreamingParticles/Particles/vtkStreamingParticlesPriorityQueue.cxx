@@ -168,6 +168,7 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
   // Level (k+1).
 
   vtkStreamingPriorityQueue<vtkParticlesComparator> queue;
+  std::map<unsigned int, unsigned int> blockLevels;
 
   unsigned int block_index = 0;
   unsigned int num_levels = metadata->GetNumberOfBlocks();
@@ -195,6 +196,7 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
       vtkStreamingPriorityQueueItem item;
       item.Identifier = block_index;
       item.Refinement = level;
+      blockLevels[block_index] = level;
 
       double bounds[6];
       vtkInformation* blockInfo = mb->GetMetaData(cc);
@@ -250,7 +252,10 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
     //        (item.Refinement <= 0 ||
     //         (item.ItemCoverage > 0 && item.ScreenCoverage / (item.AmountOfDetail *
     //         item.ItemCoverage ) > this->DetailLevelToLoad));
-    bool genericMethodNeedsBlock = (item.Refinement <= 1 || item.ScreenCoverage >= 0.75);
+    // Refined blocks are only worth streaming when they are inside of the view
+    // frustum, the coarsest level is always kept so there is something to show.
+    bool genericMethodNeedsBlock = item.Refinement <= 0 ||
+      (item.ScreenCoverage > 0 && (item.Refinement <= 1 || item.ScreenCoverage >= 0.75));
 
     if ((this->UseBlockDetailInformation && item.AmountOfDetail > 0) ? detailMethodNeedsBlock
                                                                      : genericMethodNeedsBlock)
@@ -319,6 +324,17 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
     }
   }
 
+  // Stream coarse levels first so that every visible region gets a low
+  // resolution representation before any region is refined further. Within a
+  // level the order of the priority queue is preserved.
+  auto levelOf = [&blockLevels](unsigned int id)
+  {
+    std::map<unsigned int, unsigned int>::const_iterator level = blockLevels.find(id);
+    return level != blockLevels.end() ? level->second : 0u;
+  };
+  std::stable_sort(toRequest.begin(), toRequest.end(),
+    [&levelOf](unsigned int a, unsigned int b) { return levelOf(a) < levelOf(b); });
+
   for (std::deque<unsigned int>::iterator itr = toRequest.begin(); itr != toRequest.end(); ++itr)
   {
     std::map<unsigned, unsigned>::iterator keep = keepInRequest.find(*itr % num_block_per_level);
@@ -335,10 +351,10 @@ void vtkStreamingParticlesPriorityQueue::UpdatePriorities(const double view_plan
     this->Internals->BlocksRequested.insert(itr->second);
   }
 
-  cout << "Update information  : " << endl
-       << "  To request        : " << this->Internals->BlocksToRequest.size() << endl
-       << "  Already requested : " << this->Internals->BlocksRequested.size() << endl
-       << "  To purge          : " << this->Internals->BlocksToPurge.size() << endl;
+  vtkDebugMacro(<< "Update information  : " << endl
+                << "  To request        : " << this->Internals->BlocksToRequest.size() << endl
+                << "  Already requested : " << this->Internals->BlocksRequested.size() << endl
+                << "  To purge          : " << this->Internals->BlocksToPurge.size());
 }
 
 //----------------------------------------------------------------------------
@@ -359,9 +375,10 @@ unsigned int vtkStreamingParticlesPriorityQueue::Pop()
   {
     int myid = this->Controller->GetLocalProcessId();
     int num_ranks = this->Controller->GetNumberOfProcesses();
-    std::vector<unsigned int> items;
-    items.resize(num_ranks);
-    for (int i = 0; i < num_ranks; ++i)
+    // The last round may have fewer blocks than processes, those processes
+    // get nothing to load.
+    std::vector<unsigned int> items(num_ranks, VTK_UNSIGNED_INT_MAX);
+    for (int i = 0; i < num_ranks && !this->Internals->BlocksToRequest.empty(); ++i)
     {
       items[i] = this->Internals->BlocksToRequest.front();
       this->Internals->BlocksToRequest.pop();
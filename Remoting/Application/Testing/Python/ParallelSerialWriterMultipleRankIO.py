@@ -37,6 +37,8 @@ s.ThetaResolution = 80
 
 SaveData(join(rootdir, "sphere-cont.stl"), s, NumberOfIORanks=2, RankAssignmentMode="Contiguous")
 SaveData(join(rootdir, "sphere-rr.stl"), s, NumberOfIORanks=2, RankAssignmentMode="RoundRobin")
+SaveData(join(rootdir, "sphere-rr-streamed.stl"), s, NumberOfIORanks=2,
+    RankAssignmentMode="RoundRobin", AggregationMode="Streamed")
 
 
 Barrier()
@@ -53,6 +55,19 @@ grr = GroupDatasets(Input=[r0, r1])
 dr = Show(grr)
 dr.Translation = [1, 1, 0]
 
+# streamed aggregation must write the same pieces as the default gather.
+for i, rr in enumerate([r0, r1]):
+    streamed = OpenDataFile(join(rootdir, "sphere-rr-streamed-%d.stl" % i))
+    streamed.UpdatePipeline()
+    rr.UpdatePipeline()
+    expected = rr.GetDataInformation()
+    actual = streamed.GetDataInformation()
+    if actual.GetNumberOfPoints() != expected.GetNumberOfPoints() or \
+        actual.GetNumberOfCells() != expected.GetNumberOfCells() or \
+        actual.GetBounds() != expected.GetBounds():
+        raise smtesting.TestError("'sphere-rr-streamed-%d.stl' differs from 'sphere-rr-%d.stl'" % (i, i))
+    Delete(streamed)
+
 ResetCamera()
 ColorBy(dc, ('FIELD', 'vtkBlockColors'))
 ColorBy(dr, ('FIELD', 'vtkBlockColors'))
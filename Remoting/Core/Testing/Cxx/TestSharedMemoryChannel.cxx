@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkNew.h"
+#include "vtkPVSharedMemoryChannel.h"
+#include "vtkTimerLog.h"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Writes `payload` on `writer` from another thread and reads it back from
+// `reader`. The payload is larger than the ring buffers, so that it wraps
+// around them several times.
+bool Transfer(vtkPVSharedMemoryChannel* writer, vtkPVSharedMemoryChannel* reader,
+  const std::vector<char>& payload, double& seconds)
+{
+  std::vector<char> received(payload.size());
+  bool written = false;
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  std::thread thread([&]() { written = writer->Write(payload.data(), payload.size()); });
+  const bool read = reader->Read(received.data(), received.size());
+  thread.join();
+  timer->StopTimer();
+  seconds = timer->GetElapsedTime();
+  return written && read && received == payload;
+}
+}
+
+int TestSharedMemoryChannel(int, char*[])
+{
+  if (!vtkPVSharedMemoryChannel::IsSupported())
+  {
+    std::cout << "Shared-memory channels are not supported on this platform." << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  vtkNew<vtkPVSharedMemoryChannel> server;
+  if (!server->Create(1024 * 1024))
+  {
+    std::cerr << "Failed to create the channel." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkPVSharedMemoryChannel> client;
+  if (client->Open(server->GetName(), server->GetToken() + 1) || client->IsOpen())
+  {
+    std::cerr << "Opened the channel with a wrong token." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (!client->Open(server->GetName(), server->GetToken()) || !server->IsConnected() ||
+    !client->IsConnected())
+  {
+    std::cerr << "Failed to open the channel." << std::endl;
+    return EXIT_FAILURE;
+  }
+  server->Unlink();
+
+  std::vector<char> payload(16 * 1024 * 1024 + 13);
+  for (size_t cc = 0; cc < payload.size(); ++cc)
+  {
+    payload[cc] = static_cast<char>(cc * 31 + cc / 4096);
+  }
+
+  double toClient = 0.0;
+  double toServer = 0.0;
+  if (!::Transfer(server, client, payload, toClient) ||
+    !::Transfer(client, server, payload, toServer))
+  {
+    std::cerr << "Payload was not transferred correctly." << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Transferred " << payload.size() << " bytes in " << toClient << "s and "
+            << toServer << "s." << std::endl;
+
+  // once one end is closed, the other one must notice it instead of waiting.
+  client->Close();
+  if (server->IsConnected())
+  {
+    std::cerr << "Closing the channel was not noticed." << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkPVSharedMemoryChannel.h"
+#include "vtkSmartPointer.h"
+#include "vtkTCPNetworkAccessManager.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/SystemInformation.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// More connections than the former fixed limit of the event loop (256).
+constexpr int NumberOfClients = 300;
+constexpr int RMITag = 8765;
+
+void CountRMI(void* localArg, void*, int, int)
+{
+  ++(*static_cast<int*>(localArg));
+}
+}
+
+int TestTCPNetworkAccessManagerManyConnections(int, char*[])
+{
+  // keep all the traffic on the sockets.
+  vtkPVSharedMemoryChannel::SetEnabled(false);
+
+  const int port = 22222 + static_cast<int>(vtksys::SystemInformation::GetProcessId() % 1000);
+
+  vtkNew<vtkTCPNetworkAccessManager> server;
+  server->DisableFurtherConnections(port, false);
+
+  // connects the clients from another thread, then has each of them trigger an
+  // RMI on the server once all are connected.
+  std::atomic<bool> clientsDone{ false };
+  std::atomic<int> clientsConnected{ 0 };
+  std::atomic<bool> serverDone{ false };
+  std::thread clientThread([&]() {
+    vtkNew<vtkTCPNetworkAccessManager> clientManager;
+    std::ostringstream url;
+    url << "tcp://localhost:" << port << "?timeout=10";
+    std::vector<vtkSmartPointer<vtkMultiProcessController>> clients;
+    for (int cc = 0; cc < NumberOfClients; ++cc)
+    {
+      vtkSmartPointer<vtkMultiProcessController> client;
+      client.TakeReference(clientManager->NewConnection(url.str().c_str()));
+      if (!client)
+      {
+        break;
+      }
+      clients.push_back(client);
+      ++clientsConnected;
+    }
+    for (const auto& client : clients)
+    {
+      client->TriggerRMI(1, RMITag);
+    }
+    clientsDone = true;
+
+    // keep the connections open until the server processed all the RMIs.
+    while (!serverDone)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  });
+
+  std::ostringstream url;
+  url << "tcp://localhost:" << port << "?listen=true&multiple=true";
+  std::vector<vtkSmartPointer<vtkMultiProcessController>> connections;
+  std::vector<int> counts(NumberOfClients, 0);
+  for (int cc = 0; cc < NumberOfClients; ++cc)
+  {
+    vtkSmartPointer<vtkMultiProcessController> connection;
+    connection.TakeReference(server->NewConnection(url.str().c_str()));
+    if (!connection)
+    {
+      break;
+    }
+    connection->AddRMICallback(&CountRMI, &counts[cc], RMITag);
+    connections.push_back(connection);
+  }
+
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  int processed = 0;
+  while (processed < static_cast<int>(connections.size()))
+  {
+    if (server->ProcessEvents(100) < 0)
+    {
+      break;
+    }
+    timer->StopTimer();
+    if (timer->GetElapsedTime() > 60.0)
+    {
+      break;
+    }
+    processed = 0;
+    for (int count : counts)
+    {
+      processed += count;
+    }
+  }
+  timer->StopTimer();
+
+  serverDone = true;
+  clientThread.join();
+
+  std::cout << "Processed " << processed << " RMIs from " << connections.size() << " connections in "
+            << timer->GetElapsedTime() << " s." << std::endl;
+
+  if (static_cast<int>(connections.size()) != NumberOfClients ||
+    clientsConnected != NumberOfClients || !clientsDone)
+  {
+    std::cerr << "Only " << connections.size() << " of " << NumberOfClients
+              << " connections were established." << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (int cc = 0; cc < NumberOfClients; ++cc)
+  {
+    if (counts[cc] != 1)
+    {
+      std::cerr << "Connection " << cc << " processed " << counts[cc] << " RMIs instead of 1."
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -17,7 +17,6 @@
 #include "vtkSmartPointer.h"
 
 #include <algorithm>
-#include <iterator>
 #include <map>
 #include <string>
 #include <vector>
@@ -60,6 +59,31 @@ public:
   ArrayInformationType ArrayInformation;
   std::string AttributesInformation[vtkDataSetAttributes::NUM_ATTRIBUTES];
   bool ValuesPopulated = false;
+
+  // Positional index into ArrayInformation, so that accessing the arrays by
+  // index is constant time. Arrays are only ever added or all cleared, so the
+  // index is stale exactly when its size differs; ClearArrays() resets it.
+  mutable std::vector<ArrayInformationType::const_iterator> ArrayIndex;
+
+  void ClearArrays()
+  {
+    this->ArrayInformation.clear();
+    this->ArrayIndex.clear();
+  }
+
+  vtkPVArrayInformation* GetArray(int idx) const
+  {
+    if (this->ArrayIndex.size() != this->ArrayInformation.size())
+    {
+      this->ArrayIndex.clear();
+      this->ArrayIndex.reserve(this->ArrayInformation.size());
+      for (auto iter = this->ArrayInformation.begin(); iter != this->ArrayInformation.end(); ++iter)
+      {
+        this->ArrayIndex.push_back(iter);
+      }
+    }
+    return this->ArrayIndex[idx]->second;
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -95,7 +119,7 @@ void vtkPVDataSetAttributesInformation::PrintSelf(ostream& os, vtkIndent indent)
 void vtkPVDataSetAttributesInformation::Initialize()
 {
   vtkInternals& internals = (*this->Internals);
-  internals.ArrayInformation.clear();
+  internals.ClearArrays();
   std::fill_n(internals.AttributesInformation,
     static_cast<int>(vtkDataSetAttributes::NUM_ATTRIBUTES), std::string());
   internals.ValuesPopulated = false;
@@ -114,7 +138,7 @@ void vtkPVDataSetAttributesInformation::DeepCopy(vtkPVDataSetAttributesInformati
     return;
   }
 
-  internals.ArrayInformation.clear();
+  internals.ClearArrays();
   for (const auto& pair : ointernals.ArrayInformation)
   {
     vtkNew<vtkPVArrayInformation> arrayInfo;
@@ -345,8 +369,7 @@ vtkPVArrayInformation* vtkPVDataSetAttributesInformation::GetArrayInformation(in
   const auto& internals = (*this->Internals);
   if (idx >= 0 && idx < static_cast<int>(internals.ArrayInformation.size()))
   {
-    auto iter = std::next(internals.ArrayInformation.begin(), idx);
-    return iter->second;
+    return internals.GetArray(idx);
   }
   return nullptr;
 }
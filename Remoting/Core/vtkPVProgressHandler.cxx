@@ -17,7 +17,11 @@
 #include "vtkTimerLog.h"
 
 #include <map>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 // define this variable to disable progress all together. This may be useful to
 // doing really large runs.
@@ -88,6 +92,22 @@ public:
   bool EnableProgress;
 
   vtkNew<vtkTimerLog> ProgressTimer;
+
+  // Algorithms may execute in threads other than the one that created the
+  // handler (see vtkPVPipelineScheduler). Messages they emit are queued and
+  // sent from this thread, and their progress is ignored.
+  const std::thread::id MainThread = std::this_thread::get_id();
+  std::mutex PendingMessagesMutex;
+  std::vector<std::pair<std::string, int>> PendingMessages;
+
+  bool IsMainThread() const { return std::this_thread::get_id() == this->MainThread; }
+
+  std::vector<std::pair<std::string, int>> TakePendingMessages()
+  {
+    std::lock_guard<std::mutex> lock(this->PendingMessagesMutex);
+    return std::move(this->PendingMessages);
+  }
+
   vtkInternals()
   {
     this->EnableProgress = false;
@@ -230,6 +250,11 @@ void vtkPVProgressHandler::CleanupPendingProgress()
 {
   SKIP_IF_DISABLED();
 
+  for (const auto& message : this->Internals->TakePendingMessages())
+  {
+    this->RefreshMessage(message.first.c_str(), message.second, /*is_local*/ true);
+  }
+
   if (!this->Internals->EnableProgress)
   {
 #ifndef NDEBUG
@@ -305,7 +330,8 @@ void vtkPVProgressHandler::LocalCleanupPendingProgress()
 void vtkPVProgressHandler::OnProgressEvent(vtkObject* caller, unsigned long eventid, void* calldata)
 {
   SKIP_IF_DISABLED();
-  if (!this->Internals->EnableProgress || eventid != vtkCommand::ProgressEvent)
+  if (!this->Internals->EnableProgress || eventid != vtkCommand::ProgressEvent ||
+    !this->Internals->IsMainThread())
   {
     return;
   }
@@ -463,6 +489,20 @@ void vtkPVProgressHandler::OnMessageEvent(vtkObject*, unsigned long eventid, voi
     case vtkCommand::MessageEvent:
     case vtkCommand::ErrorEvent:
     case vtkCommand::TextEvent:
+      if (!this->Internals->IsMainThread())
+      {
+        if (calldata)
+        {
+          std::lock_guard<std::mutex> lock(this->Internals->PendingMessagesMutex);
+          this->Internals->PendingMessages.emplace_back(
+            reinterpret_cast<const char*>(calldata), static_cast<int>(eventid));
+        }
+        break;
+      }
+      for (const auto& message : this->Internals->TakePendingMessages())
+      {
+        this->RefreshMessage(message.first.c_str(), message.second, /*is_local*/ true);
+      }
       this->RefreshMessage(reinterpret_cast<const char*>(calldata), eventid, /*is_local*/ true);
       break;
   }
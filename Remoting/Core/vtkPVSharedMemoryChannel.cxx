@@ -0,0 +1,1097 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVSharedMemoryChannel.h"
+
+#include "vtkCallbackCommand.h"
+#include "vtkCharArray.h"
+#include "vtkCommand.h"
+#include "vtkCommunicator.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkCompositeMultiProcessController.h"
+#include "vtkDataArray.h"
+#include "vtkDataObject.h"
+#include "vtkLogger.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <new>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <csignal>
+#include <ctime>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED 1
+#else
+#define VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED 0
+#endif
+
+namespace
+{
+std::atomic<bool> Enabled{ vtksys::SystemTools::GetEnv("PV_DISABLE_SHARED_MEMORY_TRANSPORT") ==
+  nullptr };
+std::atomic<size_t> DefaultBufferSize{ 8 * 1024 * 1024 };
+std::atomic<size_t> MinimumPayloadSize{ 64 * 1024 };
+
+// Header sent over the socket before a data object or an array when the
+// controller has a channel.
+enum PayloadLocation : vtkTypeInt64
+{
+  PAYLOAD_IN_SOCKET = 0,
+  PAYLOAD_IN_CHANNEL = 1
+};
+
+std::mutex ChannelsMutex;
+std::map<vtkMultiProcessController*, vtkSmartPointer<vtkPVSharedMemoryChannel>>& GetChannels()
+{
+  static std::map<vtkMultiProcessController*, vtkSmartPointer<vtkPVSharedMemoryChannel>> channels;
+  return channels;
+}
+
+void OnControllerDeleted(vtkObject* caller, unsigned long, void*, void*)
+{
+  vtkSmartPointer<vtkPVSharedMemoryChannel> channel;
+  {
+    std::lock_guard<std::mutex> lock(ChannelsMutex);
+    auto& channels = GetChannels();
+    auto iter = channels.find(static_cast<vtkMultiProcessController*>(caller));
+    if (iter == channels.end())
+    {
+      return;
+    }
+    channel = iter->second;
+    channels.erase(iter);
+  }
+  channel->Close();
+}
+
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+constexpr vtkTypeUInt64 SegmentMagic = 0x5056534d43484e31ull; // "PVSMCHN1"
+constexpr size_t SegmentAlignment = 64;
+
+size_t aligned(size_t size)
+{
+  return (size + SegmentAlignment - 1) & ~(SegmentAlignment - 1);
+}
+
+// One direction of the channel. `Head` and `Tail` count the bytes written and
+// read so far; both are protected by `Mutex`.
+struct RingHeader
+{
+  vtkTypeUInt64 Head;
+  vtkTypeUInt64 Tail;
+  pthread_mutex_t Mutex;
+  pthread_cond_t NotEmpty;
+  pthread_cond_t NotFull;
+};
+
+struct SegmentHeader
+{
+  std::atomic<vtkTypeUInt64> Magic;
+  vtkTypeUInt64 Token;
+  // sizes of Rings[0] and Rings[1].
+  vtkTypeUInt64 BufferSizes[2];
+  vtkTypeUInt64 MinimumPayloadSize;
+  std::atomic<int> Closed;
+  // process ids of the creator and of the opener, which is 0 until the
+  // segment is opened.
+  pid_t Processes[2];
+  // Rings[0] goes from the creator to the opener, Rings[1] the other way.
+  RingHeader Rings[2];
+};
+
+/**
+ * Locks a ring mutex for the lifetime of the object. The mutexes are robust:
+ * if the other process died while holding one, `IsValid()` returns false.
+ */
+class RingLock
+{
+public:
+  explicit RingLock(RingHeader* ring)
+    : Ring(ring)
+  {
+    int status = pthread_mutex_lock(&this->Ring->Mutex);
+    if (status == EOWNERDEAD)
+    {
+      pthread_mutex_consistent(&this->Ring->Mutex);
+      this->OwnerDied = true;
+    }
+  }
+  ~RingLock() { pthread_mutex_unlock(&this->Ring->Mutex); }
+
+  bool IsValid() const { return !this->OwnerDied; }
+
+  // Waits on `cond` for at most a second.
+  void Wait(pthread_cond_t* cond)
+  {
+    timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += 1;
+    if (pthread_cond_timedwait(cond, &this->Ring->Mutex, &deadline) == EOWNERDEAD)
+    {
+      pthread_mutex_consistent(&this->Ring->Mutex);
+      this->OwnerDied = true;
+    }
+  }
+
+private:
+  RingLock(const RingLock&) = delete;
+  void operator=(const RingLock&) = delete;
+
+  RingHeader* Ring;
+  bool OwnerDied = false;
+};
+
+bool IsProcessAlive(pid_t pid)
+{
+  return pid > 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+#endif
+
+vtkPVSharedMemoryChannel* GetChannelForPayload(
+  vtkMultiProcessController* controller, vtkTypeUInt64 length)
+{
+  vtkPVSharedMemoryChannel* channel = vtkPVSharedMemoryChannel::GetChannel(controller);
+  return channel && length >= channel->GetMinimumPayloadSizeOfSegment() ? channel : nullptr;
+}
+}
+
+class vtkPVSharedMemoryChannel::vtkInternals
+{
+public:
+  std::string Name;
+  vtkTypeUInt64 Token = 0;
+  bool Creator = false;
+  bool Linked = false;
+  int FileDescriptor = -1;
+  void* Memory = nullptr;
+  size_t Length = 0;
+  double Timeout = 0.0;
+  // set once the other end is known to be gone, so that later transfers fail
+  // right away.
+  bool PeerGone = false;
+
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  SegmentHeader* Header() const { return static_cast<SegmentHeader*>(this->Memory); }
+
+  size_t Index(bool outgoing) const { return outgoing == this->Creator ? 0 : 1; }
+
+  RingHeader* Ring(bool outgoing) const { return &this->Header()->Rings[this->Index(outgoing)]; }
+
+  vtkTypeUInt64 Capacity(bool outgoing) const
+  {
+    return this->Header()->BufferSizes[this->Index(outgoing)];
+  }
+
+  char* Buffer(bool outgoing) const
+  {
+    return static_cast<char*>(this->Memory) + aligned(sizeof(SegmentHeader)) +
+      (this->Index(outgoing) == 0 ? 0 : this->Header()->BufferSizes[0]);
+  }
+
+  /**
+   * Returns false once the other end closed the segment or died, or if it did
+   * not open the segment before `deadline`.
+   */
+  bool IsPeerAvailable(const std::chrono::steady_clock::time_point& deadline) const
+  {
+    const auto header = this->Header();
+    if (header->Closed.load())
+    {
+      return false;
+    }
+    const pid_t peer = header->Processes[this->Creator ? 1 : 0];
+    return peer == 0 ? std::chrono::steady_clock::now() < deadline : ::IsProcessAlive(peer);
+  }
+
+  std::chrono::steady_clock::time_point GetDeadline() const
+  {
+    return std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(static_cast<long long>(std::max(this->Timeout, 0.0) * 1000));
+  }
+
+  /**
+   * Waits until at least `minimum` bytes can be written to the outgoing ring
+   * buffer or read from the incoming one. Returns the number of bytes and
+   * sets `position` to the write or read position, or returns 0 once the
+   * other end is gone.
+   */
+  vtkTypeUInt64 Wait(bool outgoing, vtkTypeUInt64 minimum, vtkTypeUInt64& position)
+  {
+    if (this->PeerGone)
+    {
+      return 0;
+    }
+    RingHeader* ring = this->Ring(outgoing);
+    const vtkTypeUInt64 capacity = this->Capacity(outgoing);
+    auto count = [&]() {
+      return outgoing ? capacity - (ring->Head - ring->Tail) : ring->Head - ring->Tail;
+    };
+
+    const auto deadline = this->GetDeadline();
+    RingLock lock(ring);
+    vtkTypeUInt64 available = count();
+    while (lock.IsValid() && available < minimum && this->IsPeerAvailable(deadline))
+    {
+      lock.Wait(outgoing ? &ring->NotFull : &ring->NotEmpty);
+      available = count();
+    }
+    if (!lock.IsValid() || available < minimum)
+    {
+      this->PeerGone = true;
+      return 0;
+    }
+    position = outgoing ? ring->Head : ring->Tail;
+    return available;
+  }
+
+  // Makes `length` bytes written available to the reader, or read available
+  // to the writer.
+  void Advance(bool outgoing, vtkTypeUInt64 length)
+  {
+    RingHeader* ring = this->Ring(outgoing);
+    RingLock lock(ring);
+    if (outgoing)
+    {
+      ring->Head += length;
+      pthread_cond_signal(&ring->NotEmpty);
+    }
+    else
+    {
+      ring->Tail += length;
+      pthread_cond_signal(&ring->NotFull);
+    }
+  }
+
+  bool Map(int fd, size_t length)
+  {
+    void* memory = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED)
+    {
+      return false;
+    }
+    this->FileDescriptor = fd;
+    this->Memory = memory;
+    this->Length = length;
+    return true;
+  }
+
+  void Unmap()
+  {
+    if (this->Memory != nullptr)
+    {
+      munmap(this->Memory, this->Length);
+    }
+    if (this->FileDescriptor >= 0)
+    {
+      close(this->FileDescriptor);
+    }
+    this->FileDescriptor = -1;
+    this->Memory = nullptr;
+    this->Length = 0;
+  }
+
+  /**
+   * Maps the segment `name`, waiting up to `timeout` seconds for it to be
+   * created and initialized.
+   */
+  bool MapExisting(const std::string& name, double timeout)
+  {
+    const auto deadline = std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(static_cast<long long>(std::max(timeout, 0.0) * 1000));
+    const auto retry = std::chrono::milliseconds(100);
+    while (true)
+    {
+      int fd = shm_open(name.c_str(), O_RDWR, 0600);
+      struct stat info;
+      // the segment may exist before its creator reserved its memory.
+      if (fd >= 0 && fstat(fd, &info) == 0 &&
+        static_cast<size_t>(info.st_size) >= aligned(sizeof(SegmentHeader)))
+      {
+        if (!this->Map(fd, static_cast<size_t>(info.st_size)))
+        {
+          close(fd);
+          return false;
+        }
+        if (this->Header()->Magic.load(std::memory_order_acquire) == SegmentMagic)
+        {
+          return true;
+        }
+        this->Unmap();
+      }
+      else if (fd >= 0)
+      {
+        close(fd);
+      }
+      if (std::chrono::steady_clock::now() >= deadline)
+      {
+        return false;
+      }
+      std::this_thread::sleep_for(retry);
+    }
+  }
+#endif
+};
+
+vtkStandardNewMacro(vtkPVSharedMemoryChannel);
+//----------------------------------------------------------------------------
+vtkPVSharedMemoryChannel::vtkPVSharedMemoryChannel()
+  : Internals(new vtkPVSharedMemoryChannel::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVSharedMemoryChannel::~vtkPVSharedMemoryChannel()
+{
+  this->Close();
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::IsSupported()
+{
+  return VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED != 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::SetEnabled(bool enabled)
+{
+  ::Enabled = enabled;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::GetEnabled()
+{
+  return ::Enabled && vtkPVSharedMemoryChannel::IsSupported();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::SetDefaultBufferSize(size_t size)
+{
+  ::DefaultBufferSize = size;
+}
+
+//----------------------------------------------------------------------------
+size_t vtkPVSharedMemoryChannel::GetDefaultBufferSize()
+{
+  return ::DefaultBufferSize;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::SetMinimumPayloadSize(size_t size)
+{
+  ::MinimumPayloadSize = size;
+}
+
+//----------------------------------------------------------------------------
+size_t vtkPVSharedMemoryChannel::GetMinimumPayloadSize()
+{
+  return ::MinimumPayloadSize;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::Create(size_t bufferSize)
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  static std::atomic<int> counter{ 0 };
+  std::ostringstream name;
+  name << "/paraview-" << getpid() << "-" << counter++;
+  return this->Create(name.str(), bufferSize, bufferSize);
+#else
+  (void)bufferSize;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::Create(
+  const std::string& name, size_t bufferSize, size_t returnBufferSize)
+{
+  this->Close();
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (bufferSize == 0)
+  {
+    vtkErrorMacro("Invalid buffer size.");
+    return false;
+  }
+
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0 && errno == EEXIST)
+  {
+    // left behind by a process that did not close it.
+    vtkWarningMacro("Replacing existing shared-memory segment '" << name << "'.");
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  }
+  if (fd < 0)
+  {
+    vtkWarningMacro(
+      "Failed to create shared-memory segment '" << name << "': " << std::strerror(errno));
+    return false;
+  }
+
+  // the memory of the segment is reserved up front: pages of a shared-memory
+  // file system are otherwise only allocated when first touched, and a full
+  // file system (e.g. a container's small /dev/shm) would then kill the
+  // process with SIGBUS in the middle of a transfer.
+  bufferSize = aligned(bufferSize);
+  returnBufferSize = aligned(returnBufferSize);
+  const size_t length = aligned(sizeof(SegmentHeader)) + bufferSize + returnBufferSize;
+  const int status = posix_fallocate(fd, 0, static_cast<off_t>(length));
+  if (status != 0 || !internals.Map(fd, length))
+  {
+    vtkWarningMacro("Failed to reserve " << length << " bytes for shared-memory segment '" << name
+                                         << "': " << std::strerror(status ? status : errno));
+    close(fd);
+    shm_unlink(name.c_str());
+    return false;
+  }
+
+  std::random_device device;
+  std::uniform_int_distribution<vtkTypeUInt64> distribution;
+  internals.Name = name;
+  internals.Token = distribution(device);
+  internals.Creator = true;
+  internals.Linked = true;
+
+  auto header = new (internals.Memory) SegmentHeader();
+  header->Token = internals.Token;
+  header->BufferSizes[0] = bufferSize;
+  header->BufferSizes[1] = returnBufferSize;
+  header->MinimumPayloadSize = ::MinimumPayloadSize;
+  header->Closed = 0;
+  header->Processes[0] = getpid();
+  header->Processes[1] = 0;
+
+  pthread_mutexattr_t mattr;
+  pthread_mutexattr_init(&mattr);
+  pthread_mutexattr_setpshared(&mattr, PTHREAD_PROCESS_SHARED);
+  pthread_mutexattr_setrobust(&mattr, PTHREAD_MUTEX_ROBUST);
+  pthread_condattr_t cattr;
+  pthread_condattr_init(&cattr);
+  pthread_condattr_setpshared(&cattr, PTHREAD_PROCESS_SHARED);
+  for (auto& ring : header->Rings)
+  {
+    ring.Head = 0;
+    ring.Tail = 0;
+    pthread_mutex_init(&ring.Mutex, &mattr);
+    pthread_cond_init(&ring.NotEmpty, &cattr);
+    pthread_cond_init(&ring.NotFull, &cattr);
+  }
+  pthread_condattr_destroy(&cattr);
+  pthread_mutexattr_destroy(&mattr);
+
+  // published last: the opener does not touch the header before seeing it.
+  header->Magic.store(SegmentMagic, std::memory_order_release);
+  return true;
+#else
+  (void)name;
+  (void)bufferSize;
+  (void)returnBufferSize;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::Open(const std::string& name, vtkTypeUInt64 token)
+{
+  this->Close();
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  // fails when the other process runs on another host.
+  if (!internals.MapExisting(name, 0.0))
+  {
+    return false;
+  }
+
+  auto header = internals.Header();
+  if (header->Token != token ||
+    internals.Length <
+      aligned(sizeof(SegmentHeader)) + header->BufferSizes[0] + header->BufferSizes[1] ||
+    !::IsProcessAlive(header->Processes[0]))
+  {
+    // not the segment created by the other end of the connection, or its
+    // creator is not visible from this process: leave it untouched.
+    internals.Unmap();
+    return false;
+  }
+
+  header->Processes[1] = getpid();
+  internals.Name = name;
+  internals.Token = token;
+  internals.Creator = false;
+  return true;
+#else
+  (void)name;
+  (void)token;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::WaitAndOpen(const std::string& name, double timeout)
+{
+  this->Close();
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (!internals.MapExisting(name, timeout))
+  {
+    vtkErrorMacro("Timed out waiting for shared-memory segment '" << name << "'.");
+    return false;
+  }
+
+  auto header = internals.Header();
+  bool stale = internals.Length <
+    aligned(sizeof(SegmentHeader)) + header->BufferSizes[0] + header->BufferSizes[1];
+  if (!stale)
+  {
+    RingLock lock(&header->Rings[0]);
+    stale = !lock.IsValid() || header->Closed.load() || !::IsProcessAlive(header->Processes[0]);
+    if (!stale)
+    {
+      header->Processes[1] = getpid();
+    }
+  }
+  if (stale)
+  {
+    vtkErrorMacro("Shared-memory segment '" << name << "' was left by a process that is gone.");
+    internals.Unmap();
+    return false;
+  }
+  internals.Name = name;
+  internals.Token = header->Token;
+  internals.Creator = false;
+  return true;
+#else
+  (void)name;
+  (void)timeout;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::Unlink()
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (internals.Linked)
+  {
+    shm_unlink(internals.Name.c_str());
+    internals.Linked = false;
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::Close()
+{
+  auto& internals = *this->Internals;
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  this->Unlink();
+  if (internals.Memory != nullptr)
+  {
+    auto header = internals.Header();
+    if (header->Magic.load(std::memory_order_acquire) == SegmentMagic)
+    {
+      // wake up the other end, so that it fails instead of waiting.
+      header->Closed = 1;
+      for (auto& ring : header->Rings)
+      {
+        RingLock lock(&ring);
+        pthread_cond_broadcast(&ring.NotEmpty);
+        pthread_cond_broadcast(&ring.NotFull);
+      }
+    }
+  }
+  internals.Unmap();
+#endif
+  internals.Name.clear();
+  internals.Token = 0;
+  internals.Creator = false;
+  internals.Linked = false;
+  internals.PeerGone = false;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::IsOpen() const
+{
+  return this->Internals->Memory != nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::IsConnected() const
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  return this->IsOpen() &&
+    this->Internals->IsPeerAvailable(std::chrono::steady_clock::now());
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+const std::string& vtkPVSharedMemoryChannel::GetName() const
+{
+  return this->Internals->Name;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVSharedMemoryChannel::GetToken() const
+{
+  return this->Internals->Token;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVSharedMemoryChannel::GetMinimumPayloadSizeOfSegment() const
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  return this->IsOpen() ? this->Internals->Header()->MinimumPayloadSize : 0;
+#else
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::SetTimeout(double timeout)
+{
+  this->Internals->Timeout = timeout;
+}
+
+//----------------------------------------------------------------------------
+double vtkPVSharedMemoryChannel::GetTimeout() const
+{
+  return this->Internals->Timeout;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::Write(const void* data, size_t length)
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (!this->IsOpen())
+  {
+    vtkErrorMacro("No shared-memory segment open.");
+    return false;
+  }
+
+  char* buffer = internals.Buffer(true);
+  const vtkTypeUInt64 capacity = internals.Capacity(true);
+  auto in = static_cast<const char*>(data);
+  while (length > 0)
+  {
+    vtkTypeUInt64 head;
+    const vtkTypeUInt64 space = capacity > 0 ? internals.Wait(true, 1, head) : 0;
+    if (space == 0)
+    {
+      vtkErrorMacro("The other end of shared-memory channel '" << internals.Name
+                                                               << "' is gone.");
+      return false;
+    }
+
+    // the reader does not read these bytes before `Head` moves past them, so
+    // they can be written without holding the lock.
+    const size_t offset = static_cast<size_t>(head % capacity);
+    const size_t chunk = static_cast<size_t>(
+      std::min<vtkTypeUInt64>({ static_cast<vtkTypeUInt64>(length), space, capacity - offset }));
+    std::memcpy(buffer + offset, in, chunk);
+    in += chunk;
+    length -= chunk;
+    internals.Advance(true, chunk);
+  }
+  return true;
+#else
+  (void)data;
+  (void)length;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::Read(void* data, size_t length)
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (!this->IsOpen())
+  {
+    vtkErrorMacro("No shared-memory segment open.");
+    return false;
+  }
+
+  const char* buffer = internals.Buffer(false);
+  const vtkTypeUInt64 capacity = internals.Capacity(false);
+  auto out = static_cast<char*>(data);
+  while (length > 0)
+  {
+    vtkTypeUInt64 tail;
+    const vtkTypeUInt64 available = capacity > 0 ? internals.Wait(false, 1, tail) : 0;
+    if (available == 0)
+    {
+      vtkErrorMacro("The other end of shared-memory channel '" << internals.Name
+                                                               << "' is gone.");
+      return false;
+    }
+
+    const size_t offset = static_cast<size_t>(tail % capacity);
+    const size_t chunk = static_cast<size_t>(std::min<vtkTypeUInt64>(
+      { static_cast<vtkTypeUInt64>(length), available, capacity - offset }));
+    std::memcpy(out, buffer + offset, chunk);
+    out += chunk;
+    length -= chunk;
+    internals.Advance(false, chunk);
+  }
+  return true;
+#else
+  (void)data;
+  (void)length;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void* vtkPVSharedMemoryChannel::BeginWrite(size_t length)
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (!this->IsOpen())
+  {
+    vtkErrorMacro("No shared-memory segment open.");
+    return nullptr;
+  }
+  const vtkTypeUInt64 capacity = internals.Capacity(true);
+  if (length == 0 || length > capacity)
+  {
+    vtkErrorMacro("Cannot write " << length << " bytes at once to a ring buffer of " << capacity
+                                  << " bytes.");
+    return nullptr;
+  }
+
+  vtkTypeUInt64 head;
+  if (internals.Wait(true, length, head) == 0)
+  {
+    vtkErrorMacro("The other end of shared-memory channel '" << internals.Name << "' is gone.");
+    return nullptr;
+  }
+  const size_t offset = static_cast<size_t>(head % capacity);
+  if (offset + length > capacity)
+  {
+    vtkErrorMacro("Cannot write " << length << " bytes across the end of the ring buffer.");
+    return nullptr;
+  }
+  return internals.Buffer(true) + offset;
+#else
+  (void)length;
+  return nullptr;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::EndWrite(size_t length)
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  if (this->IsOpen())
+  {
+    this->Internals->Advance(true, length);
+  }
+#else
+  (void)length;
+#endif
+}
+
+//----------------------------------------------------------------------------
+const void* vtkPVSharedMemoryChannel::BeginRead(size_t length)
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (!this->IsOpen())
+  {
+    vtkErrorMacro("No shared-memory segment open.");
+    return nullptr;
+  }
+  const vtkTypeUInt64 capacity = internals.Capacity(false);
+  if (length == 0 || length > capacity)
+  {
+    vtkErrorMacro("Cannot read " << length << " bytes at once from a ring buffer of " << capacity
+                                 << " bytes.");
+    return nullptr;
+  }
+
+  vtkTypeUInt64 tail;
+  if (internals.Wait(false, length, tail) == 0)
+  {
+    vtkErrorMacro("The other end of shared-memory channel '" << internals.Name << "' is gone.");
+    return nullptr;
+  }
+  const size_t offset = static_cast<size_t>(tail % capacity);
+  if (offset + length > capacity)
+  {
+    vtkErrorMacro("Cannot read " << length << " bytes across the end of the ring buffer.");
+    return nullptr;
+  }
+  return internals.Buffer(false) + offset;
+#else
+  (void)length;
+  return nullptr;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::EndRead(size_t length)
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  if (this->IsOpen())
+  {
+    this->Internals->Advance(false, length);
+  }
+#else
+  (void)length;
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVSharedMemoryChannel::WaitUntilRead()
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  auto& internals = *this->Internals;
+  if (!this->IsOpen())
+  {
+    return false;
+  }
+  const vtkTypeUInt64 capacity = internals.Capacity(true);
+  vtkTypeUInt64 head;
+  if (capacity == 0 || internals.Wait(true, capacity, head) == 0)
+  {
+    vtkErrorMacro("The other end of shared-memory channel '" << internals.Name << "' is gone.");
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+vtkTypeUInt64 vtkPVSharedMemoryChannel::GetBufferSize(bool outgoing) const
+{
+#if VTK_PV_SHARED_MEMORY_CHANNEL_SUPPORTED
+  return this->IsOpen() ? this->Internals->Capacity(outgoing) : 0;
+#else
+  (void)outgoing;
+  return 0;
+#endif
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::Attach(
+  vtkMultiProcessController* controller, vtkPVSharedMemoryChannel* channel)
+{
+  if (!controller)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(::ChannelsMutex);
+  auto& channels = ::GetChannels();
+  auto iter = channels.find(controller);
+  if (iter == channels.end() && channel)
+  {
+    vtkNew<vtkCallbackCommand> observer;
+    observer->SetCallback(&::OnControllerDeleted);
+    controller->AddObserver(vtkCommand::DeleteEvent, observer);
+  }
+  if (channel)
+  {
+    channels[controller] = channel;
+  }
+  else if (iter != channels.end())
+  {
+    channels.erase(iter);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkPVSharedMemoryChannel* vtkPVSharedMemoryChannel::GetChannel(
+  vtkMultiProcessController* controller)
+{
+  // in collaboration, messages go to the active client.
+  if (auto composite = vtkCompositeMultiProcessController::SafeDownCast(controller))
+  {
+    controller = composite->GetActiveController();
+  }
+
+  std::lock_guard<std::mutex> lock(::ChannelsMutex);
+  auto& channels = ::GetChannels();
+  auto iter = controller ? channels.find(controller) : channels.end();
+  return iter != channels.end() ? iter->second.GetPointer() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVSharedMemoryChannel::Send(
+  vtkMultiProcessController* controller, const char* data, vtkIdType length, int remoteId, int tag)
+{
+  if (auto channel = ::GetChannelForPayload(controller, static_cast<vtkTypeUInt64>(length)))
+  {
+    return channel->Write(data, static_cast<size_t>(length)) ? 1 : 0;
+  }
+  return controller->Send(data, length, remoteId, tag);
+}
+
+//----------------------------------------------------------------------------
+int vtkPVSharedMemoryChannel::Receive(
+  vtkMultiProcessController* controller, char* data, vtkIdType length, int remoteId, int tag)
+{
+  if (auto channel = ::GetChannelForPayload(controller, static_cast<vtkTypeUInt64>(length)))
+  {
+    return channel->Read(data, static_cast<size_t>(length)) ? 1 : 0;
+  }
+  return controller->Receive(data, length, remoteId, tag);
+}
+
+//----------------------------------------------------------------------------
+int vtkPVSharedMemoryChannel::Send(
+  vtkMultiProcessController* controller, vtkDataObject* data, int remoteId, int tag)
+{
+  vtkPVSharedMemoryChannel* channel = vtkPVSharedMemoryChannel::GetChannel(controller);
+  if (!channel)
+  {
+    return controller->Send(data, remoteId, tag);
+  }
+
+  // composite datasets are sent block by block by the controller; other data
+  // objects are marshaled the same way the controller does.
+  vtkNew<vtkCharArray> buffer;
+  vtkTypeInt64 header[2] = { PAYLOAD_IN_SOCKET, 0 };
+  if (data && !vtkCompositeDataSet::SafeDownCast(data) &&
+    static_cast<vtkTypeUInt64>(data->GetActualMemorySize()) * 1024 >=
+      channel->GetMinimumPayloadSizeOfSegment() &&
+    vtkCommunicator::MarshalDataObject(data, buffer))
+  {
+    header[0] = PAYLOAD_IN_CHANNEL;
+    header[1] = static_cast<vtkTypeInt64>(buffer->GetNumberOfValues());
+  }
+  if (!controller->Send(header, 2, remoteId, tag))
+  {
+    return 0;
+  }
+  if (header[0] == PAYLOAD_IN_SOCKET)
+  {
+    return controller->Send(data, remoteId, tag);
+  }
+  return channel->Write(buffer->GetPointer(0), static_cast<size_t>(header[1])) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkPVSharedMemoryChannel::ReceiveDataObject(
+  vtkMultiProcessController* controller, int remoteId, int tag)
+{
+  vtkPVSharedMemoryChannel* channel = vtkPVSharedMemoryChannel::GetChannel(controller);
+  vtkTypeInt64 header[2] = { PAYLOAD_IN_SOCKET, 0 };
+  if (channel && !controller->Receive(header, 2, remoteId, tag))
+  {
+    return nullptr;
+  }
+  if (header[0] == PAYLOAD_IN_SOCKET)
+  {
+    return vtk::TakeSmartPointer(controller->ReceiveDataObject(remoteId, tag));
+  }
+
+  vtkNew<vtkCharArray> buffer;
+  buffer->SetNumberOfValues(static_cast<vtkIdType>(header[1]));
+  if (!channel->Read(buffer->GetPointer(0), static_cast<size_t>(header[1])))
+  {
+    return nullptr;
+  }
+  return vtkCommunicator::UnMarshalDataObject(buffer);
+}
+
+//----------------------------------------------------------------------------
+int vtkPVSharedMemoryChannel::Send(
+  vtkMultiProcessController* controller, vtkDataArray* data, int remoteId, int tag)
+{
+  vtkPVSharedMemoryChannel* channel = vtkPVSharedMemoryChannel::GetChannel(controller);
+  if (!channel)
+  {
+    return controller->Send(data, remoteId, tag);
+  }
+
+  const vtkTypeUInt64 bytes = data
+    ? static_cast<vtkTypeUInt64>(data->GetNumberOfValues()) * data->GetDataTypeSize()
+    : 0;
+  vtkTypeInt64 header[4] = { PAYLOAD_IN_SOCKET, 0, 0, 0 };
+  if (bytes > 0 && bytes >= channel->GetMinimumPayloadSizeOfSegment())
+  {
+    header[0] = PAYLOAD_IN_CHANNEL;
+    header[1] = data->GetDataType();
+    header[2] = data->GetNumberOfTuples();
+    header[3] = data->GetNumberOfComponents();
+  }
+  if (!controller->Send(header, 4, remoteId, tag))
+  {
+    return 0;
+  }
+  if (header[0] == PAYLOAD_IN_SOCKET)
+  {
+    return controller->Send(data, remoteId, tag);
+  }
+  return channel->Write(data->GetVoidPointer(0), static_cast<size_t>(bytes)) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVSharedMemoryChannel::Receive(
+  vtkMultiProcessController* controller, vtkDataArray* data, int remoteId, int tag)
+{
+  vtkPVSharedMemoryChannel* channel = vtkPVSharedMemoryChannel::GetChannel(controller);
+  vtkTypeInt64 header[4] = { PAYLOAD_IN_SOCKET, 0, 0, 0 };
+  if (channel && !controller->Receive(header, 4, remoteId, tag))
+  {
+    return 0;
+  }
+  if (header[0] == PAYLOAD_IN_SOCKET)
+  {
+    return controller->Receive(data, remoteId, tag);
+  }
+
+  const size_t bytes = static_cast<size_t>(header[2] * header[3]) *
+    static_cast<size_t>(vtkAbstractArray::GetDataTypeSize(static_cast<int>(header[1])));
+  if (!data || data->GetDataType() != header[1])
+  {
+    // the payload must be read even if it cannot be stored, to keep the
+    // channel usable.
+    std::vector<char> discarded(bytes);
+    channel->Read(discarded.data(), bytes);
+    vtkLogF(ERROR, "received an array of a different type than expected.");
+    return 0;
+  }
+  data->SetNumberOfComponents(static_cast<int>(header[3]));
+  data->SetNumberOfTuples(static_cast<vtkIdType>(header[2]));
+  return channel->Read(data->GetVoidPointer(0), bytes) ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVSharedMemoryChannel::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Name: " << this->Internals->Name << endl;
+  os << indent << "Creator: " << this->Internals->Creator << endl;
+  os << indent << "Open: " << this->IsOpen() << endl;
+  os << indent << "Timeout: " << this->Internals->Timeout << endl;
+  os << indent << "MinimumPayloadSizeOfSegment: " << this->GetMinimumPayloadSizeOfSegment()
+     << endl;
+}
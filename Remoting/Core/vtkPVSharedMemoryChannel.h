@@ -0,0 +1,272 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPVSharedMemoryChannel
+ * @brief   shared-memory side channel for a socket connection between two
+ * processes on the same host.
+ *
+ * vtkPVSharedMemoryChannel holds a POSIX shared-memory segment with two ring
+ * buffers, one per direction, shared by the two ends of a socket connection.
+ * vtkTCPNetworkAccessManager creates one when a connection is established and
+ * both processes turn out to run on the same host: the accepting process
+ * creates the segment and sends its name and a random token over the socket;
+ * the connecting process can only open it and read the token back if it runs
+ * on the same host. The channel is then attached to the controller of the
+ * connection with `Attach()`.
+ *
+ * The socket is still used for all the control messages. Large payloads, such
+ * as the data objects delivered by vtkClientServerMoveData or the images
+ * delivered by vtkPVClientServerSynchronizedRenderers, go through the ring
+ * buffers using the static `Send()` and `Receive()` methods: a small header
+ * sent over the socket announces the payload, which is then streamed through
+ * the ring buffer instead of being copied through the socket. When the
+ * controller has no channel, these methods are equivalent to the matching
+ * vtkMultiProcessController methods.
+ *
+ * A channel can also be used on its own between two processes agreeing on a
+ * segment name, as vtkCatalystInTransitBuffer does: one creates it with
+ * `Create(name, ...)`, the other waits for it with `WaitAndOpen()`.
+ * `BeginWrite()`/`BeginRead()` then give direct access to the ring buffers.
+ *
+ * The memory of a segment is reserved when it is created, so that running out
+ * of shared memory fails `Create()`, and the connection keeps using the
+ * socket, instead of killing the process in the middle of a transfer.
+ *
+ * Shared-memory channels are only supported on Linux. They can be disabled
+ * with `SetEnabled(false)` or by setting the `PV_DISABLE_SHARED_MEMORY_TRANSPORT`
+ * environment variable, in either process.
+ */
+
+#ifndef vtkPVSharedMemoryChannel_h
+#define vtkPVSharedMemoryChannel_h
+
+#include "vtkObject.h"
+#include "vtkRemotingCoreModule.h" //needed for exports
+#include "vtkSmartPointer.h"       // for vtkSmartPointer
+
+#include <cstddef> // for size_t
+#include <memory>  // for std::unique_ptr
+#include <string>  // for std::string
+
+class vtkDataArray;
+class vtkDataObject;
+class vtkMultiProcessController;
+
+class VTKREMOTINGCORE_EXPORT vtkPVSharedMemoryChannel : public vtkObject
+{
+public:
+  static vtkPVSharedMemoryChannel* New();
+  vtkTypeMacro(vtkPVSharedMemoryChannel, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns true if shared-memory channels are supported on this platform.
+   */
+  static bool IsSupported();
+
+  ///@{
+  /**
+   * Enable/disable the use of shared-memory channels for new connections.
+   * Enabled by default unless the `PV_DISABLE_SHARED_MEMORY_TRANSPORT`
+   * environment variable is set.
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  ///@{
+  /**
+   * Size, in bytes, of the ring buffer used for each direction of a new
+   * channel. Defaults to 8 MiB. Payloads larger than a ring buffer are
+   * streamed through it.
+   */
+  static void SetDefaultBufferSize(size_t size);
+  static size_t GetDefaultBufferSize();
+  ///@}
+
+  ///@{
+  /**
+   * Payloads smaller than this number of bytes are sent through the socket.
+   * Defaults to 64 KiB.
+   */
+  static void SetMinimumPayloadSize(size_t size);
+  static size_t GetMinimumPayloadSize();
+  ///@}
+
+  /**
+   * Creates a new segment with a ring buffer of `bufferSize` bytes per
+   * direction. The name of the segment and the token to check when opening it
+   * are returned by `GetName()` and `GetToken()`.
+   */
+  bool Create(size_t bufferSize);
+
+  /**
+   * Creates a new segment named `name`, with a ring buffer of `bufferSize`
+   * bytes going out of this process and one of `returnBufferSize` bytes,
+   * possibly 0, coming into it. A segment of the same name left behind by
+   * another process is replaced. Returns false if the memory of the segment
+   * cannot be reserved.
+   */
+  bool Create(const std::string& name, size_t bufferSize, size_t returnBufferSize);
+
+  /**
+   * Opens a segment created by `Create()` in another process. Fails if the
+   * segment does not exist or does not hold `token`, i.e. if the other
+   * process runs on another host.
+   */
+  bool Open(const std::string& name, vtkTypeUInt64 token);
+
+  /**
+   * Opens the segment `name` created by `Create()` in another process,
+   * waiting up to `timeout` seconds for it to be created. Fails if the
+   * process which created it is gone.
+   */
+  bool WaitAndOpen(const std::string& name, double timeout);
+
+  /**
+   * Removes the name of the segment, once both processes have opened it, so
+   * that it does not outlive them. The segment stays mapped until `Close()`.
+   */
+  void Unlink();
+
+  /**
+   * Releases the segment. The other end fails its pending and future
+   * transfers. Does nothing if none is open.
+   */
+  void Close();
+
+  /**
+   * Returns true if a segment is open.
+   */
+  bool IsOpen() const;
+
+  /**
+   * Returns true if the other process opened the segment, is still alive and
+   * did not close it.
+   */
+  bool IsConnected() const;
+
+  ///@{
+  /**
+   * Name and token of the open segment.
+   */
+  const std::string& GetName() const;
+  vtkTypeUInt64 GetToken() const;
+  ///@}
+
+  /**
+   * Returns the minimum payload size used by both ends of the open segment,
+   * set from `GetMinimumPayloadSize()` by the process which created it.
+   */
+  vtkTypeUInt64 GetMinimumPayloadSizeOfSegment() const;
+
+  /**
+   * Returns the size of the ring buffer going out of (`outgoing`) or coming
+   * into this process, or 0 if no segment is open.
+   */
+  vtkTypeUInt64 GetBufferSize(bool outgoing) const;
+
+  ///@{
+  /**
+   * Number of seconds writers wait for the other process to open the segment
+   * before failing. Once the other end is known to be gone, transfers fail
+   * right away. Defaults to 0.
+   */
+  void SetTimeout(double timeout);
+  double GetTimeout() const;
+  ///@}
+
+  ///@{
+  /**
+   * Writes/reads `length` bytes to/from the ring buffer of the direction
+   * going out of/coming into this process, waiting for the other end to free
+   * space or write data as needed. The process which created the segment
+   * writes to the ring buffer the other one reads from. Returns false if the
+   * other end closed the channel or died.
+   */
+  bool Write(const void* data, size_t length);
+  bool Read(void* data, size_t length);
+  ///@}
+
+  ///@{
+  /**
+   * Gives direct access to the next `length` bytes of the outgoing/incoming
+   * ring buffer, waiting for the other end as `Write()`/`Read()` do, and
+   * returns nullptr if it is gone or if these bytes wrap around the end of
+   * the ring buffer. `EndWrite()`/`EndRead()` then pass the bytes to the
+   * other end.
+   */
+  void* BeginWrite(size_t length);
+  void EndWrite(size_t length);
+  const void* BeginRead(size_t length);
+  void EndRead(size_t length);
+  ///@}
+
+  /**
+   * Waits until the other end read everything written to the outgoing ring
+   * buffer. Returns false if it is gone before that.
+   */
+  bool WaitUntilRead();
+
+  ///@{
+  /**
+   * Attaches `channel` to `controller`, the controller of the socket
+   * connection it was negotiated for; pass nullptr to detach it. The channel
+   * is detached and closed when the controller is destroyed.
+   */
+  static void Attach(vtkMultiProcessController* controller, vtkPVSharedMemoryChannel* channel);
+  static vtkPVSharedMemoryChannel* GetChannel(vtkMultiProcessController* controller);
+  ///@}
+
+  ///@{
+  /**
+   * Sends/receives `length` bytes, going through the shared-memory channel
+   * of `controller` when it has one and `length` is large enough. Both ends
+   * must use the same `length`. Otherwise, these are equivalent to
+   * vtkMultiProcessController::Send() and Receive().
+   */
+  static int Send(vtkMultiProcessController* controller, const char* data, vtkIdType length,
+    int remoteId, int tag);
+  static int Receive(
+    vtkMultiProcessController* controller, char* data, vtkIdType length, int remoteId, int tag);
+  ///@}
+
+  ///@{
+  /**
+   * Sends/receives a data object, going through the shared-memory channel of
+   * `controller` when it has one and the data object is large enough.
+   * Otherwise, these are equivalent to vtkMultiProcessController::Send() and
+   * vtkMultiProcessController::ReceiveDataObject().
+   */
+  static int Send(
+    vtkMultiProcessController* controller, vtkDataObject* data, int remoteId, int tag);
+  static vtkSmartPointer<vtkDataObject> ReceiveDataObject(
+    vtkMultiProcessController* controller, int remoteId, int tag);
+  ///@}
+
+  ///@{
+  /**
+   * Sends/receives an array, going through the shared-memory channel of
+   * `controller` when it has one and the array is large enough. The received
+   * array must have the same data type as the sent one. Otherwise, these are
+   * equivalent to vtkMultiProcessController::Send() and Receive().
+   */
+  static int Send(
+    vtkMultiProcessController* controller, vtkDataArray* data, int remoteId, int tag);
+  static int Receive(
+    vtkMultiProcessController* controller, vtkDataArray* data, int remoteId, int tag);
+  ///@}
+
+protected:
+  vtkPVSharedMemoryChannel();
+  ~vtkPVSharedMemoryChannel() override;
+
+private:
+  vtkPVSharedMemoryChannel(const vtkPVSharedMemoryChannel&) = delete;
+  void operator=(const vtkPVSharedMemoryChannel&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
@@ -4,7 +4,9 @@
 
 #include "vtkClientSocket.h"
 #include "vtkCommand.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVSharedMemoryChannel.h"
 #include "vtkServerSocket.h"
 #include "vtkSmartPointer.h"
 #include "vtkSocketCommunicator.h"
@@ -16,25 +18,213 @@
 #include <vtksys/SystemInformation.hxx>
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#if defined(__linux__)
+#include <cerrno>
+#include <sys/epoll.h>
+#include <unistd.h>
+#define VTK_TCP_NETWORK_ACCESS_MANAGER_USE_EPOLL 1
+#else
+#define VTK_TCP_NETWORK_ACCESS_MANAGER_USE_EPOLL 0
+#endif
+
 // set this to 1 if you want to generate a log file with all the raw socket
 // communication.
 #define GENERATE_DEBUG_LOG 0
 
-#define MAX_SOCKETS 256
-
 class vtkTCPNetworkAccessManager::vtkInternals
 {
 public:
-  typedef std::vector<vtkWeakPointer<vtkSocketController>> VectorOfControllers;
+  struct Connection
+  {
+    vtkWeakPointer<vtkSocketController> Controller;
+    // kept to stop watching the socket once the controller is deleted.
+    vtkObject* Owner;
+    int Descriptor;
+  };
+  typedef std::vector<Connection> VectorOfControllers;
   VectorOfControllers Controllers;
   typedef std::map<int, vtkSmartPointer<vtkServerSocket>> MapToServerSockets;
   MapToServerSockets ServerSockets;
+
+  // Sockets to watch, i.e. those of the connected controllers and of the
+  // server sockets, and the controller or server socket each belongs to.
+  // Updated when connections and server sockets are added or removed.
+  std::map<int, vtkObject*> Sockets;
+
+  ~vtkInternals()
+  {
+#if VTK_TCP_NETWORK_ACCESS_MANAGER_USE_EPOLL
+    this->CloseEpoll();
+#endif
+  }
+
+  void Watch(int descriptor, vtkObject* owner)
+  {
+    this->Sockets[descriptor] = owner;
+#if VTK_TCP_NETWORK_ACCESS_MANAGER_USE_EPOLL
+    if (this->EpollDescriptor >= 0 && !this->Register(descriptor))
+    {
+      this->CloseEpoll();
+    }
+#endif
+  }
+
+  // Stops watching `descriptor`, unless it was closed and reused by another
+  // owner in the meantime.
+  void Unwatch(int descriptor, vtkObject* owner)
+  {
+    auto iter = this->Sockets.find(descriptor);
+    if (iter == this->Sockets.end() || iter->second != owner)
+    {
+      return;
+    }
+    this->Sockets.erase(iter);
+#if VTK_TCP_NETWORK_ACCESS_MANAGER_USE_EPOLL
+    if (this->EpollDescriptor >= 0)
+    {
+      // fails if the socket was already closed, which removed it.
+      epoll_ctl(this->EpollDescriptor, EPOLL_CTL_DEL, descriptor, nullptr);
+    }
+#endif
+  }
+
+#if VTK_TCP_NETWORK_ACCESS_MANAGER_USE_EPOLL
+  // epoll instance watching `Sockets`. Unlike select(), epoll has no limit on
+  // the number or the values of the socket descriptors, and waiting does not
+  // scan all of them.
+  int EpollDescriptor = -1;
+
+  bool Register(int descriptor)
+  {
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.fd = descriptor;
+    // a descriptor closed without being unwatched, then reused, may still be
+    // registered if it was duplicated in the meantime.
+    return epoll_ctl(this->EpollDescriptor, EPOLL_CTL_ADD, descriptor, &event) == 0 ||
+      (errno == EEXIST &&
+        epoll_ctl(this->EpollDescriptor, EPOLL_CTL_MOD, descriptor, &event) == 0);
+  }
+
+  // Closing the epoll instance drops all its registrations.
+  void CloseEpoll()
+  {
+    if (this->EpollDescriptor >= 0)
+    {
+      close(this->EpollDescriptor);
+      this->EpollDescriptor = -1;
+    }
+  }
+
+  // Creates the epoll instance on first use, watching the current sockets.
+  bool OpenEpoll()
+  {
+    if (this->EpollDescriptor >= 0)
+    {
+      return true;
+    }
+    this->EpollDescriptor = epoll_create1(EPOLL_CLOEXEC);
+    if (this->EpollDescriptor < 0)
+    {
+      return false;
+    }
+    for (const auto& item : this->Sockets)
+    {
+      if (!this->Register(item.first))
+      {
+        this->CloseEpoll();
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Same as vtkSocket::SelectSockets(), returning the owner of the selected
+  // socket.
+  int Wait(unsigned long timeout_msecs, vtkObject*& selected)
+  {
+    if (!this->OpenEpoll())
+    {
+      // e.g. out of file descriptors for the epoll instance.
+      return this->Select(timeout_msecs, selected);
+    }
+    const int timeout = timeout_msecs > 0 ? static_cast<int>(timeout_msecs) : -1;
+    // one socket at a time: epoll moves a socket that is still readable after
+    // being reported to the end of its ready list, so that all the
+    // connections are served in turn.
+    epoll_event event;
+    int result;
+    do
+    {
+      result = epoll_wait(this->EpollDescriptor, &event, 1, timeout);
+    } while (result < 0 && errno == EINTR);
+    if (result <= 0)
+    {
+      return result;
+    }
+    auto iter = this->Sockets.find(event.data.fd);
+    selected = iter != this->Sockets.end() ? iter->second : nullptr;
+    return 1;
+  }
+#else
+  int Wait(unsigned long timeout_msecs, vtkObject*& selected)
+  {
+    return this->Select(timeout_msecs, selected);
+  }
+#endif
+
+  int Select(unsigned long timeout_msecs, vtkObject*& selected)
+  {
+    std::vector<int> descriptors;
+    std::vector<vtkObject*> owners;
+    descriptors.reserve(this->Sockets.size());
+    owners.reserve(this->Sockets.size());
+    for (const auto& item : this->Sockets)
+    {
+      descriptors.push_back(item.first);
+      owners.push_back(item.second);
+    }
+    int selected_index = -1;
+    const int result = vtkSocket::SelectSockets(
+      descriptors.data(), static_cast<int>(descriptors.size()), timeout_msecs, &selected_index);
+    if (result > 0)
+    {
+      selected = owners[selected_index];
+    }
+    return result;
+  }
+
+  void AddController(vtkSocketController* controller)
+  {
+    auto comm = vtkSocketCommunicator::SafeDownCast(controller->GetCommunicator());
+    const int descriptor = comm->GetSocket()->GetSocketDescriptor();
+    this->Controllers.push_back(Connection{ controller, controller, descriptor });
+    this->Watch(descriptor, controller);
+  }
+
+  void AddServerSocket(int port, vtkServerSocket* server_socket)
+  {
+    this->ServerSockets[port] = server_socket;
+    this->Watch(server_socket->GetSocketDescriptor(), server_socket);
+  }
+
+  void RemoveServerSocket(int port)
+  {
+    auto iter = this->ServerSockets.find(port);
+    if (iter != this->ServerSockets.end())
+    {
+      this->Unwatch(iter->second->GetSocketDescriptor(), iter->second);
+      iter->second->CloseSocket();
+      this->ServerSockets.erase(iter);
+    }
+  }
 };
 
 vtkStandardNewMacro(vtkTCPNetworkAccessManager);
@@ -136,11 +326,7 @@ void vtkTCPNetworkAccessManager::DisableFurtherConnections(int port, bool disabl
 {
   if (disable)
   {
-    if (this->Internals->ServerSockets.find(port) != this->Internals->ServerSockets.end())
-    {
-      this->Internals->ServerSockets.at(port)->CloseSocket();
-      this->Internals->ServerSockets.erase(port);
-    }
+    this->Internals->RemoveServerSocket(port);
   }
   else
   {
@@ -151,7 +337,7 @@ void vtkTCPNetworkAccessManager::DisableFurtherConnections(int port, bool disabl
       server_socket->Delete();
       return;
     }
-    this->Internals->ServerSockets[port] = server_socket;
+    this->Internals->AddServerSocket(port, server_socket);
     server_socket->FastDelete();
   }
 }
@@ -178,59 +364,47 @@ int vtkTCPNetworkAccessManager::ProcessEvents(unsigned long timeout_msecs)
 int vtkTCPNetworkAccessManager::ProcessEventsInternal(
   unsigned long timeout_msecs, bool do_processing)
 {
-  int sockets_to_select[MAX_SOCKETS];
-  vtkObject* controller_or_server_socket[MAX_SOCKETS];
+  auto& internals = *this->Internals;
 
+  // stop watching the controllers that were deleted or disconnected; the
+  // others only need to be checked for messages already received.
   vtkSocketController* ctrlWithBufferToEmpty = nullptr;
-  int size = 0;
-  vtkInternals::VectorOfControllers::iterator iter1;
-  for (iter1 = this->Internals->Controllers.begin(); iter1 != this->Internals->Controllers.end();
-       ++iter1)
+  size_t number_of_connections = 0;
+  for (auto iter = internals.Controllers.begin(); iter != internals.Controllers.end();)
   {
-    vtkSocketController* controller = iter1->GetPointer();
-    if (!controller)
+    vtkSocketController* controller = iter->Controller.GetPointer();
+    vtkSocketCommunicator* comm =
+      controller ? vtkSocketCommunicator::SafeDownCast(controller->GetCommunicator()) : nullptr;
+    vtkSocket* socket = comm ? comm->GetSocket() : nullptr;
+    if (!socket || !socket->GetConnected())
     {
-      // skip nullptr controllers.
+      internals.Unwatch(iter->Descriptor, iter->Owner);
+      if (!controller)
+      {
+        iter = internals.Controllers.erase(iter);
+        continue;
+      }
+      ++iter;
       continue;
     }
-    vtkSocketCommunicator* comm =
-      vtkSocketCommunicator::SafeDownCast(controller->GetCommunicator());
-    vtkSocket* socket = comm->GetSocket();
-    if (socket && socket->GetConnected())
+    ++number_of_connections;
+    if (comm->HasBufferredMessages())
     {
-      sockets_to_select[size] = socket->GetSocketDescriptor();
-      controller_or_server_socket[size] = controller;
-      if (comm->HasBufferredMessages())
+      ctrlWithBufferToEmpty = controller;
+      if (!do_processing)
       {
-        ctrlWithBufferToEmpty = controller;
-        if (!do_processing)
-        {
-          // we do have events to process, but we were told not to process them,
-          // so just return and say we have something to process here.
-          return 1;
-        }
+        // we do have events to process, but we were told not to process them,
+        // so just return and say we have something to process here.
+        return 1;
       }
-      size++;
     }
+    ++iter;
   }
 
   // Only one client connected, so if it fails, just quit...
-  bool can_quit_if_error = (size == 1);
-
-  // Now add server sockets.
-  vtkInternals::MapToServerSockets::iterator iter2;
-  for (iter2 = this->Internals->ServerSockets.begin();
-       iter2 != this->Internals->ServerSockets.end(); ++iter2)
-  {
-    if (iter2->second.GetPointer() && iter2->second.GetPointer()->GetConnected())
-    {
-      sockets_to_select[size] = iter2->second.GetPointer()->GetSocketDescriptor();
-      controller_or_server_socket[size] = iter2->second.GetPointer();
-      size++;
-    }
-  }
+  bool can_quit_if_error = (number_of_connections == 1);
 
-  if (size == 0 || this->AbortPendingConnectionFlag)
+  if (internals.Sockets.empty() || this->AbortPendingConnectionFlag)
   {
     // Connection failed / aborted.
     return -1;
@@ -243,8 +417,8 @@ int vtkTCPNetworkAccessManager::ProcessEventsInternal(
     return 1;
   }
 
-  int selected_index = -1;
-  int result = vtkSocket::SelectSockets(sockets_to_select, size, timeout_msecs, &selected_index);
+  vtkObject* selected = nullptr;
+  int result = internals.Wait(timeout_msecs, selected);
   if (result <= 0)
   {
     return result;
@@ -256,10 +430,14 @@ int vtkTCPNetworkAccessManager::ProcessEventsInternal(
     return 1;
   }
 
-  if (controller_or_server_socket[selected_index]->IsA("vtkServerSocket"))
+  if (!selected)
   {
-    vtkServerSocket* ss =
-      static_cast<vtkServerSocket*>(controller_or_server_socket[selected_index]);
+    // the socket was closed and reused while the event was pending.
+    return 1;
+  }
+  if (selected->IsA("vtkServerSocket"))
+  {
+    vtkServerSocket* ss = static_cast<vtkServerSocket*>(selected);
     int port = ss->GetServerPort();
     this->InvokeEvent(vtkCommand::ConnectionCreatedEvent, &port);
     return 1;
@@ -270,7 +448,7 @@ int vtkTCPNetworkAccessManager::ProcessEventsInternal(
     // during the whole ProcessRMIs call. As that call can release
     // the controller while executing.
     vtkSmartPointer<vtkMultiProcessController> controller =
-      vtkMultiProcessController::SafeDownCast(controller_or_server_socket[selected_index]);
+      vtkMultiProcessController::SafeDownCast(selected);
     result = controller->ProcessRMIs(0, 1);
     if (result == vtkMultiProcessController::RMI_NO_ERROR)
     {
@@ -286,6 +464,7 @@ int vtkTCPNetworkAccessManager::ProcessEventsInternal(
     // Close cleanly the socket in error
     vtkSocketCommunicator* comm =
       vtkSocketCommunicator::SafeDownCast(controller->GetCommunicator());
+    internals.Unwatch(comm->GetSocket()->GetSocketDescriptor(), controller);
     comm->CloseConnection();
 
     // Fire an event letting the world know that the connection was closed.
@@ -419,7 +598,8 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::ConnectToRemote(const cha
     result = vtkNetworkAccessManager::ConnectionResult::CONNECTION_HANDSHAKE_ERROR;
     return nullptr;
   }
-  this->Internals->Controllers.push_back(controller);
+  this->NegotiateSharedMemoryChannel(controller, false);
+  this->Internals->AddController(controller);
   result = vtkNetworkAccessManager::ConnectionResult::CONNECTION_SUCCESS;
   return controller;
 }
@@ -443,7 +623,7 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::WaitForConnection(int por
       result = vtkNetworkAccessManager::ConnectionResult::CONNECTION_FAILURE;
       return nullptr;
     }
-    this->Internals->ServerSockets[port] = server_socket;
+    this->Internals->AddServerSocket(port, server_socket);
     server_socket->FastDelete();
   }
 
@@ -502,7 +682,8 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::WaitForConnection(int por
 
   if (controller)
   {
-    this->Internals->Controllers.push_back(controller);
+    this->NegotiateSharedMemoryChannel(controller, true);
+    this->Internals->AddController(controller);
     result = vtkNetworkAccessManager::ConnectionResult::CONNECTION_SUCCESS;
   }
   else if (this->AbortPendingConnectionFlag)
@@ -512,8 +693,7 @@ vtkMultiProcessController* vtkTCPNetworkAccessManager::WaitForConnection(int por
 
   if (once)
   {
-    server_socket->CloseSocket();
-    this->Internals->ServerSockets.erase(port);
+    this->Internals->RemoveServerSocket(port);
   }
 
   return controller;
@@ -614,6 +794,58 @@ int vtkTCPNetworkAccessManager::ParaViewHandshake(
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkTCPNetworkAccessManager::NegotiateSharedMemoryChannel(
+  vtkMultiProcessController* controller, bool server_side)
+{
+  // The accepting side creates a segment and sends its name and token; the
+  // connecting side can only open it if both run on the same host. Both sides
+  // always exchange these messages, even when the channel is disabled.
+  vtkNew<vtkPVSharedMemoryChannel> channel;
+  int accepted = 0;
+  if (server_side)
+  {
+    const bool created = vtkPVSharedMemoryChannel::GetEnabled() &&
+      channel->Create(vtkPVSharedMemoryChannel::GetDefaultBufferSize());
+    const std::string name = created ? channel->GetName() : std::string();
+    vtkTypeUInt64 token = channel->GetToken();
+    int size = static_cast<int>(name.size() + 1);
+    controller->Send(&size, 1, 1, 99992);
+    controller->Send(name.c_str(), size, 1, 99992);
+    controller->Send(&token, 1, 1, 99992);
+
+    int opened = 0;
+    controller->Receive(&opened, 1, 1, 99993);
+    accepted = opened && created && channel->IsConnected() ? 1 : 0;
+    controller->Send(&accepted, 1, 1, 99994);
+  }
+  else
+  {
+    int size = 0;
+    controller->Receive(&size, 1, 1, 99992);
+    std::vector<char> name(std::max(size, 1), '\0');
+    if (size > 0)
+    {
+      controller->Receive(name.data(), size, 1, 99992);
+    }
+    vtkTypeUInt64 token = 0;
+    controller->Receive(&token, 1, 1, 99992);
+
+    int opened = name[0] != '\0' && vtkPVSharedMemoryChannel::GetEnabled() &&
+        channel->Open(std::string(name.data()), token)
+      ? 1
+      : 0;
+    controller->Send(&opened, 1, 1, 99993);
+    controller->Receive(&accepted, 1, 1, 99994);
+  }
+
+  if (accepted)
+  {
+    channel->Unlink();
+    vtkPVSharedMemoryChannel::Attach(controller, channel);
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkTCPNetworkAccessManager::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -132,6 +132,13 @@ protected:
   int ParaViewHandshake(
     vtkMultiProcessController* controller, bool server_side, const char* handshake);
   void PrintHandshakeError(int errorcode, bool server_side);
+
+  /**
+   * Sets up a vtkPVSharedMemoryChannel for the connection when both processes
+   * run on the same host. Called on both sides after a successful handshake;
+   * the connection keeps using sockets only when this fails.
+   */
+  void NegotiateSharedMemoryChannel(vtkMultiProcessController* controller, bool server_side);
   int AnalyzeHandshakeAndGetErrorCode(const char* clientHS, const char* serverHS);
 
   bool AbortPendingConnectionFlag;
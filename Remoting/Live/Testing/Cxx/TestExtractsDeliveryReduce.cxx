@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Tests the reductions applied to Catalyst Live extracts: spatial subsets of
+ * structured data stay structured and match the cells within the bounds.
+ */
+
+#include "vtkDoubleArray.h"
+#include "vtkExtractsDeliveryHelper.h"
+#include "vtkImageData.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkStructuredGrid.h"
+
+#include <algorithm>
+#include <iostream>
+
+namespace
+{
+// the datasets are lattices of Size^3 points with a spacing of 1.
+constexpr int Size = 11;
+
+void AddArrays(vtkDataSet* ds)
+{
+  const char* names[] = { "values", "other" };
+  for (const char* name : names)
+  {
+    vtkNew<vtkDoubleArray> array;
+    array->SetName(name);
+    array->SetNumberOfTuples(ds->GetNumberOfPoints());
+    array->FillComponent(0, 1.0);
+    ds->GetPointData()->AddArray(array);
+  }
+}
+
+vtkSmartPointer<vtkDataSet> NewImageData()
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(0, Size - 1, 0, Size - 1, 0, Size - 1);
+  AddArrays(image);
+  return image;
+}
+
+vtkSmartPointer<vtkDataSet> NewStructuredGrid()
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k < Size; ++k)
+  {
+    for (int j = 0; j < Size; ++j)
+    {
+      for (int i = 0; i < Size; ++i)
+      {
+        points->InsertNextPoint(i, j, k);
+      }
+    }
+  }
+  vtkNew<vtkStructuredGrid> grid;
+  grid->SetExtent(0, Size - 1, 0, Size - 1, 0, Size - 1);
+  grid->SetPoints(points);
+  AddArrays(grid);
+  return grid;
+}
+
+vtkSmartPointer<vtkDataSet> NewRectilinearGrid()
+{
+  vtkNew<vtkDoubleArray> coordinates;
+  for (int cc = 0; cc < Size; ++cc)
+  {
+    coordinates->InsertNextValue(cc);
+  }
+  vtkNew<vtkRectilinearGrid> grid;
+  grid->SetExtent(0, Size - 1, 0, Size - 1, 0, Size - 1);
+  grid->SetXCoordinates(coordinates);
+  grid->SetYCoordinates(coordinates);
+  grid->SetZCoordinates(coordinates);
+  AddArrays(grid);
+  return grid;
+}
+
+bool Check(bool condition, const char* type, const char* message)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << type << ": " << message << std::endl;
+  }
+  return condition;
+}
+
+bool TestReduce(vtkDataSet* input)
+{
+  const char* type = input->GetClassName();
+
+  // the cells with a point within the bounds span points 2 to 6 on each axis.
+  vtkExtractsDeliveryHelper::DeliveryOptions options;
+  options.ArrayNames.emplace_back("values");
+  options.UseBounds = true;
+  const double bounds[6] = { 2.5, 5.5, 2.5, 5.5, 2.5, 5.5 };
+  std::copy(bounds, bounds + 6, options.Bounds);
+
+  vtkSmartPointer<vtkDataSet> output =
+    vtkDataSet::SafeDownCast(vtkExtractsDeliveryHelper::Reduce(input, options));
+  bool success = Check(output && output->IsA(type), type, "Output is not of the input type.");
+  if (!success)
+  {
+    return false;
+  }
+  success &= Check(output->GetNumberOfPoints() == 125 && output->GetNumberOfCells() == 64, type,
+    "Unexpected spatial subset.");
+  double outputBounds[6];
+  output->GetBounds(outputBounds);
+  success &= Check(outputBounds[0] == 2 && outputBounds[1] == 6 && outputBounds[2] == 2 &&
+      outputBounds[3] == 6 && outputBounds[4] == 2 && outputBounds[5] == 6,
+    type, "Unexpected bounds.");
+  success &= Check(output->GetPointData()->GetArray("values") != nullptr &&
+      output->GetPointData()->GetArray("other") == nullptr,
+    type, "Unexpected arrays.");
+
+  // sampling keeps the data structured too.
+  options.SampleRate = 2;
+  output = vtkDataSet::SafeDownCast(vtkExtractsDeliveryHelper::Reduce(input, options));
+  success &= Check(output && output->IsA(type) && output->GetNumberOfPoints() == 27, type,
+    "Unexpected sampled subset.");
+
+  // nothing within the bounds.
+  options.SampleRate = 1;
+  options.Bounds[0] = 20;
+  options.Bounds[1] = 30;
+  output = vtkDataSet::SafeDownCast(vtkExtractsDeliveryHelper::Reduce(input, options));
+  success &= Check(output && output->IsA(type) && output->GetNumberOfPoints() == 0, type,
+    "Output should be empty.");
+  return success;
+}
+}
+
+int TestExtractsDeliveryReduce(int, char*[])
+{
+  bool success = TestReduce(NewImageData());
+  success &= TestReduce(NewStructuredGrid());
+  success &= TestReduce(NewRectilinearGrid());
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -3,34 +3,486 @@
 #include "vtkExtractsDeliveryHelper.h"
 
 #include "vtkAlgorithmOutput.h"
+#include "vtkBox.h"
 #include "vtkCellData.h"
+#include "vtkCharArray.h"
+#include "vtkCommunicator.h"
+#include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataObject.h"
 #include "vtkDataObjectTypes.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkExtractGeometry.h"
+#include "vtkExtractGrid.h"
+#include "vtkExtractPolyDataGeometry.h"
+#include "vtkExtractRectilinearGrid.h"
+#include "vtkExtractVOI.h"
+#include "vtkImageData.h"
+#include "vtkLZ4DataCompressor.h"
+#include "vtkMaskPoints.h"
 #include "vtkMultiProcessController.h"
 #include "vtkMultiProcessControllerHelper.h"
 #include "vtkMultiProcessStream.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
 #include "vtkSocketController.h"
 #include "vtkStructuredGrid.h"
 #include "vtkTrivialProducer.h"
 #include "vtkUnsignedCharArray.h"
+#include "vtkZLibDataCompressor.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <set>
+
+namespace
+{
+// An extract serialized by the producer, ready to be sent.
+struct vtkSerializedExtract
+{
+  std::string Key;
+  int CompressionMethod = vtkExtractsDeliveryHelper::NONE;
+  vtkTypeInt64 RawSize = 0;
+  // vtkCharArray when not compressed, vtkUnsignedCharArray otherwise. nullptr
+  // for an empty extract.
+  vtkSmartPointer<vtkDataArray> Data;
+};
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataCompressor> NewCompressor(int method)
+{
+  switch (method)
+  {
+    case vtkExtractsDeliveryHelper::LZ4:
+      return vtkSmartPointer<vtkLZ4DataCompressor>::New();
+    case vtkExtractsDeliveryHelper::ZLIB:
+      return vtkSmartPointer<vtkZLibDataCompressor>::New();
+    default:
+      return nullptr;
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSerializedExtract Serialize(const std::string& key, vtkDataObject* dObj, int method)
+{
+  vtkSerializedExtract result;
+  result.Key = key;
+  vtkNew<vtkCharArray> buffer;
+  if (dObj == nullptr || !vtkCommunicator::MarshalDataObject(dObj, buffer))
+  {
+    return result;
+  }
+
+  result.RawSize = buffer->GetNumberOfValues();
+  if (auto compressor = NewCompressor(method))
+  {
+    vtkSmartPointer<vtkUnsignedCharArray> compressed;
+    compressed.TakeReference(
+      compressor->Compress(reinterpret_cast<const unsigned char*>(buffer->GetPointer(0)),
+        static_cast<size_t>(result.RawSize)));
+    if (compressed)
+    {
+      result.CompressionMethod = method;
+      result.Data = compressed;
+      return result;
+    }
+  }
+  result.Data = buffer;
+  return result;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> Deserialize(int method, vtkTypeInt64 rawSize, vtkDataArray* data)
+{
+  if (method == vtkExtractsDeliveryHelper::NONE)
+  {
+    return vtkCommunicator::UnMarshalDataObject(vtkCharArray::SafeDownCast(data));
+  }
+
+  auto compressor = NewCompressor(method);
+  auto compressed = vtkUnsignedCharArray::SafeDownCast(data);
+  if (!compressor || !compressed)
+  {
+    return nullptr;
+  }
+  vtkSmartPointer<vtkUnsignedCharArray> uncompressed;
+  uncompressed.TakeReference(compressor->Uncompress(compressed->GetPointer(0),
+    static_cast<size_t>(compressed->GetNumberOfValues()), static_cast<size_t>(rawSize)));
+  if (!uncompressed)
+  {
+    return nullptr;
+  }
+  vtkNew<vtkCharArray> buffer;
+  buffer->SetArray(reinterpret_cast<char*>(uncompressed->GetPointer(0)),
+    uncompressed->GetNumberOfValues(), /*save=*/1);
+  return vtkCommunicator::UnMarshalDataObject(buffer);
+}
+
+//----------------------------------------------------------------------------
+bool Deliver(vtkSocketController* comm, const std::vector<vtkSerializedExtract>& extracts)
+{
+  bool success = true;
+  for (const auto& extract : extracts)
+  {
+    vtkMultiProcessStream stream;
+    stream << extract.Key << extract.CompressionMethod << extract.RawSize
+           << (extract.Data ? 1 : 0);
+    success = success && comm->Send(stream, 1, 12000) != 0;
+    if (success && extract.Data)
+    {
+      success = comm->Send(extract.Data.GetPointer(), 1, 12001) != 0;
+    }
+  }
+  // mark end.
+  vtkMultiProcessStream stream;
+  stream << std::string("null");
+  return comm->Send(stream, 1, 12000) != 0 && success;
+}
+
+//----------------------------------------------------------------------------
+void PassArrays(vtkFieldData* fd, const std::set<std::string>& names)
+{
+  for (int cc = fd->GetNumberOfArrays() - 1; cc >= 0; --cc)
+  {
+    const char* name = fd->GetArrayName(cc);
+    if (name == nullptr ||
+      (names.find(name) == names.end() &&
+        strcmp(name, vtkDataSetAttributes::GhostArrayName()) != 0))
+    {
+      fd->RemoveArray(cc);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+// Grows `voi` to include the point at structured coordinates `ijk`.
+void AddToVOI(int voi[6], const int ijk[3])
+{
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    voi[2 * axis] = std::min(voi[2 * axis], ijk[axis]);
+    voi[2 * axis + 1] = std::max(voi[2 * axis + 1], ijk[axis]);
+  }
+}
+
+//----------------------------------------------------------------------------
+// Clamps `voi` to `extent`. Returns false if they do not intersect.
+bool ClampVOI(int voi[6], const int extent[6])
+{
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    voi[2 * axis] = std::max(voi[2 * axis], extent[2 * axis]);
+    voi[2 * axis + 1] = std::min(voi[2 * axis + 1], extent[2 * axis + 1]);
+    if (voi[2 * axis] > voi[2 * axis + 1])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Computes the sub-extent of `image` covering `bounds`.
+bool GetVOI(vtkImageData* image, const double bounds[6], int voi[6])
+{
+  const int* extent = image->GetExtent();
+  for (int corner = 0; corner < 8; ++corner)
+  {
+    const double point[3] = { bounds[corner & 1], bounds[2 + ((corner >> 1) & 1)],
+      bounds[4 + ((corner >> 2) & 1)] };
+    double ijk[3];
+    image->TransformPhysicalPointToContinuousIndex(point, ijk);
+    const int lower[3] = { static_cast<int>(std::floor(ijk[0])),
+      static_cast<int>(std::floor(ijk[1])), static_cast<int>(std::floor(ijk[2])) };
+    const int upper[3] = { static_cast<int>(std::ceil(ijk[0])),
+      static_cast<int>(std::ceil(ijk[1])), static_cast<int>(std::ceil(ijk[2])) };
+    ::AddToVOI(voi, lower);
+    ::AddToVOI(voi, upper);
+  }
+  return ::ClampVOI(voi, extent);
+}
+
+//----------------------------------------------------------------------------
+// Computes the sub-extent of `grid` covering the cells that intersect `bounds`.
+bool GetVOI(vtkRectilinearGrid* grid, const double bounds[6], int voi[6])
+{
+  const int* extent = grid->GetExtent();
+  vtkDataArray* coordinates[3] = { grid->GetXCoordinates(), grid->GetYCoordinates(),
+    grid->GetZCoordinates() };
+  for (int axis = 0; axis < 3; ++axis)
+  {
+    const vtkIdType size = coordinates[axis]->GetNumberOfTuples();
+    for (vtkIdType cc = 0; cc < size; ++cc)
+    {
+      // the segment from this coordinate to the next one, if any.
+      const double first = coordinates[axis]->GetComponent(cc, 0);
+      const double second = cc + 1 < size ? coordinates[axis]->GetComponent(cc + 1, 0) : first;
+      if (std::max(first, second) >= bounds[2 * axis] &&
+        std::min(first, second) <= bounds[2 * axis + 1])
+      {
+        const int index = extent[2 * axis] + static_cast<int>(cc);
+        voi[2 * axis] = std::min(voi[2 * axis], index);
+        voi[2 * axis + 1] = std::max(voi[2 * axis + 1], cc + 1 < size ? index + 1 : index);
+      }
+    }
+  }
+  return ::ClampVOI(voi, extent);
+}
+
+//----------------------------------------------------------------------------
+// Computes the sub-extent of `grid` covering the cells that have a point inside
+// `bounds`, like vtkExtractGeometry with ExtractBoundaryCells on.
+bool GetVOI(vtkStructuredGrid* grid, const double bounds[6], int voi[6])
+{
+  const int* extent = grid->GetExtent();
+  vtkIdType ptId = 0;
+  int ijk[3];
+  for (ijk[2] = extent[4]; ijk[2] <= extent[5]; ++ijk[2])
+  {
+    for (ijk[1] = extent[2]; ijk[1] <= extent[3]; ++ijk[1])
+    {
+      for (ijk[0] = extent[0]; ijk[0] <= extent[1]; ++ijk[0], ++ptId)
+      {
+        double point[3];
+        grid->GetPoint(ptId, point);
+        if (point[0] >= bounds[0] && point[0] <= bounds[1] && point[1] >= bounds[2] &&
+          point[1] <= bounds[3] && point[2] >= bounds[4] && point[2] <= bounds[5])
+        {
+          const int lower[3] = { ijk[0] - 1, ijk[1] - 1, ijk[2] - 1 };
+          const int upper[3] = { ijk[0] + 1, ijk[1] + 1, ijk[2] + 1 };
+          ::AddToVOI(voi, lower);
+          ::AddToVOI(voi, upper);
+        }
+      }
+    }
+  }
+  return ::ClampVOI(voi, extent);
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataSet> ExtractBounds(vtkDataSet* ds, const double bounds[6])
+{
+  // keep structured data structured: extract the sub-extent covering the
+  // bounds, starting from an empty one.
+  int voi[6] = { VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN, VTK_INT_MAX, VTK_INT_MIN };
+  vtkSmartPointer<vtkDataSet> result;
+  if (auto image = vtkImageData::SafeDownCast(ds))
+  {
+    if (::GetVOI(image, bounds, voi))
+    {
+      vtkNew<vtkExtractVOI> extract;
+      extract->SetInputData(image);
+      extract->SetVOI(voi);
+      extract->Update();
+      result = extract->GetOutput();
+    }
+  }
+  else if (auto grid = vtkStructuredGrid::SafeDownCast(ds))
+  {
+    if (::GetVOI(grid, bounds, voi))
+    {
+      vtkNew<vtkExtractGrid> extract;
+      extract->SetInputData(grid);
+      extract->SetVOI(voi);
+      extract->Update();
+      result = extract->GetOutput();
+    }
+  }
+  else if (auto rgrid = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    if (::GetVOI(rgrid, bounds, voi))
+    {
+      vtkNew<vtkExtractRectilinearGrid> extract;
+      extract->SetInputData(rgrid);
+      extract->SetVOI(voi);
+      extract->Update();
+      result = extract->GetOutput();
+    }
+  }
+  else if (auto polydata = vtkPolyData::SafeDownCast(ds))
+  {
+    vtkNew<vtkBox> box;
+    box->SetBounds(bounds);
+    vtkNew<vtkExtractPolyDataGeometry> extract;
+    extract->SetInputData(polydata);
+    extract->SetImplicitFunction(box);
+    extract->ExtractInsideOn();
+    extract->ExtractBoundaryCellsOn();
+    extract->Update();
+    result = extract->GetOutput();
+  }
+  else
+  {
+    vtkNew<vtkBox> box;
+    box->SetBounds(bounds);
+    vtkNew<vtkExtractGeometry> extract;
+    extract->SetInputData(ds);
+    extract->SetImplicitFunction(box);
+    extract->ExtractInsideOn();
+    extract->ExtractBoundaryCellsOn();
+    extract->Update();
+    result = extract->GetOutput();
+  }
+
+  if (!result)
+  {
+    // nothing of the dataset is within the bounds.
+    result.TakeReference(ds->NewInstance());
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataSet> Sample(vtkDataSet* ds, int rate)
+{
+  vtkSmartPointer<vtkDataSet> result;
+  if (auto image = vtkImageData::SafeDownCast(ds))
+  {
+    vtkNew<vtkExtractVOI> extract;
+    extract->SetInputData(image);
+    extract->SetVOI(image->GetExtent());
+    extract->SetSampleRate(rate, rate, rate);
+    extract->Update();
+    result = extract->GetOutput();
+  }
+  else if (auto grid = vtkStructuredGrid::SafeDownCast(ds))
+  {
+    vtkNew<vtkExtractGrid> extract;
+    extract->SetInputData(grid);
+    extract->SetVOI(grid->GetExtent());
+    extract->SetSampleRate(rate, rate, rate);
+    extract->Update();
+    result = extract->GetOutput();
+  }
+  else if (auto rgrid = vtkRectilinearGrid::SafeDownCast(ds))
+  {
+    vtkNew<vtkExtractRectilinearGrid> extract;
+    extract->SetInputData(rgrid);
+    extract->SetVOI(rgrid->GetExtent());
+    extract->SetSampleRate(rate, rate, rate);
+    extract->Update();
+    result = extract->GetOutput();
+  }
+  else
+  {
+    // unstructured data has no natural coarsening; ship a point cloud.
+    vtkNew<vtkMaskPoints> mask;
+    mask->SetInputData(ds);
+    mask->SetOnRatio(rate);
+    mask->GenerateVerticesOn();
+    mask->SingleVertexPerCellOn();
+    mask->Update();
+    result = mask->GetOutput();
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> ReduceLeaf(
+  vtkDataObject* leaf, const vtkExtractsDeliveryHelper::DeliveryOptions& options)
+{
+  auto ds = vtkDataSet::SafeDownCast(leaf);
+  if (ds == nullptr)
+  {
+    return leaf;
+  }
+
+  vtkSmartPointer<vtkDataSet> result;
+  result.TakeReference(ds->NewInstance());
+  result->ShallowCopy(ds);
+  if (!options.ArrayNames.empty())
+  {
+    // drop unwanted arrays first so that the filters below do not copy them.
+    const std::set<std::string> names(options.ArrayNames.begin(), options.ArrayNames.end());
+    ::PassArrays(result->GetPointData(), names);
+    ::PassArrays(result->GetCellData(), names);
+    ::PassArrays(result->GetFieldData(), names);
+  }
+  if (options.UseBounds)
+  {
+    result = ::ExtractBounds(result, options.Bounds);
+  }
+  if (options.SampleRate > 1 && result->GetNumberOfPoints() > 0)
+  {
+    result = ::Sample(result, options.SampleRate);
+  }
+  return result;
+}
+}
+
+class vtkExtractsDeliveryHelper::vtkInternals
+{
+public:
+  // extracts being sent asynchronously by the producer.
+  std::future<bool> Delivery;
+};
+
+//----------------------------------------------------------------------------
+bool vtkExtractsDeliveryHelper::DeliveryOptions::IsIdentity() const
+{
+  return this->ArrayNames.empty() && !this->UseBounds && this->SampleRate <= 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkExtractsDeliveryHelper::DeliveryOptions::Save(vtkMultiProcessStream& stream) const
+{
+  stream << static_cast<int>(this->ArrayNames.size());
+  for (const auto& name : this->ArrayNames)
+  {
+    stream << name;
+  }
+  stream << (this->UseBounds ? 1 : 0);
+  for (int cc = 0; cc < 6; ++cc)
+  {
+    stream << this->Bounds[cc];
+  }
+  stream << this->SampleRate;
+}
+
+//----------------------------------------------------------------------------
+void vtkExtractsDeliveryHelper::DeliveryOptions::Load(vtkMultiProcessStream& stream)
+{
+  int numberOfArrays = 0;
+  stream >> numberOfArrays;
+  this->ArrayNames.resize(numberOfArrays);
+  for (auto& name : this->ArrayNames)
+  {
+    stream >> name;
+  }
+  int useBounds = 0;
+  stream >> useBounds;
+  this->UseBounds = useBounds != 0;
+  for (int cc = 0; cc < 6; ++cc)
+  {
+    stream >> this->Bounds[cc];
+  }
+  stream >> this->SampleRate;
+}
 
 vtkStandardNewMacro(vtkExtractsDeliveryHelper);
 //----------------------------------------------------------------------------
 vtkExtractsDeliveryHelper::vtkExtractsDeliveryHelper()
   : ProcessIsProducer(true)
+  , CompressionMethod(NONE)
+  , AsynchronousDelivery(false)
   , NumberOfSimulationProcesses(0)
   , NumberOfVisualizationProcesses(0)
+  , Internals(new vtkInternals())
 {
   this->SetParallelController(vtkMultiProcessController::GetGlobalController());
 }
 
 //----------------------------------------------------------------------------
-vtkExtractsDeliveryHelper::~vtkExtractsDeliveryHelper() = default;
+vtkExtractsDeliveryHelper::~vtkExtractsDeliveryHelper()
+{
+  this->Wait();
+}
 
 //----------------------------------------------------------------------------
 void vtkExtractsDeliveryHelper::SetSimulation2VisualizationController(vtkSocketController* cont)
@@ -57,6 +509,7 @@ void vtkExtractsDeliveryHelper::ClearAllExtracts()
 {
   this->ExtractConsumers.clear();
   this->ExtractProducers.clear();
+  this->ExtractDeliveryOptions.clear();
   this->Modified();
 }
 
@@ -86,6 +539,60 @@ void vtkExtractsDeliveryHelper::AddExtractProducer(
   this->ExtractProducers[key] = producerPort;
 }
 
+//----------------------------------------------------------------------------
+void vtkExtractsDeliveryHelper::SetExtractDeliveryOptions(
+  const char* key, const DeliveryOptions& options)
+{
+  assert(this->ProcessIsProducer == true);
+  assert(key != nullptr);
+
+  if (options.IsIdentity())
+  {
+    this->ExtractDeliveryOptions.erase(key);
+  }
+  else
+  {
+    this->ExtractDeliveryOptions[key] = options;
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> vtkExtractsDeliveryHelper::Reduce(
+  vtkDataObject* dObj, const DeliveryOptions& options)
+{
+  if (dObj == nullptr || options.IsIdentity())
+  {
+    return dObj;
+  }
+
+  auto cd = vtkCompositeDataSet::SafeDownCast(dObj);
+  if (cd == nullptr)
+  {
+    return ::ReduceLeaf(dObj, options);
+  }
+
+  vtkSmartPointer<vtkCompositeDataSet> result;
+  result.TakeReference(cd->NewInstance());
+  result->CopyStructure(cd);
+  vtkSmartPointer<vtkCompositeDataIterator> iter;
+  iter.TakeReference(cd->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem())
+  {
+    result->SetDataSet(iter, ::ReduceLeaf(iter->GetCurrentDataObject(), options));
+  }
+  return result;
+}
+
+//----------------------------------------------------------------------------
+bool vtkExtractsDeliveryHelper::Wait()
+{
+  if (this->Internals->Delivery.valid())
+  {
+    return this->Internals->Delivery.get();
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 vtkDataObject* vtkExtractsDeliveryHelper::Collect(int node_count, vtkDataObject* dObj)
 {
@@ -162,45 +669,52 @@ bool vtkExtractsDeliveryHelper::Update()
     int M = this->NumberOfSimulationProcesses;
     int N = this->NumberOfVisualizationProcesses;
 
-    std::map<std::string, vtkSmartPointer<vtkDataObject>> gathered_extracts;
-    if (M > N)
+    // when simulation processes in greater than vis processes, the simulation
+    // processes will gather data on the first N processes and then ship that
+    // over. When N >= M, nothing special to do. Only the first M
+    // visualization processes have data. One can use D3 for load balancing.
+    //
+    // Extracts are reduced before being gathered so that every rank does its
+    // share of the work, and serialized right away so that the simulation can
+    // modify its data as soon as we return.
+    vtkSocketController* comm = this->Simulation2VisualizationController;
+    std::vector<vtkSerializedExtract> extracts;
+    for (ExtractProducersType::iterator iter = this->ExtractProducers.begin();
+         iter != this->ExtractProducers.end(); ++iter)
     {
-      // when simulation processes in greater than vis processes, the simulation
-      // processes will gather data on the first N processes and then ship that
-      // over.
-      for (ExtractProducersType::iterator iter = this->ExtractProducers.begin();
-           iter != this->ExtractProducers.end(); ++iter)
+      vtkSmartPointer<vtkDataObject> dObj =
+        iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex());
+      auto options = this->ExtractDeliveryOptions.find(iter->first);
+      if (options != this->ExtractDeliveryOptions.end())
       {
-        vtkDataObject* dObj = this->Collect(
-          N, iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex()));
-        gathered_extracts[iter->first].TakeReference(dObj);
+        dObj = vtkExtractsDeliveryHelper::Reduce(dObj, options->second);
+      }
+      if (M > N)
+      {
+        vtkSmartPointer<vtkDataObject> gathered;
+        gathered.TakeReference(this->Collect(N, dObj));
+        dObj = gathered;
+      }
+      if (comm)
+      {
+        extracts.push_back(::Serialize(iter->first, dObj, this->CompressionMethod));
       }
     }
 
-    if (N >= M)
-    {
-      // totally acceptable case, nothing special to do. Only the first M
-      // visualization processes have data. One can use D3 for load balancing.
-    }
-
-    vtkSocketController* comm = this->Simulation2VisualizationController;
     if (comm)
     {
-      for (ExtractProducersType::iterator iter = this->ExtractProducers.begin();
-           iter != this->ExtractProducers.end(); ++iter)
+      // the previous delivery must be done before using the controller again.
+      retVal = this->Wait();
+      if (this->AsynchronousDelivery)
       {
-        vtkMultiProcessStream stream;
-        stream << iter->first;
-        comm->Send(stream, 1, 12000);
-        vtkDataObject* dObj = (M > N)
-          ? gathered_extracts[iter->first].GetPointer()
-          : iter->second->GetProducer()->GetOutputDataObject(iter->second->GetIndex());
-        comm->Send(dObj, 1, 12001);
+        vtkSmartPointer<vtkSocketController> controller = comm;
+        this->Internals->Delivery =
+          std::async(std::launch::async, &::Deliver, controller, std::move(extracts));
+      }
+      else
+      {
+        retVal = ::Deliver(comm, extracts) && retVal;
       }
-      // mark end.
-      vtkMultiProcessStream stream;
-      stream << std::string("null");
-      comm->Send(stream, 1, 12000);
     }
   }
   else
@@ -222,7 +736,29 @@ bool vtkExtractsDeliveryHelper::Update()
           break;
         }
         //        cout << "Received extract for: " << key.c_str() << endl;
-        vtkDataObject* extract = comm->ReceiveDataObject(1, 12001);
+        int compressionMethod = NONE;
+        vtkTypeInt64 rawSize = 0;
+        int hasData = 0;
+        stream >> compressionMethod >> rawSize >> hasData;
+        vtkSmartPointer<vtkDataObject> extract;
+        if (hasData)
+        {
+          vtkSmartPointer<vtkDataArray> data;
+          if (compressionMethod == NONE)
+          {
+            data = vtkSmartPointer<vtkCharArray>::New();
+          }
+          else
+          {
+            data = vtkSmartPointer<vtkUnsignedCharArray>::New();
+          }
+          comm->Receive(data.GetPointer(), 1, 12001);
+          extract = ::Deserialize(compressionMethod, rawSize, data);
+          if (!extract)
+          {
+            vtkErrorMacro("Failed to read extract " << key.c_str() << ".");
+          }
+        }
         ExtractConsumersType::iterator iter;
         iter = this->ExtractConsumers.find(key);
         if (iter != this->ExtractConsumers.end())
@@ -238,7 +774,7 @@ bool vtkExtractsDeliveryHelper::Update()
         // Composite dataset need to convey their data structure across
         // processes, let's create those empty data object with the proper
         // data structure to share ONLY if needed.
-        if (extract != nullptr)
+        if (extract)
         {
           if (extract->IsA("vtkCompositeDataSet"))
           {
@@ -250,7 +786,6 @@ bool vtkExtractsDeliveryHelper::Update()
             needToShare = 1;
           }
           data_types_stream << key.c_str() << extract->GetClassName() << needToShare;
-          extract->Delete();
         }
       }
       data_types_stream << "null";
@@ -313,4 +848,10 @@ bool vtkExtractsDeliveryHelper::Update()
 void vtkExtractsDeliveryHelper::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "ProcessIsProducer: " << this->ProcessIsProducer << endl;
+  os << indent << "CompressionMethod: " << this->CompressionMethod << endl;
+  os << indent << "AsynchronousDelivery: " << this->AsynchronousDelivery << endl;
+  os << indent << "NumberOfSimulationProcesses: " << this->NumberOfSimulationProcesses << endl;
+  os << indent << "NumberOfVisualizationProcesses: " << this->NumberOfVisualizationProcesses
+     << endl;
 }
@@ -2,8 +2,18 @@
 // SPDX-License-Identifier: BSD-3-Clause
 /**
  * @class   vtkExtractsDeliveryHelper
+ * @brief   ships Catalyst Live extracts from the simulation to ParaView.
  *
+ * vtkExtractsDeliveryHelper is used by vtkLiveInsituLink on both ends of the
+ * live-insitu channel. On the simulation processes (producer), each extract is
+ * optionally reduced using its DeliveryOptions (array subset, spatial subset
+ * and sampling), serialized and compressed before being sent to the
+ * visualization processes (consumer).
  *
+ * When AsynchronousDelivery is enabled, the producer only waits for the
+ * extracts to be serialized; the data is sent on a background thread while
+ * the simulation moves on. Call Wait() before using the
+ * Simulation2VisualizationController for anything else.
  */
 
 #ifndef vtkExtractsDeliveryHelper_h
@@ -16,11 +26,14 @@
 class vtkAlgorithmOutput;
 class vtkDataObject;
 class vtkMultiProcessController;
+class vtkMultiProcessStream;
 class vtkSocketController;
 class vtkTrivialProducer;
 
 #include <map>    // needed for typedef
+#include <memory> // needed for std::unique_ptr
 #include <string> // needed for typedef
+#include <vector> // needed for std::vector
 
 class VTKREMOTINGLIVE_EXPORT vtkExtractsDeliveryHelper : public vtkObject
 {
@@ -49,11 +62,88 @@ public:
 
   void AddExtractProducer(const char* key, vtkAlgorithmOutput* producerPort);
 
+  /**
+   * Reductions applied by the producer to an extract before shipping it.
+   */
+  struct DeliveryOptions
+  {
+    /**
+     * Names of the point, cell and field arrays to ship. Empty means all.
+     */
+    std::vector<std::string> ArrayNames;
+
+    /**
+     * When UseBounds is true, only the cells intersecting Bounds
+     * (xmin, xmax, ymin, ymax, zmin, zmax) are shipped.
+     */
+    bool UseBounds = false;
+    double Bounds[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+
+    /**
+     * Keep one point out of SampleRate in each direction for structured
+     * data, and one point out of SampleRate as vertices for other datasets.
+     */
+    int SampleRate = 1;
+
+    bool IsIdentity() const;
+    void Save(vtkMultiProcessStream& stream) const;
+    void Load(vtkMultiProcessStream& stream);
+  };
+
+  /**
+   * Set the reductions to apply to the extract registered with `key` using
+   * AddExtractProducer(). Only used on the simulation processes.
+   */
+  void SetExtractDeliveryOptions(const char* key, const DeliveryOptions& options);
+
+  /**
+   * Returns a reduced copy of `dObj` following `options`, or `dObj` itself if
+   * there is nothing to reduce.
+   */
+  static vtkSmartPointer<vtkDataObject> Reduce(vtkDataObject* dObj, const DeliveryOptions& options);
+
+  /**
+   * Compression applied to the serialized extracts.
+   */
+  enum CompressionMethods
+  {
+    NONE = 0,
+    LZ4 = 1,
+    ZLIB = 2
+  };
+
+  ///@{
+  /**
+   * Set the compression used for the extracts sent by the producer. The
+   * consumer picks the method used from the received messages. Default is
+   * NONE.
+   */
+  vtkSetClampMacro(CompressionMethod, int, NONE, ZLIB);
+  vtkGetMacro(CompressionMethod, int);
+  ///@}
+
+  ///@{
+  /**
+   * When true, the producer sends the extracts on a background thread and
+   * Update() returns once they are serialized. Default is false.
+   */
+  vtkSetMacro(AsynchronousDelivery, bool);
+  vtkGetMacro(AsynchronousDelivery, bool);
+  vtkBooleanMacro(AsynchronousDelivery, bool);
+  ///@}
+
   /**
    * Returns true if the data has been made available.
    */
   bool Update();
 
+  /**
+   * Waits for the extracts sent asynchronously by the last Update() to be
+   * delivered. Returns false if sending them failed. Does nothing when no
+   * delivery is pending.
+   */
+  bool Wait();
+
   vtkSetMacro(NumberOfVisualizationProcesses, int);
   vtkGetMacro(NumberOfVisualizationProcesses, int);
   vtkSetMacro(NumberOfSimulationProcesses, int);
@@ -66,6 +156,8 @@ protected:
   vtkDataObject* Collect(int nodes_to_collect_to, vtkDataObject*);
 
   bool ProcessIsProducer;
+  int CompressionMethod;
+  bool AsynchronousDelivery;
   int NumberOfSimulationProcesses;
   int NumberOfVisualizationProcesses;
 
@@ -79,12 +171,17 @@ protected:
   typedef std::map<std::string, vtkSmartPointer<vtkAlgorithmOutput>> ExtractProducersType;
   ExtractProducersType ExtractProducers;
 
+  std::map<std::string, DeliveryOptions> ExtractDeliveryOptions;
+
   vtkSmartPointer<vtkSocketController> Simulation2VisualizationController;
   vtkSmartPointer<vtkMultiProcessController> ParallelController;
 
 private:
   vtkExtractsDeliveryHelper(const vtkExtractsDeliveryHelper&) = delete;
   void operator=(const vtkExtractsDeliveryHelper&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 };
 
 #endif
@@ -30,6 +30,7 @@
 #include "vtkSocketController.h"
 #include "vtkTrivialProducer.h"
 
+#include <algorithm>
 #include <cassert>
 #include <map>
 #include <set>
@@ -299,8 +300,25 @@ public:
     return true;
   }
 
+  /**
+   * Returns the delivery options of the extract produced by `producer`, or
+   * nullptr if it is not registered.
+   */
+  vtkExtractsDeliveryHelper::DeliveryOptions* GetDeliveryOptions(vtkTrivialProducer* producer)
+  {
+    for (const auto& extract : this->Extracts)
+    {
+      if (extract.second.GetPointer() == producer)
+      {
+        return &this->DeliveryOptions[extract.first.ToString()];
+      }
+    }
+    return nullptr;
+  }
+
   typedef std::map<Key, vtkSmartPointer<vtkTrivialProducer>> ExtractsMap;
   ExtractsMap Extracts;
+  std::map<std::string, vtkExtractsDeliveryHelper::DeliveryOptions> DeliveryOptions;
   std::map<vtkIdType, std::string> LastSentDataInformationMap;
 };
 
@@ -314,6 +332,7 @@ vtkLiveInsituLink::vtkLiveInsituLink()
   , InsituXMLStateChanged(false)
   , ExtractsChanged(false)
   , SimulationPaused(0)
+  , CompressionMethod(vtkExtractsDeliveryHelper::LZ4)
   , InsituXMLState(nullptr)
   , URL(nullptr)
   , Internals(new vtkInternals())
@@ -552,6 +571,8 @@ void vtkLiveInsituLink::InsituConnect(vtkMultiProcessController* proc0NodesContr
 
   this->ExtractsDeliveryHelper = vtkSmartPointer<vtkExtractsDeliveryHelper>::New();
   this->ExtractsDeliveryHelper->SetProcessIsProducer(this->ProcessType == LIVE ? false : true);
+  // do not hold the simulation while the extracts travel to ParaView Live.
+  this->ExtractsDeliveryHelper->SetAsynchronousDelivery(this->ProcessType == INSITU);
 
   vtkMultiProcessController* parallelController = vtkMultiProcessController::GetGlobalController();
   int numProcs = parallelController->GetNumberOfProcesses();
@@ -800,6 +821,9 @@ void vtkLiveInsituLink::InsituUpdate(double time, vtkIdType timeStep)
   // break, so add error interceptor.
   vtkCommunicationErrorCatcher catcher(this->Proc0NodesController);
 
+  // the extracts of the previous time step may still be on their way.
+  bool extracts_delivered = this->ExtractsDeliveryHelper->Wait();
+
   vtkProcessModule* pm = vtkProcessModule::GetProcessModule();
   int myId = pm->GetPartitionId();
   int numProcs = pm->GetNumberOfLocalPartitions();
@@ -875,7 +899,7 @@ void vtkLiveInsituLink::InsituUpdate(double time, vtkIdType timeStep)
   }
   delete[] buffer;
 
-  int drop_connection = catcher.GetErrorsRaised() ? 1 : 0;
+  int drop_connection = (catcher.GetErrorsRaised() || !extracts_delivered) ? 1 : 0;
   if (numProcs > 1)
   {
     pm->GetGlobalController()->Broadcast(&drop_connection, 1, 0);
@@ -911,13 +935,18 @@ void vtkLiveInsituLink::InsituUpdate(double time, vtkIdType timeStep)
   {
     assert(this->ExtractsDeliveryHelper.GetPointer() != nullptr);
     this->ExtractsDeliveryHelper->ClearAllExtracts();
+    int compressionMethod;
+    extractsPauseMessage >> compressionMethod;
+    this->ExtractsDeliveryHelper->SetCompressionMethod(compressionMethod);
     int numberOfExtracts;
     extractsPauseMessage >> numberOfExtracts;
     for (int cc = 0; cc < numberOfExtracts; cc++)
     {
       std::string group, name;
       int port;
+      vtkExtractsDeliveryHelper::DeliveryOptions options;
       extractsPauseMessage >> group >> name >> port;
+      options.Load(extractsPauseMessage);
 
       vtkSMProxy* proxy = this->InsituProxyManager->GetProxy(group.c_str(), name.c_str());
       if (proxy)
@@ -928,6 +957,8 @@ void vtkLiveInsituLink::InsituUpdate(double time, vtkIdType timeStep)
           vtkInternals::Key key(group.c_str(), name.c_str(), port);
           this->ExtractsDeliveryHelper->AddExtractProducer(
             key.ToString().c_str(), algo->GetOutputPort(port));
+          this->ExtractsDeliveryHelper->SetExtractDeliveryOptions(
+            key.ToString().c_str(), options);
         }
         else
         {
@@ -988,13 +1019,9 @@ void vtkLiveInsituLink::InsituPostProcess(double time, vtkIdType timeStep)
     return;
   }
 
-  assert(this->ExtractsDeliveryHelper);
-
-  // We're done coprocessing. Deliver the extracts to the visualization
-  // processes.
-  this->ExtractsDeliveryHelper->Update();
-
-  // Update DataInformations
+  // Update DataInformations. They are sent before the extracts since the
+  // extracts are delivered in the background and must be the last message on
+  // this step.
   if (myId == 0 && this->Proc0NodesController)
   {
     vtkClientServerStream stream;
@@ -1033,6 +1060,12 @@ void vtkLiveInsituLink::InsituPostProcess(double time, vtkIdType timeStep)
     this->Proc0NodesController->Send(&idtype_size, 1, 1, 674523);
     this->Proc0NodesController->Send(&data[0], idtype_size, 1, 674524);
   }
+
+  assert(this->ExtractsDeliveryHelper);
+
+  // We're done coprocessing. Deliver the extracts to the visualization
+  // processes.
+  this->ExtractsDeliveryHelper->Update();
 }
 
 //----------------------------------------------------------------------------
@@ -1079,11 +1112,13 @@ void vtkLiveInsituLink::OnInsituUpdate(double time, vtkIdType timeStep)
     if (this->ExtractsChanged)
     {
       extractsPauseMessage << 1;
+      extractsPauseMessage << this->CompressionMethod;
       extractsPauseMessage << static_cast<int>(this->Internals->Extracts.size());
       for (vtkInternals::ExtractsMap::iterator iter = this->Internals->Extracts.begin();
            iter != this->Internals->Extracts.end(); ++iter)
       {
         extractsPauseMessage << iter->first.Group << iter->first.Name << iter->first.Port;
+        this->Internals->DeliveryOptions[iter->first.ToString()].Save(extractsPauseMessage);
       }
     }
     else
@@ -1126,9 +1161,6 @@ void vtkLiveInsituLink::OnInsituPostProcess(double time, vtkIdType timeStep)
 
   vtkLiveInsituLinkDebugMacro(<< "vtkLiveInsituLink::OnInsituPostProcess: " << time);
 
-  // Obtains extracts from the simulations processes.
-  bool dataAvailable = this->ExtractsDeliveryHelper->Update();
-
   // Retrieve the vtkPVDataInformations
   std::map<std::pair<vtkTypeUInt32, unsigned int>, std::string> dataInformation;
   if (myId == 0 && this->Proc0NodesController)
@@ -1160,6 +1192,10 @@ void vtkLiveInsituLink::OnInsituPostProcess(double time, vtkIdType timeStep)
       dataInformation[std::pair<vtkTypeUInt32, unsigned int>(id, port)] = newStr;
     }
   }
+
+  // Obtains extracts from the simulations processes.
+  bool dataAvailable = this->ExtractsDeliveryHelper->Update();
+
   if (myId == 0 && dataAvailable)
   {
     NotifyClientDataInformationNextTimestep(
@@ -1204,6 +1240,7 @@ void vtkLiveInsituLink::UnRegisterExtract(vtkTrivialProducer* producer)
     if (iter->second.GetPointer() == producer)
     {
       this->ExtractsDeliveryHelper->RemoveExtractConsumer(iter->first.ToString().c_str());
+      this->Internals->DeliveryOptions.erase(iter->first.ToString());
       this->Internals->Extracts.erase(iter);
       this->ExtractsChanged = true;
       break;
@@ -1211,10 +1248,88 @@ void vtkLiveInsituLink::UnRegisterExtract(vtkTrivialProducer* producer)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkLiveInsituLink::ClearExtractArrays(vtkTrivialProducer* producer)
+{
+  assert(this->ProcessType == LIVE);
+  if (auto options = this->Internals->GetDeliveryOptions(producer))
+  {
+    options->ArrayNames.clear();
+    this->ExtractsChanged = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkLiveInsituLink::AddExtractArray(vtkTrivialProducer* producer, const char* arrayname)
+{
+  assert(this->ProcessType == LIVE);
+  auto options = this->Internals->GetDeliveryOptions(producer);
+  if (options && arrayname)
+  {
+    options->ArrayNames.emplace_back(arrayname);
+    this->ExtractsChanged = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkLiveInsituLink::SetExtractBounds(vtkTrivialProducer* producer, double xmin, double xmax,
+  double ymin, double ymax, double zmin, double zmax)
+{
+  assert(this->ProcessType == LIVE);
+  if (auto options = this->Internals->GetDeliveryOptions(producer))
+  {
+    options->UseBounds = true;
+    options->Bounds[0] = xmin;
+    options->Bounds[1] = xmax;
+    options->Bounds[2] = ymin;
+    options->Bounds[3] = ymax;
+    options->Bounds[4] = zmin;
+    options->Bounds[5] = zmax;
+    this->ExtractsChanged = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkLiveInsituLink::ClearExtractBounds(vtkTrivialProducer* producer)
+{
+  assert(this->ProcessType == LIVE);
+  if (auto options = this->Internals->GetDeliveryOptions(producer))
+  {
+    options->UseBounds = false;
+    this->ExtractsChanged = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkLiveInsituLink::SetExtractSampleRate(vtkTrivialProducer* producer, int rate)
+{
+  assert(this->ProcessType == LIVE);
+  if (auto options = this->Internals->GetDeliveryOptions(producer))
+  {
+    options->SampleRate = std::max(rate, 1);
+    this->ExtractsChanged = true;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkLiveInsituLink::SetCompressionMethod(int method)
+{
+  method = std::max(static_cast<int>(vtkExtractsDeliveryHelper::NONE),
+    std::min(method, static_cast<int>(vtkExtractsDeliveryHelper::ZLIB)));
+  if (this->CompressionMethod != method)
+  {
+    this->CompressionMethod = method;
+    // the compression is sent to the simulation along with the extracts.
+    this->ExtractsChanged = true;
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkLiveInsituLink::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CompressionMethod: " << this->CompressionMethod << endl;
 }
 //----------------------------------------------------------------------------
 bool vtkLiveInsituLink::FilterXMLState(vtkPVXMLElement* xmlState)
@@ -1286,6 +1401,11 @@ int vtkLiveInsituLink::WaitForLiveChange()
 
   int error = 0;
   int processRMIError = vtkMultiProcessController::RMI_NO_ERROR;
+  if (this->ExtractsDeliveryHelper)
+  {
+    // the controller must not be shared with a pending extracts delivery.
+    this->ExtractsDeliveryHelper->Wait();
+  }
   if (myId == 0)
   {
     vtkLiveInsituLinkDebugMacro(<< "ProcessRMIs " << myId);
@@ -148,6 +148,31 @@ public:
     vtkTrivialProducer* producer, const char* groupname, const char* proxyname, int portnumber);
   void UnRegisterExtract(vtkTrivialProducer* producer);
 
+  ///@{
+  /**
+   * Reduce what the simulation ships for an extract registered with
+   * RegisterExtract(): only the named arrays (all arrays when none is added),
+   * only the cells intersecting the given bounds and/or one point out of
+   * `rate` in each direction. The changes are sent to the simulation on the
+   * next LiveChanged().
+   */
+  void ClearExtractArrays(vtkTrivialProducer* producer);
+  void AddExtractArray(vtkTrivialProducer* producer, const char* arrayname);
+  void SetExtractBounds(vtkTrivialProducer* producer, double xmin, double xmax, double ymin,
+    double ymax, double zmin, double zmax);
+  void ClearExtractBounds(vtkTrivialProducer* producer);
+  void SetExtractSampleRate(vtkTrivialProducer* producer, int rate);
+  ///@}
+
+  ///@{
+  /**
+   * Compression used by the simulation to ship the extracts. Accepted values
+   * are vtkExtractsDeliveryHelper::CompressionMethods. Default is LZ4.
+   */
+  void SetCompressionMethod(int method);
+  vtkGetMacro(CompressionMethod, int);
+  ///@}
+
   void OnInsituUpdate(double time, vtkIdType timeStep);
   void OnInsituPostProcess(double time, vtkIdType timeStep);
   /**
@@ -229,6 +254,7 @@ protected:
   bool InsituXMLStateChanged;
   bool ExtractsChanged;
   int SimulationPaused;
+  int CompressionMethod;
 
   char* InsituXMLState;
   vtkWeakPointer<vtkPVSessionBase> LiveSession;
@@ -317,6 +317,53 @@ void vtkSMLiveInsituLinkProxy::RemoveExtract(vtkSMProxy* proxy)
   this->LiveChanged();
 }
 
+//----------------------------------------------------------------------------
+void vtkSMLiveInsituLinkProxy::SetExtractArrays(
+  vtkSMProxy* extract, const std::vector<std::string>& arrays)
+{
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "ClearExtractArrays"
+         << VTKOBJECT(extract) << vtkClientServerStream::End;
+  for (const auto& name : arrays)
+  {
+    stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "AddExtractArray"
+           << VTKOBJECT(extract) << name.c_str() << vtkClientServerStream::End;
+  }
+  this->ExecuteStream(stream);
+  this->LiveChanged();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMLiveInsituLinkProxy::SetExtractBounds(vtkSMProxy* extract, const double bounds[6])
+{
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "SetExtractBounds"
+         << VTKOBJECT(extract) << bounds[0] << bounds[1] << bounds[2] << bounds[3] << bounds[4]
+         << bounds[5] << vtkClientServerStream::End;
+  this->ExecuteStream(stream);
+  this->LiveChanged();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMLiveInsituLinkProxy::ClearExtractBounds(vtkSMProxy* extract)
+{
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "ClearExtractBounds"
+         << VTKOBJECT(extract) << vtkClientServerStream::End;
+  this->ExecuteStream(stream);
+  this->LiveChanged();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMLiveInsituLinkProxy::SetExtractSampleRate(vtkSMProxy* extract, int rate)
+{
+  vtkClientServerStream stream;
+  stream << vtkClientServerStream::Invoke << VTKOBJECT(this) << "SetExtractSampleRate"
+         << VTKOBJECT(extract) << rate << vtkClientServerStream::End;
+  this->ExecuteStream(stream);
+  this->LiveChanged();
+}
+
 //----------------------------------------------------------------------------
 void vtkSMLiveInsituLinkProxy::PrintSelf(ostream& os, vtkIndent indent)
 {
@@ -20,6 +20,9 @@
 #include "vtkSmartPointer.h" // needed for vtkSmartPointer.
 #include "vtkWeakPointer.h"  // needed for vtkWeakPointer.
 
+#include <string> // needed for std::string
+#include <vector> // needed for std::vector
+
 class vtkPVCatalystSessionCore;
 
 class VTKREMOTINGLIVE_EXPORT vtkSMLiveInsituLinkProxy : public vtkSMProxy
@@ -44,6 +47,20 @@ public:
   vtkSMProxy* CreateExtract(const char* reg_group, const char* reg_name, int port_number);
   void RemoveExtract(vtkSMProxy*);
   ///@}
+
+  ///@{
+  /**
+   * Reduce what the simulation ships for an extract created with
+   * CreateExtract(): only the named arrays (all when `arrays` is empty), only
+   * the cells intersecting `bounds` and/or one point out of `rate` in each
+   * direction. Combined with the CompressionMethod property, this keeps the
+   * transfers small when the client sits far from a large simulation.
+   */
+  void SetExtractArrays(vtkSMProxy* extract, const std::vector<std::string>& arrays);
+  void SetExtractBounds(vtkSMProxy* extract, const double bounds[6]);
+  void ClearExtractBounds(vtkSMProxy* extract);
+  void SetExtractSampleRate(vtkSMProxy* extract, int rate);
+  ///@}
   ///@{
   /**
    * Wakes up Insitu side if simulation is paused. Handles correctly
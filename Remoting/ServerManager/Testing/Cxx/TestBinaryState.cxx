@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Tests saving and loading the server manager state in the binary form, its
+ * conversion to and from XML, and reports the time spent saving each form.
+ */
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkProcessModule.h"
+#include "vtkSMBinaryStateUtilities.h"
+#include "vtkSMLoadStateOptionsProxy.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMProxyManager.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+int TestBinaryState(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT);
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory.\n";
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+  const std::string prefix = std::string(tempDir) + "/TestBinaryState";
+  delete[] tempDir;
+  const std::string xmlFile = prefix + ".pvsm";
+  const std::string binaryFile = prefix + ".pvsmb";
+  const std::string convertedXMLFile = prefix + "-converted.pvsm";
+  const std::string convertedBinaryFile = prefix + "-converted.pvsmb";
+  const std::string roundTripXMLFile = prefix + "-roundtrip.pvsm";
+
+  int status = EXIT_SUCCESS;
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm =
+    vtkSMProxyManager::GetProxyManager()->GetSessionProxyManager(session);
+
+  // A source with a large property array, to make the timings meaningful.
+  vtkSMSourceProxy* points =
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "PolyPointSource"));
+  std::vector<double> coordinates(3 * 20000);
+  for (size_t cc = 0; cc < coordinates.size(); ++cc)
+  {
+    coordinates[cc] = 0.001 * static_cast<double>(cc);
+  }
+  vtkSMPropertyHelper(points, "Points")
+    .Set(coordinates.data(), static_cast<unsigned int>(coordinates.size()));
+  points->UpdateVTKObjects();
+  pxm->RegisterProxy("sources", "points", points);
+  points->Delete();
+
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  pxm->SaveXMLState(xmlFile.c_str());
+  timer->StopTimer();
+  const double xmlTime = timer->GetElapsedTime();
+
+  timer->StartTimer();
+  if (!pxm->SaveBinaryState(binaryFile.c_str()))
+  {
+    cerr << "Failed to save the binary state." << endl;
+    status = EXIT_FAILURE;
+  }
+  timer->StopTimer();
+  const double binaryTime = timer->GetElapsedTime();
+
+  if (!vtkSMBinaryStateUtilities::IsBinaryState(binaryFile.c_str()) ||
+    vtkSMBinaryStateUtilities::IsBinaryState(xmlFile.c_str()))
+  {
+    cerr << "Binary states are not detected correctly." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // The conversions must be lossless.
+  if (!vtkSMBinaryStateUtilities::ConvertToXML(binaryFile.c_str(), convertedXMLFile.c_str()) ||
+    !vtkSMBinaryStateUtilities::ConvertToBinary(
+      convertedXMLFile.c_str(), convertedBinaryFile.c_str()) ||
+    !vtkSMBinaryStateUtilities::ConvertToXML(
+      convertedBinaryFile.c_str(), roundTripXMLFile.c_str()))
+  {
+    cerr << "Failed to convert the states." << endl;
+    status = EXIT_FAILURE;
+  }
+  else if (vtksys::SystemTools::FilesDiffer(xmlFile, convertedXMLFile) ||
+    vtksys::SystemTools::FilesDiffer(xmlFile, roundTripXMLFile))
+  {
+    cerr << "Converted states differ from the saved ones." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // Loading the binary state must restore the proxies.
+  pxm->UnRegisterProxies();
+  pxm->LoadBinaryState(binaryFile.c_str());
+  vtkSMProxy* loaded = pxm->GetProxy("sources", "points");
+  if (!loaded ||
+    vtkSMPropertyHelper(loaded, "Points").GetNumberOfElements() != coordinates.size() ||
+    std::abs(vtkSMPropertyHelper(loaded, "Points").GetAsDouble(42) - coordinates[42]) > 1e-12)
+  {
+    cerr << "Binary state was not loaded correctly." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // So must loading it with the options proxy used by the GUI.
+  pxm->UnRegisterProxies();
+  vtkSmartPointer<vtkSMLoadStateOptionsProxy> options;
+  options.TakeReference(
+    vtkSMLoadStateOptionsProxy::SafeDownCast(pxm->NewProxy("options", "LoadStateOptions")));
+  if (!options || !options->PrepareToLoad(binaryFile.c_str()) || !options->Load())
+  {
+    cerr << "Failed to load the binary state with options." << endl;
+    status = EXIT_FAILURE;
+  }
+  loaded = pxm->GetProxy("sources", "points");
+  if (!loaded ||
+    vtkSMPropertyHelper(loaded, "Points").GetNumberOfElements() != coordinates.size() ||
+    std::abs(vtkSMPropertyHelper(loaded, "Points").GetAsDouble(42) - coordinates[42]) > 1e-12)
+  {
+    cerr << "Binary state was not loaded correctly with options." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  cout << "Saving state: " << xmlTime << "s as XML, " << binaryTime << "s as binary ("
+       << vtksys::SystemTools::FileLength(xmlFile) << " and "
+       << vtksys::SystemTools::FileLength(binaryFile) << " bytes)." << endl;
+
+  for (const auto& fname :
+    { xmlFile, binaryFile, convertedXMLFile, convertedBinaryFile, roundTripXMLFile })
+  {
+    vtksys::SystemTools::RemoveFile(fname);
+  }
+  session->Delete();
+  vtkInitializationHelper::Finalize();
+  return status;
+}
@@ -0,0 +1,294 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Builds a data information with many arrays and reports the time spent
+ * iterating over its arrays and checking a large array selection against a
+ * string list domain, as domains do when they update.
+ *
+ * Also checks, on files with many arrays holding a dataset and a multiblock
+ * dataset, that the array selection defaults of a reader match those set one
+ * array at a time, and that the array list domain of a filter lists all the
+ * arrays.
+ */
+
+#include "vtkDoubleArray.h"
+#include "vtkInitializationHelper.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVDataSetAttributesInformation.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkProcessModule.h"
+#include "vtkSMArrayListDomain.h"
+#include "vtkSMArraySelectionDomain.h"
+#include "vtkSMParaViewPipelineController.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMStringListDomain.h"
+#include "vtkSMStringVectorProperty.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+#include "vtkXMLMultiBlockDataWriter.h"
+#include "vtkXMLPolyDataWriter.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr int NumberOfArrays = 20000;
+
+// Exposes SetStrings() to fill the domain without a pipeline.
+class vtkTestStringListDomain : public vtkSMStringListDomain
+{
+public:
+  static vtkTestStringListDomain* New();
+  vtkTypeMacro(vtkTestStringListDomain, vtkSMStringListDomain);
+  using Superclass::SetStrings;
+};
+vtkStandardNewMacro(vtkTestStringListDomain);
+
+std::string ArrayName(int cc)
+{
+  return "array_" + std::to_string(cc);
+}
+
+// Polydata with the point arrays `first` to `last` - 1.
+vtkSmartPointer<vtkPolyData> NewPolyData(int first, int last)
+{
+  auto polydata = vtkSmartPointer<vtkPolyData>::New();
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(4);
+  for (vtkIdType cc = 0; cc < 4; ++cc)
+  {
+    points->SetPoint(cc, static_cast<double>(cc), 0, 0);
+  }
+  polydata->SetPoints(points);
+  for (int cc = first; cc < last; ++cc)
+  {
+    vtkNew<vtkDoubleArray> array;
+    array->SetName(ArrayName(cc).c_str());
+    array->SetNumberOfTuples(4);
+    array->FillValue(cc);
+    polydata->GetPointData()->AddArray(array);
+  }
+  return polydata;
+}
+
+/**
+ * Sets the defaults of the point array selection of `reader` and compares
+ * them to the values set, as before the single-pass implementation, by
+ * copying the information property and setting the status of each array of
+ * the domain.
+ */
+bool CheckArraySelection(vtkSMSourceProxy* reader, const char* label)
+{
+  auto prop = vtkSMStringVectorProperty::SafeDownCast(reader->GetProperty("PointArrayStatus"));
+  auto info = vtkSMStringVectorProperty::SafeDownCast(prop->GetInformationProperty());
+  auto domain = prop->FindDomain<vtkSMArraySelectionDomain>();
+  if (!domain || domain->GetNumberOfStrings() == 0)
+  {
+    cerr << label << ": empty array selection domain." << endl;
+    return false;
+  }
+
+  vtkNew<vtkSMStringVectorProperty> expected;
+  expected->SetNumberOfElementsPerCommand(2);
+  expected->SetRepeatCommand(1);
+  expected->Copy(info);
+  if (vtkSMArraySelectionDomain::GetLoadAllVariables())
+  {
+    vtkSMPropertyHelper helper(expected);
+    for (unsigned int cc = 0; cc < domain->GetNumberOfStrings(); ++cc)
+    {
+      helper.SetStatus(domain->GetString(cc), 1);
+    }
+  }
+
+  prop->ResetToDomainDefaults();
+  if (prop->GetElements() != expected->GetElements())
+  {
+    cerr << label << ": array selection defaults differ from the per-array ones." << endl;
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Reads `fname` with arrays `first` to `last` - 1, some of them disabled, and
+ * checks the array selection defaults and the array list domain of a filter.
+ */
+bool CheckDomains(vtkSMSessionProxyManager* pxm, const char* readerName,
+  const std::string& fname, int first, int last)
+{
+  vtkNew<vtkSMParaViewPipelineController> controller;
+  vtkSmartPointer<vtkSMSourceProxy> reader;
+  reader.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", readerName)));
+  controller->PreInitializeProxy(reader);
+  vtkSMPropertyHelper(reader, "FileName").Set(fname.c_str());
+  reader->UpdateVTKObjects();
+  controller->PostInitializeProxy(reader);
+
+  // disabled arrays are enabled again only when all variables are loaded.
+  vtkSMPropertyHelper status(reader, "PointArrayStatus");
+  for (int cc = first; cc < last; cc += 3)
+  {
+    status.SetStatus(ArrayName(cc).c_str(), 0);
+  }
+  reader->UpdateVTKObjects();
+  reader->UpdatePropertyInformation();
+
+  const bool loadAll = vtkSMArraySelectionDomain::GetLoadAllVariables();
+  vtkSMArraySelectionDomain::SetLoadAllVariables(false);
+  bool success = CheckArraySelection(reader, readerName);
+  vtkSMArraySelectionDomain::SetLoadAllVariables(true);
+  success &= CheckArraySelection(reader, readerName);
+  vtkSMArraySelectionDomain::SetLoadAllVariables(loadAll);
+
+  // all the arrays are now loaded: a filter must be able to pick any of them.
+  reader->UpdateVTKObjects();
+  reader->UpdatePipeline();
+  vtkSmartPointer<vtkSMSourceProxy> filter;
+  filter.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "PassArrays")));
+  controller->PreInitializeProxy(filter);
+  vtkSMPropertyHelper(filter, "Input").Set(reader);
+  controller->PostInitializeProxy(filter);
+  auto domain = filter->GetProperty("PointDataArrays")->FindDomain<vtkSMArrayListDomain>();
+  std::vector<std::string> names, expected;
+  for (unsigned int cc = 0; domain && cc < domain->GetNumberOfStrings(); ++cc)
+  {
+    names.emplace_back(domain->GetString(cc));
+  }
+  for (int cc = first; cc < last; ++cc)
+  {
+    expected.emplace_back(ArrayName(cc));
+  }
+  std::sort(names.begin(), names.end());
+  std::sort(expected.begin(), expected.end());
+  if (names != expected)
+  {
+    cerr << readerName << ": array list domain has " << names.size() << " arrays instead of "
+         << expected.size() << "." << endl;
+    success = false;
+  }
+  return success;
+}
+
+bool TestDomains(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory." << endl;
+    return false;
+  }
+  const std::string directory = std::string(tempDir) + "/TestDomainUpdatePerformance";
+  delete[] tempDir;
+  vtksys::SystemTools::MakeDirectory(directory);
+
+  // the blocks share half of their arrays.
+  constexpr int count = 2000;
+  vtkNew<vtkXMLPolyDataWriter> polyWriter;
+  polyWriter->SetInputData(NewPolyData(0, count));
+  polyWriter->SetFileName((directory + "/arrays.vtp").c_str());
+  vtkNew<vtkMultiBlockDataSet> multiblock;
+  multiblock->SetNumberOfBlocks(2);
+  multiblock->SetBlock(0, NewPolyData(0, count));
+  multiblock->SetBlock(1, NewPolyData(count / 2, count + count / 2));
+  vtkNew<vtkXMLMultiBlockDataWriter> multiblockWriter;
+  multiblockWriter->SetInputData(multiblock);
+  multiblockWriter->SetFileName((directory + "/arrays.vtm").c_str());
+  if (!polyWriter->Write() || !multiblockWriter->Write())
+  {
+    cerr << "Failed to write the datasets." << endl;
+    return false;
+  }
+
+  bool success;
+  {
+    vtkNew<vtkSMSession> session;
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+    success = CheckDomains(pxm, "XMLPolyDataReader", directory + "/arrays.vtp", 0, count);
+    success &= CheckDomains(
+      pxm, "XMLMultiBlockDataReader", directory + "/arrays.vtm", 0, count + count / 2);
+  }
+  vtksys::SystemTools::RemoveADirectory(directory);
+  return success;
+}
+}
+
+int TestDomainUpdatePerformance(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT);
+  int status = EXIT_SUCCESS;
+
+  auto polydata = NewPolyData(0, NumberOfArrays);
+
+  vtkNew<vtkTimerLog> timer;
+  vtkNew<vtkPVDataInformation> dataInfo;
+  timer->StartTimer();
+  dataInfo->CopyFromObject(polydata);
+  timer->StopTimer();
+  const double gatherTime = timer->GetElapsedTime();
+
+  // Iterate over the arrays by index, as vtkSMArrayListDomain does.
+  vtkPVDataSetAttributesInformation* pointInfo = dataInfo->GetPointDataInformation();
+  std::vector<std::string> names;
+  timer->StartTimer();
+  for (int cc = 0; cc < pointInfo->GetNumberOfArrays(); ++cc)
+  {
+    vtkPVArrayInformation* arrayInfo = pointInfo->GetArrayInformation(cc);
+    if (arrayInfo && pointInfo->IsArrayAnAttribute(cc) == -1)
+    {
+      names.emplace_back(arrayInfo->GetName());
+    }
+  }
+  timer->StopTimer();
+  const double iterateTime = timer->GetElapsedTime();
+  if (names.size() != static_cast<size_t>(NumberOfArrays))
+  {
+    cerr << "Expected " << NumberOfArrays << " arrays, got " << names.size() << "." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // Check a selection of all the arrays, in reverse order, against the domain.
+  vtkNew<vtkTestStringListDomain> domain;
+  domain->SetStrings(names);
+  vtkNew<vtkSMStringVectorProperty> selection;
+  selection->SetUncheckedElements(std::vector<std::string>(names.rbegin(), names.rend()));
+  timer->StartTimer();
+  const int inDomain = domain->IsInDomain(selection);
+  timer->StopTimer();
+  const double checkTime = timer->GetElapsedTime();
+  unsigned int idx = 0;
+  if (!inDomain || !domain->IsInDomain(ArrayName(42).c_str(), idx) ||
+    std::string(domain->GetString(idx)) != ArrayName(42) ||
+    domain->IsInDomain("not_an_array", idx))
+  {
+    cerr << "String list domain lookups are incorrect." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  if (!TestDomains(argc, argv))
+  {
+    status = EXIT_FAILURE;
+  }
+
+  cout << "Domain update with " << NumberOfArrays << " arrays: " << gatherTime
+       << "s gathering information, " << iterateTime << "s iterating over the arrays, "
+       << checkTime << "s checking the selection." << endl;
+
+  vtkInitializationHelper::Finalize();
+  return status;
+}
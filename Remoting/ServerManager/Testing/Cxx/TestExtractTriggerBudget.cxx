@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Tests the sequence of decisions made by the `Budget` extract trigger for
+ * scripted Catalyst and simulation times.
+ */
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkProcessModule.h"
+#include "vtkSMExtractTriggerProxy.h"
+#include "vtkSMExtractsController.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSmartPointer.h"
+
+#include <iostream>
+
+namespace
+{
+/**
+ * Extracts controller reporting the costs set by the test instead of measured
+ * ones.
+ */
+class vtkScriptedExtractsController : public vtkSMExtractsController
+{
+public:
+  static vtkScriptedExtractsController* New();
+  vtkTypeMacro(vtkScriptedExtractsController, vtkSMExtractsController);
+
+  double GetCatalystTime() VTK_FUTURE_CONST override { return this->ScriptedCatalystTime; }
+  double GetSolverTime() VTK_FUTURE_CONST override { return this->ScriptedSolverTime; }
+  int GetNumberOfCycles() VTK_FUTURE_CONST override { return this->ScriptedNumberOfCycles; }
+
+  void SetCosts(int cycles, double catalystTime, double solverTime)
+  {
+    this->ScriptedNumberOfCycles = cycles;
+    this->ScriptedCatalystTime = catalystTime;
+    this->ScriptedSolverTime = solverTime;
+  }
+
+private:
+  int ScriptedNumberOfCycles = 0;
+  double ScriptedCatalystTime = 0.0;
+  double ScriptedSolverTime = 0.0;
+};
+vtkStandardNewMacro(vtkScriptedExtractsController);
+
+bool Check(vtkSMExtractTriggerProxy* trigger, vtkSMExtractsController* controller, int timestep,
+  bool expected)
+{
+  controller->SetTimeStep(timestep);
+  const bool activated = trigger->IsActivated(controller);
+  if (activated != expected)
+  {
+    std::cerr << "ERROR: trigger " << (activated ? "activated" : "skipped") << " at timestep "
+              << timestep << "." << std::endl;
+  }
+  return activated == expected;
+}
+}
+
+int TestExtractTriggerBudget(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT);
+
+  bool success = true;
+  {
+    vtkNew<vtkSMSession> session;
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+    vtkSmartPointer<vtkSMExtractTriggerProxy> trigger;
+    trigger.TakeReference(
+      vtkSMExtractTriggerProxy::SafeDownCast(pxm->NewProxy("extract_triggers", "Budget")));
+    if (!trigger)
+    {
+      std::cerr << "ERROR: failed to create the Budget trigger." << std::endl;
+      vtkInitializationHelper::Finalize();
+      return EXIT_FAILURE;
+    }
+    vtkSMPropertyHelper(trigger, "MaximumOverhead").Set(10.0);
+    vtkSMPropertyHelper(trigger, "MaximumNumberOfSkippedSteps").Set(2);
+
+    vtkNew<vtkScriptedExtractsController> controller;
+
+    // nothing accounted yet.
+    success &= Check(trigger, controller, 0, true);
+
+    // 1 s per cycle in Catalyst for 100 s in the simulation: 2% overhead.
+    controller->SetCosts(1, 1.0, 100.0);
+    success &= Check(trigger, controller, 1, true);
+
+    // 10 s per cycle: 20% overhead, skipped twice then forced.
+    controller->SetCosts(1, 10.0, 100.0);
+    success &= Check(trigger, controller, 2, false);
+    success &= Check(trigger, controller, 3, false);
+    success &= Check(trigger, controller, 4, true);
+    success &= Check(trigger, controller, 5, false);
+
+    // the decision for a timestep does not change once made.
+    controller->SetCosts(1, 1.0, 100.0);
+    success &= Check(trigger, controller, 5, false);
+
+    // back under budget, which resets the count of skipped extracts.
+    success &= Check(trigger, controller, 6, true);
+    controller->SetCosts(1, 10.0, 100.0);
+    success &= Check(trigger, controller, 7, false);
+    success &= Check(trigger, controller, 8, false);
+    controller->SetCosts(1, 1.0, 100.0);
+    success &= Check(trigger, controller, 9, true);
+
+    // no time spent in the simulation: over any budget.
+    controller->SetCosts(1, 1.0, 0.0);
+    success &= Check(trigger, controller, 10, false);
+
+    // the budget is only checked every Frequency timesteps.
+    vtkSMPropertyHelper(trigger, "Frequency").Set(3);
+    controller->SetCosts(1, 1.0, 100.0);
+    success &= Check(trigger, controller, 11, false);
+    success &= Check(trigger, controller, 12, true);
+    success &= Check(trigger, controller, 13, false);
+    success &= Check(trigger, controller, 14, false);
+    controller->SetCosts(1, 10.0, 100.0);
+    success &= Check(trigger, controller, 15, false);
+    success &= Check(trigger, controller, 18, false);
+    success &= Check(trigger, controller, 21, true);
+  }
+
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
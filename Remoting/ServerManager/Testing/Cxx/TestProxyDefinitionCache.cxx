@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Tests the binary cache of parsed proxy definitions and reports the time
+ * spent loading the core definitions with and without it.
+ */
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVProxyDefinitionIterator.h"
+#include "vtkPVXMLElement.h"
+#include "vtkProcessModule.h"
+#include "vtkSIProxyDefinitionManager.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace
+{
+// Creates a definition manager, which loads the definitions of the core and
+// the loaded plugins, and returns the time it took.
+double LoadDefinitions(vtkSmartPointer<vtkSIProxyDefinitionManager>& pdm)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  pdm = vtkSmartPointer<vtkSIProxyDefinitionManager>::New();
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+
+// Checks that the core definitions were read from the cache `reads` times,
+// and written to it otherwise.
+bool UsedCache(vtkSIProxyDefinitionManager* pdm, int reads, const char* label)
+{
+  if (pdm->GetNumberOfCacheReads() != reads || pdm->GetNumberOfCacheWrites() != 1 - reads)
+  {
+    cerr << label << ": " << pdm->GetNumberOfCacheReads() << " cache reads and "
+         << pdm->GetNumberOfCacheWrites() << " cache writes instead of " << reads << " and "
+         << 1 - reads << "." << endl;
+    return false;
+  }
+  return true;
+}
+
+std::string ReadFile(const std::string& fname)
+{
+  std::ifstream file(fname, std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+bool SameDefinitions(vtkSIProxyDefinitionManager* expected, vtkSIProxyDefinitionManager* actual)
+{
+  int count = 0;
+  vtkSmartPointer<vtkPVProxyDefinitionIterator> iter;
+  iter.TakeReference(expected->NewIterator());
+  for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextItem(), ++count)
+  {
+    vtkPVXMLElement* definition =
+      actual->GetProxyDefinition(iter->GetGroupName(), iter->GetProxyName(), false);
+    if (!iter->GetProxyDefinition()->Equals(definition))
+    {
+      cerr << "Definition of (" << iter->GetGroupName() << ", " << iter->GetProxyName()
+           << ") differs." << endl;
+      return false;
+    }
+  }
+  if (count == 0)
+  {
+    cerr << "No definition loaded." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestProxyDefinitionCache(int argc, char* argv[])
+{
+  vtksys::SystemTools::UnPutEnv("PARAVIEW_PROXY_DEFINITION_CACHE_DIR");
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory.\n";
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+  std::string directory = tempDir;
+  directory += "/TestProxyDefinitionCache";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(directory);
+  const std::string cacheFile = directory + "/vtkPVInitializerPlugin.pvsmcache";
+
+  int status = EXIT_SUCCESS;
+
+  // The cache is only used when an application opts into it.
+  vtkSmartPointer<vtkSIProxyDefinitionManager> reference;
+  const double parseTime = LoadDefinitions(reference);
+  if (!vtkSIProxyDefinitionManager::GetCacheDirectory().empty() ||
+    reference->GetNumberOfCacheReads() != 0 || reference->GetNumberOfCacheWrites() != 0)
+  {
+    cerr << "The cache is used by default." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // First run parses the XMLs and writes the cache.
+  vtkSmartPointer<vtkSIProxyDefinitionManager> pdm;
+  vtkSIProxyDefinitionManager::SetCacheDirectory(directory);
+  const double coldTime = LoadDefinitions(pdm);
+  if (!vtksys::SystemTools::FileExists(cacheFile, true) || !UsedCache(pdm, 0, "first run"))
+  {
+    cerr << "Cache file " << cacheFile << " was not written." << endl;
+    status = EXIT_FAILURE;
+  }
+  const std::string cache = ReadFile(cacheFile);
+
+  // Second run reads the cache, without rewriting it.
+  const double warmTime = LoadDefinitions(pdm);
+  if (!UsedCache(pdm, 1, "second run") || !SameDefinitions(reference, pdm))
+  {
+    cerr << "Definitions read from the cache differ from the parsed ones." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // A cache written for other XMLs must be ignored and rewritten. Change the
+  // hash that follows the magic string and the format version.
+  {
+    std::string stale = cache;
+    stale[12] = static_cast<char>(stale[12] ^ 0xff);
+    std::ofstream file(cacheFile, std::ios::out | std::ios::binary | std::ios::trunc);
+    file.write(stale.c_str(), stale.size());
+  }
+  LoadDefinitions(pdm);
+  if (!UsedCache(pdm, 0, "stale cache") || !SameDefinitions(reference, pdm))
+  {
+    cerr << "Definitions differ after a stale cache." << endl;
+    status = EXIT_FAILURE;
+  }
+  if (ReadFile(cacheFile) != cache)
+  {
+    cerr << "Stale cache was not rewritten." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  // A corrupted cache must be ignored and rewritten.
+  {
+    std::ofstream file(cacheFile, std::ios::out | std::ios::binary | std::ios::trunc);
+    file << "PVSMCACHE-not-a-cache";
+  }
+  LoadDefinitions(pdm);
+  if (!UsedCache(pdm, 0, "corrupted cache") || !SameDefinitions(reference, pdm))
+  {
+    cerr << "Definitions differ after a corrupted cache." << endl;
+    status = EXIT_FAILURE;
+  }
+  if (ReadFile(cacheFile) != cache)
+  {
+    cerr << "Corrupted cache was not rewritten." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  cout << "Loading proxy definitions: " << parseTime << "s without cache, " << coldTime
+       << "s writing the cache, " << warmTime << "s reading the cache." << endl;
+
+  vtkSIProxyDefinitionManager::SetCacheDirectory(std::string());
+  vtksys::SystemTools::RemoveADirectory(directory);
+  reference = nullptr;
+  pdm = nullptr;
+  vtkInitializationHelper::Finalize();
+  return status;
+}
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Tests that vtkSMStateVersionController converts states saved by older
+ * versions and leaves states saved by the current version untouched.
+ */
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+#include "vtkProcessModule.h"
+#include "vtkSMProxyManager.h"
+#include "vtkSMStateVersionController.h"
+#include "vtkSmartPointer.h"
+
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// A state with a proxy renamed in 5.13.
+vtkSmartPointer<vtkPVXMLElement> NewState(const std::string& version, vtkPVXMLParser* parser)
+{
+  const std::string xml = "<ServerManagerState version=\"" + version +
+    "\">"
+    "  <Proxy group=\"filters\" type=\"StreakLine\" id=\"1\" servers=\"1\" />"
+    "</ServerManagerState>";
+  if (!parser->Parse(xml.c_str()))
+  {
+    return nullptr;
+  }
+  return parser->GetRootElement();
+}
+
+bool Check(bool condition, const char* message)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << message << std::endl;
+  }
+  return condition;
+}
+}
+
+int TestStateVersionController(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT);
+
+  bool success = true;
+  {
+    vtkNew<vtkSMStateVersionController> controller;
+
+    // an older state is converted.
+    vtkNew<vtkPVXMLParser> olderParser;
+    auto older = ::NewState("5.12.0", olderParser);
+    success &= Check(older != nullptr && controller->Process(older), "Failed to convert.");
+    auto proxy = older ? older->FindNestedElementByName("Proxy") : nullptr;
+    success &= Check(proxy && strcmp(proxy->GetAttribute("type"), "LegacyStreakLine") == 0,
+      "State saved by 5.12.0 was not converted.");
+
+    // a state saved by the current version is left as is, element included.
+    std::ostringstream version;
+    version << vtkSMProxyManager::GetVersionMajor() << "." << vtkSMProxyManager::GetVersionMinor()
+            << "." << vtkSMProxyManager::GetVersionPatch();
+    vtkNew<vtkPVXMLParser> currentParser;
+    auto current = ::NewState(version.str(), currentParser);
+    proxy = current ? current->FindNestedElementByName("Proxy") : nullptr;
+    success &= Check(proxy && controller->Process(current), "Failed to process.");
+    success &= Check(current && current->FindNestedElementByName("Proxy") == proxy &&
+        strcmp(proxy->GetAttribute("type"), "StreakLine") == 0,
+      "State saved by the current version was modified.");
+  }
+
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
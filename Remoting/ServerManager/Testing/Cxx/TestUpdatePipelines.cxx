@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Tests vtkSMSourceProxy::UpdatePipelines() on sources with a shared upstream
+ * source and an independent one on another location, with and without
+ * concurrent updates: the outputs must match those of sources updated one at
+ * a time.
+ */
+
+#include "vtkCollection.h"
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPVPipelineScheduler.h"
+#include "vtkPVSession.h"
+#include "vtkProcessModule.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+
+#include <iostream>
+#include <vector>
+
+namespace
+{
+vtkSmartPointer<vtkSMSourceProxy> NewSource(vtkSMSessionProxyManager* pxm, const char* group,
+  const char* name, vtkSMProxy* input = nullptr, vtkTypeUInt32 location = 0)
+{
+  vtkSmartPointer<vtkSMSourceProxy> source;
+  source.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy(group, name)));
+  if (location)
+  {
+    source->SetLocation(location);
+  }
+  if (input)
+  {
+    vtkSMPropertyHelper(source, "Input").Set(input);
+  }
+  source->UpdateVTKObjects();
+  return source;
+}
+
+/**
+ * A sphere shrunk by two filters sharing it, and an independent cone on
+ * another location, which is updated with a request of its own.
+ */
+std::vector<vtkSmartPointer<vtkSMSourceProxy>> NewPipeline(
+  vtkSMSessionProxyManager* pxm, int resolution)
+{
+  auto sphere = NewSource(pxm, "sources", "SphereSource");
+  vtkSMPropertyHelper(sphere, "ThetaResolution").Set(resolution);
+  vtkSMPropertyHelper(sphere, "PhiResolution").Set(resolution);
+  sphere->UpdateVTKObjects();
+  auto cone = NewSource(pxm, "sources", "ConeSource", nullptr, vtkPVSession::CLIENT);
+  vtkSMPropertyHelper(cone, "Resolution").Set(resolution);
+  cone->UpdateVTKObjects();
+  return { NewSource(pxm, "filters", "ShrinkFilter", sphere),
+    NewSource(pxm, "filters", "ShrinkFilter", sphere), cone };
+}
+
+bool CompareOutputs(const std::vector<vtkSmartPointer<vtkSMSourceProxy>>& sources,
+  const std::vector<vtkSmartPointer<vtkSMSourceProxy>>& references, const char* label)
+{
+  bool success = true;
+  for (size_t cc = 0; cc < sources.size(); ++cc)
+  {
+    auto info = sources[cc]->GetDataInformation(0);
+    auto reference = references[cc]->GetDataInformation(0);
+    if (info->GetNumberOfCells() == 0 ||
+      info->GetNumberOfCells() != reference->GetNumberOfCells() ||
+      info->GetNumberOfPoints() != reference->GetNumberOfPoints())
+    {
+      std::cerr << "ERROR: " << label << ": source " << cc << " has "
+                << info->GetNumberOfCells() << " cells instead of "
+                << reference->GetNumberOfCells() << "." << std::endl;
+      success = false;
+    }
+  }
+  return success;
+}
+
+bool TestUpdatePipelines(vtkSMSessionProxyManager* pxm, bool concurrent)
+{
+  vtkPVPipelineScheduler::SetEnableConcurrentUpdates(concurrent);
+  const char* label = concurrent ? "concurrent" : "sequential";
+
+  const auto references = NewPipeline(pxm, 32);
+  for (const auto& reference : references)
+  {
+    reference->UpdatePipeline();
+  }
+
+  const auto sources = NewPipeline(pxm, 32);
+  vtkNew<vtkCollection> collection;
+  for (const auto& source : sources)
+  {
+    collection->AddItem(source);
+  }
+  vtkSMSourceProxy::UpdatePipelines(collection);
+  bool success = CompareOutputs(sources, references, label);
+
+  // modified sources are updated again.
+  for (const auto& pipeline : { sources, references })
+  {
+    vtkSMPropertyHelper(pipeline[2], "Resolution").Set(8);
+    pipeline[2]->UpdateVTKObjects();
+  }
+  references[2]->UpdatePipeline();
+  vtkSMSourceProxy::UpdatePipelines(collection, 0.0);
+  success &= CompareOutputs(sources, references, label);
+  return success;
+}
+}
+
+int TestUpdatePipelines(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT);
+
+  const bool enabled = vtkPVPipelineScheduler::GetEnableConcurrentUpdates();
+  bool success = true;
+  {
+    vtkNew<vtkSMSession> session;
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+    success &= ::TestUpdatePipelines(pxm, false);
+    success &= ::TestUpdatePipelines(pxm, true);
+  }
+  vtkPVPipelineScheduler::SetEnableConcurrentUpdates(enabled);
+
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
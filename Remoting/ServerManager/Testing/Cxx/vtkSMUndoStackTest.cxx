@@ -13,6 +13,8 @@
 #include "vtkSMUndoStack.h"
 #include "vtkUndoSet.h"
 
+#include <vector>
+
 void vtkSMUndoStackTest::UndoRedo()
 {
   vtkSMSession* session = vtkSMSession::New();
@@ -65,3 +67,65 @@ void vtkSMUndoStackTest::StackDepth()
   QCOMPARE(stack->GetStackDepth(), 10);
   stack->Delete();
 }
+
+void vtkSMUndoStackTest::MemoryBudget()
+{
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSMProxy* line = pxm->NewProxy("sources", "PolyLineSource");
+  std::vector<double> points(3 * 10000, 1.0);
+  vtkSMPropertyHelper(line, "Points").Set(points.data(), static_cast<unsigned int>(points.size()));
+  line->UpdateVTKObjects();
+
+  vtkSMUndoStack* undoStack = vtkSMUndoStack::New();
+  QCOMPARE(undoStack->GetActualMemorySize(), 0ul);
+
+  // Toggle a small property several times: the large points are not copied
+  // by each undo set.
+  for (int cc = 0; cc < 8; ++cc)
+  {
+    vtkSMMessage before;
+    before.CopyFrom(*line->GetFullState());
+    vtkSMPropertyHelper(line, "Closed").Set((cc + 1) % 2);
+    line->UpdateVTKObjects();
+    vtkSMMessage after;
+    after.CopyFrom(*line->GetFullState());
+
+    vtkUndoSet* undoSet = vtkUndoSet::New();
+    vtkSMRemoteObjectUpdateUndoElement* undoElement = vtkSMRemoteObjectUpdateUndoElement::New();
+    undoElement->SetSession(session);
+    undoElement->SetUndoRedoState(&before, &after);
+    undoSet->AddElement(undoElement);
+    undoElement->Delete();
+    undoStack->Push("ToggleClosed", undoSet);
+    undoSet->Delete();
+  }
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 8u);
+  const unsigned long pointsSize = points.size() * sizeof(double) / 1024;
+  QVERIFY(undoStack->GetActualMemorySize() > pointsSize / 2);
+  QVERIFY(undoStack->GetActualMemorySize() < 3 * pointsSize);
+
+  // Undo still restores the full state.
+  undoStack->Undo();
+  line->UpdateVTKObjects();
+  QCOMPARE(vtkSMPropertyHelper(line, "Closed").GetAsInt(), 1);
+  QCOMPARE(vtkSMPropertyHelper(line, "Points").GetNumberOfElements(),
+    static_cast<unsigned int>(points.size()));
+
+  // Exceeding the budget evicts the oldest sets, keeping the latest one.
+  undoStack->SetMemoryBudget(1);
+  vtkUndoSet* undoSet = vtkUndoSet::New();
+  vtkSMPropertyModificationUndoElement* modification = vtkSMPropertyModificationUndoElement::New();
+  modification->ModifiedProperty(line, "Points");
+  undoSet->AddElement(modification);
+  modification->Delete();
+  undoStack->Push("ModifyPoints", undoSet);
+  undoSet->Delete();
+  QCOMPARE(undoStack->GetNumberOfUndoSets(), 1u);
+  QCOMPARE(undoStack->GetNumberOfRedoSets(), 0u);
+
+  undoStack->Delete();
+  line->Delete();
+  session->Delete();
+}
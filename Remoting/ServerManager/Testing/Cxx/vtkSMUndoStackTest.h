@@ -13,6 +13,7 @@ class vtkSMUndoStackTest : public QObject
 private Q_SLOTS:
   void UndoRedo();
   void StackDepth();
+  void MemoryBudget();
 };
 
 #endif
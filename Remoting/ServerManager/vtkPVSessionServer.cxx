@@ -532,6 +532,26 @@ void vtkPVSessionServer::OnClientServerMessageRMI(void* message, int message_len
     }
     break;
 
+    case vtkPVSessionServer::PUSH_BATCH:
+    {
+      // Several states pushed by the client within a push batch, processed
+      // in order as if they had been sent one PUSH at a time.
+      std::string string;
+      stream >> string;
+      vtkSMMessageCollection collection;
+      collection.ParseFromString(string);
+      for (int cc = 0; cc < collection.item_size(); ++cc)
+      {
+        vtkSMMessage* msg = collection.mutable_item(cc);
+        if (!this->Internal->StoreShareOnly(msg))
+        {
+          this->PushState(msg);
+        }
+        this->NotifyOtherClients(msg);
+      }
+    }
+    break;
+
     case vtkPVSessionServer::PULL:
     {
       std::string string;
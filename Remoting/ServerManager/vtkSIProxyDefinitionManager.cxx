@@ -12,16 +12,21 @@
 #include "vtkPVProxyDefinitionIterator.h"
 #include "vtkPVServerManagerPluginInterface.h"
 #include "vtkPVSession.h"
+#include "vtkPVVersion.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
 #include "vtkProcessModule.h"
 #include "vtkReservedRemoteObjectIds.h"
+#include "vtkSMCoreUtilities.h"
 #include "vtkSMMessage.h"
 #include "vtkSmartPointer.h"
 #include "vtkStringList.h"
 #include "vtkTimerLog.h"
 
 #include <cassert>
+#include <cctype>
+#include <cstring>
+#include <fstream>
 #include <map>
 #include <set>
 #include <sstream>
@@ -29,6 +34,7 @@
 #include <vector>
 
 #include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemTools.hxx>
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -37,6 +43,170 @@ typedef vtkSmartPointer<vtkPVXMLElement> XMLElement;
 typedef std::map<std::string, XMLElement> StrToXmlMap;
 typedef std::map<std::string, StrToXmlMap> StrToStrToXmlMap;
 
+namespace
+{
+std::string CacheDirectory;
+
+// Bump when the layout of the cache files changes.
+constexpr vtkTypeUInt32 CacheFormatVersion = 1;
+const char CacheMagic[8] = { 'P', 'V', 'S', 'M', 'C', 'A', 'C', 'H' };
+
+// 64-bit FNV-1a, used to detect stale caches.
+vtkTypeUInt64 HashConfigurationXMLs(const std::vector<std::string>& xmls)
+{
+  vtkTypeUInt64 hash = 14695981039346656037ull;
+  auto update = [&hash](const char* data, size_t length) {
+    for (size_t cc = 0; cc < length; ++cc)
+    {
+      hash ^= static_cast<unsigned char>(data[cc]);
+      hash *= 1099511628211ull;
+    }
+  };
+  const char* version = PARAVIEW_VERSION_FULL;
+  update(version, strlen(version));
+  for (const auto& xml : xmls)
+  {
+    vtkTypeUInt64 length = xml.size();
+    update(reinterpret_cast<const char*>(&length), sizeof(length));
+    update(xml.c_str(), xml.size());
+  }
+  return hash;
+}
+
+std::string GetCacheFileName(const std::string& pluginName)
+{
+  std::string directory = vtkSIProxyDefinitionManager::GetCacheDirectory();
+  if (directory.empty())
+  {
+    return std::string();
+  }
+  std::string name = pluginName;
+  for (auto& c : name)
+  {
+    if (!isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '-' && c != '.')
+    {
+      c = '_';
+    }
+  }
+  return directory + "/" + name + ".pvsmcache";
+}
+
+// Reads the parsed XMLs saved in `fname`. Fails if the file is missing,
+// corrupted or was written for other XMLs.
+bool ReadCache(
+  const std::string& fname, vtkTypeUInt64 hash, size_t count, std::vector<XMLElement>& roots)
+{
+  std::ifstream file(fname, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    return false;
+  }
+  std::string buffer(static_cast<size_t>(file.tellg()), '\0');
+  file.seekg(0);
+  if (!file.read(&buffer[0], buffer.size()))
+  {
+    return false;
+  }
+
+  const char* data = buffer.c_str();
+  const char* end = data + buffer.size();
+  vtkTypeUInt32 version;
+  vtkTypeUInt64 fileHash, fileCount;
+  const size_t headerSize =
+    sizeof(CacheMagic) + sizeof(version) + sizeof(fileHash) + sizeof(fileCount);
+  if (buffer.size() < headerSize || memcmp(data, CacheMagic, sizeof(CacheMagic)) != 0)
+  {
+    return false;
+  }
+  data += sizeof(CacheMagic);
+  memcpy(&version, data, sizeof(version));
+  data += sizeof(version);
+  memcpy(&fileHash, data, sizeof(fileHash));
+  data += sizeof(fileHash);
+  memcpy(&fileCount, data, sizeof(fileCount));
+  data += sizeof(fileCount);
+  if (version != CacheFormatVersion || fileHash != hash || fileCount != count)
+  {
+    return false;
+  }
+
+  roots.clear();
+  for (size_t cc = 0; cc < count; ++cc)
+  {
+    // a nul byte marks an XML that failed to parse.
+    if (data == end)
+    {
+      return false;
+    }
+    XMLElement root;
+    if (*data++ != 0)
+    {
+      root.TakeReference(vtkPVXMLElement::NewFromBinary(data, end));
+      if (!root)
+      {
+        return false;
+      }
+    }
+    roots.push_back(root);
+  }
+  return data == end;
+}
+
+// Saves the parsed XMLs in `fname`. The file is written under a temporary
+// name first so that concurrent processes never read a partial cache.
+void WriteCache(const std::string& fname, vtkTypeUInt64 hash, const std::vector<XMLElement>& roots)
+{
+  std::string buffer(CacheMagic, sizeof(CacheMagic));
+  vtkTypeUInt64 count = roots.size();
+  buffer.append(reinterpret_cast<const char*>(&CacheFormatVersion), sizeof(CacheFormatVersion));
+  buffer.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+  buffer.append(reinterpret_cast<const char*>(&count), sizeof(count));
+  for (const auto& root : roots)
+  {
+    buffer.push_back(root ? 1 : 0);
+    if (root)
+    {
+      root->SerializeBinary(buffer);
+    }
+  }
+
+  vtksys::SystemTools::MakeDirectory(vtksys::SystemTools::GetFilenamePath(fname));
+  vtkSMCoreUtilities::WriteFileAtomically(fname, buffer);
+}
+
+// Parses the configuration XMLs of a plugin, using the cache when possible.
+// XMLs that fail to parse are returned as nullptr. `reads` and `writes` count
+// the uses of the cache.
+std::vector<XMLElement> ParseConfigurationXMLs(const std::string& pluginName,
+  const std::vector<std::string>& xmls, int& reads, int& writes)
+{
+  std::vector<XMLElement> roots;
+  const std::string fname = GetCacheFileName(pluginName);
+  const vtkTypeUInt64 hash = fname.empty() ? 0 : HashConfigurationXMLs(xmls);
+  if (!fname.empty() && ReadCache(fname, hash, xmls.size(), roots))
+  {
+    ++reads;
+    return roots;
+  }
+
+  roots.clear();
+  for (const auto& xml : xmls)
+  {
+    vtkNew<vtkPVXMLParser> parser;
+    roots.emplace_back(parser->Parse(xml.c_str()) != 0 ? parser->GetRootElement() : nullptr);
+  }
+
+  // Satellites of a parallel server would all write the same file.
+  auto pm = vtkProcessModule::GetProcessModule();
+  if (!fname.empty() && (pm == nullptr || pm->GetPartitionId() == 0))
+  {
+    WriteCache(fname, hash, roots);
+    ++writes;
+  }
+  return roots;
+}
+}
+
 class vtkSIProxyDefinitionManager::vtkInternals
 {
 public:
@@ -413,6 +583,8 @@ vtkSIProxyDefinitionManager::vtkSIProxyDefinitionManager()
 {
   this->Internals = new vtkInternals;
   this->InternalsFlatten = new vtkInternals;
+  this->NumberOfCacheReads = 0;
+  this->NumberOfCacheWrites = 0;
 
   vtkPVPluginTracker* tracker = vtkPVPluginTracker::GetInstance();
 
@@ -870,6 +1042,9 @@ bool vtkSIProxyDefinitionManager::LoadConfigurationXML(
 void vtkSIProxyDefinitionManager::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheDirectory: " << vtkSIProxyDefinitionManager::GetCacheDirectory() << endl;
+  os << indent << "NumberOfCacheReads: " << this->NumberOfCacheReads << endl;
+  os << indent << "NumberOfCacheWrites: " << this->NumberOfCacheWrites << endl;
 }
 //---------------------------------------------------------------------------
 // vtkSIProxyDefinitionManager::ALL_DEFINITIONS    = 0
@@ -1259,9 +1434,11 @@ void vtkSIProxyDefinitionManager::HandlePlugin(vtkPVPlugin* plugin)
     {
       bool tmpReplaceOverrideInParent = this->Internals->ReplaceOverrideInParent;
       this->Internals->ReplaceOverrideInParent = false;
-      for (size_t cc = 0; cc < xmls.size(); cc++)
+      std::vector<XMLElement> roots = ParseConfigurationXMLs(
+        plugin->GetPluginName(), xmls, this->NumberOfCacheReads, this->NumberOfCacheWrites);
+      for (const auto& root : roots)
       {
-        this->LoadConfigurationXMLFromString(xmls[cc].c_str(), !core, false,
+        this->LoadConfigurationXML(root, !core, false,
           smplugin->GetEnsurePluginLoaded() ? plugin->GetPluginName() : "");
       }
 
@@ -1273,6 +1450,23 @@ void vtkSIProxyDefinitionManager::HandlePlugin(vtkPVPlugin* plugin)
   }
 }
 
+//---------------------------------------------------------------------------
+void vtkSIProxyDefinitionManager::SetCacheDirectory(const std::string& directory)
+{
+  CacheDirectory = directory;
+}
+
+//---------------------------------------------------------------------------
+std::string vtkSIProxyDefinitionManager::GetCacheDirectory()
+{
+  std::string directory;
+  if (vtksys::SystemTools::GetEnv("PARAVIEW_PROXY_DEFINITION_CACHE_DIR", directory))
+  {
+    return directory;
+  }
+  return CacheDirectory;
+}
+
 //---------------------------------------------------------------------------
 bool vtkSIProxyDefinitionManager::HasDefinition(const char* groupName, const char* proxyName)
 {
@@ -33,6 +33,8 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSIObject.h"
 
+#include <string> // for std::string
+
 class vtkPVPlugin;
 class vtkPVProxyDefinitionIterator;
 class vtkPVXMLElement;
@@ -145,6 +147,32 @@ public:
   bool LoadConfigurationXMLFromString(const char* xmlContent);
   ///@}
 
+  ///@{
+  /**
+   * Directory holding a binary cache of the parsed configuration XMLs. When
+   * set, the XMLs provided by the ParaView core and by each plugin are saved,
+   * once parsed, to `<directory>/<plugin name>.pvsmcache`. Later runs read the
+   * cache instead of parsing the XMLs again. A cache is only used when its
+   * hash, computed from the ParaView version and the content of the XMLs,
+   * matches; otherwise it is rewritten. When defined, the
+   * `PARAVIEW_PROXY_DEFINITION_CACHE_DIR` environment variable takes
+   * precedence; an empty value disables the cache. Empty by default, so the
+   * cache is only used by applications that opt into it.
+   */
+  static void SetCacheDirectory(const std::string& directory);
+  static std::string GetCacheDirectory();
+  ///@}
+
+  ///@{
+  /**
+   * Number of plugins, the ParaView core included, whose configuration XMLs
+   * were read from the cache, or parsed and saved to the cache, by this
+   * instance.
+   */
+  vtkGetMacro(NumberOfCacheReads, int);
+  vtkGetMacro(NumberOfCacheWrites, int);
+  ///@}
+
   enum Events
   {
     ProxyDefinitionsUpdated = 2000,
@@ -328,6 +356,8 @@ private:
   class vtkInternals;
   vtkInternals* Internals;
   vtkInternals* InternalsFlatten;
+  int NumberOfCacheReads;
+  int NumberOfCacheWrites;
 };
 
 #endif
@@ -4,6 +4,7 @@
 
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
+#include "vtkCallbackCommand.h"
 #include "vtkClientServerInterpreter.h"
 #include "vtkClientServerStreamInstantiator.h"
 #include "vtkCommand.h"
@@ -11,9 +12,11 @@
 #include "vtkCompositeDataSet.h"
 #include "vtkInformation.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVCompositeDataPipeline.h"
 #include "vtkPVLogger.h"
+#include "vtkPVPipelineScheduler.h"
 #include "vtkPVPostFilter.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPolyData.h"
@@ -21,12 +24,62 @@
 #include "vtkSMMessage.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkTimerLog.h"
+#include "vtkWeakPointer.h"
 #include "vtkUnstructuredGrid.h"
 
 #include <cassert>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
+namespace
+{
+// Output ports scheduled with ScheduleUpdatePipeline(), updated together by
+// UpdateScheduledPipelines().
+vtkPVPipelineScheduler* GetPipelineScheduler()
+{
+  static auto scheduler = vtkSmartPointer<vtkPVPipelineScheduler>::New();
+  return scheduler;
+}
+
+// The interpreter processing the stream that schedules output ports: if a
+// message of that stream fails, the stream stops before reaching
+// UpdateScheduledPipelines(), so the scheduled output ports are removed then.
+vtkWeakPointer<vtkClientServerInterpreter> ObservedInterpreter;
+unsigned long ObserverId = 0;
+
+void RemoveScheduledOutputPorts()
+{
+  ::GetPipelineScheduler()->RemoveAllOutputPorts();
+  if (::ObservedInterpreter)
+  {
+    ::ObservedInterpreter->RemoveObserver(::ObserverId);
+  }
+  ::ObservedInterpreter = nullptr;
+}
+
+void OnInterpreterError(vtkObject*, unsigned long, void*, void*)
+{
+  ::RemoveScheduledOutputPorts();
+}
+
+void ObserveErrors(vtkClientServerInterpreter* interpreter)
+{
+  if (interpreter && interpreter != ::ObservedInterpreter)
+  {
+    ::RemoveScheduledOutputPorts();
+    vtkNew<vtkCallbackCommand> observer;
+    observer->SetCallback(&::OnInterpreterError);
+    ::ObserverId = interpreter->AddObserver(vtkCommand::UserEvent, observer);
+    ::ObservedInterpreter = interpreter;
+  }
+}
+
+// The timer log is not thread safe, and algorithms may execute concurrently
+// in UpdateScheduledPipelines().
+std::mutex TimerLogMutex;
+}
+
 //*****************************************************************************
 class vtkSISourceProxy::vtkInternals
 {
@@ -196,11 +249,11 @@ bool vtkSISourceProxy::ReadXMLAttributes(vtkPVXMLElement* element)
 }
 
 //----------------------------------------------------------------------------
-void vtkSISourceProxy::UpdatePipeline(int port, double time, bool doTime)
+vtkAlgorithmOutput* vtkSISourceProxy::PrepareUpdatePipeline(int port, double time, bool doTime)
 {
   if (this->DisablePipelineExecution)
   {
-    return;
+    return nullptr;
   }
 
   int processid = vtkMultiProcessController::GetGlobalController()->GetLocalProcessId();
@@ -210,12 +263,9 @@ void vtkSISourceProxy::UpdatePipeline(int port, double time, bool doTime)
   vtkAlgorithmOutput* output_port = this->GetOutputPort(port);
   if (!output_port)
   {
-    return;
+    return nullptr;
   }
 
-  vtkVLogScopeF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "%s: update pipeline(%d, %f, %s) ",
-    this->GetLogNameOrDefault(), port, time, (doTime ? "true" : "false"));
-
   vtkAlgorithm* algo = output_port->GetProducer();
   assert(algo);
 
@@ -240,7 +290,43 @@ void vtkSISourceProxy::UpdatePipeline(int port, double time, bool doTime)
   {
     outInfo->Set(sddp->UPDATE_TIME_STEP(), time);
   }
-  sddp->Update(real_port);
+  return output_port;
+}
+
+//----------------------------------------------------------------------------
+void vtkSISourceProxy::UpdatePipeline(int port, double time, bool doTime)
+{
+  vtkAlgorithmOutput* output_port = this->PrepareUpdatePipeline(port, time, doTime);
+  if (!output_port)
+  {
+    return;
+  }
+
+  vtkVLogScopeF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "%s: update pipeline(%d, %f, %s) ",
+    this->GetLogNameOrDefault(), port, time, (doTime ? "true" : "false"));
+
+  vtkStreamingDemandDrivenPipeline* sddp =
+    vtkStreamingDemandDrivenPipeline::SafeDownCast(output_port->GetProducer()->GetExecutive());
+  sddp->Update(output_port->GetIndex());
+}
+
+//----------------------------------------------------------------------------
+void vtkSISourceProxy::ScheduleUpdatePipeline(int port, double time, bool doTime)
+{
+  if (vtkAlgorithmOutput* output_port = this->PrepareUpdatePipeline(port, time, doTime))
+  {
+    vtkVLogF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "%s: schedule update pipeline(%d, %f, %s) ",
+      this->GetLogNameOrDefault(), port, time, (doTime ? "true" : "false"));
+    ::ObserveErrors(this->GetInterpreter());
+    ::GetPipelineScheduler()->AddOutputPort(output_port);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSISourceProxy::UpdateScheduledPipelines()
+{
+  ::GetPipelineScheduler()->Update();
+  ::RemoveScheduledOutputPorts();
 }
 
 //----------------------------------------------------------------------------
@@ -286,6 +372,7 @@ void vtkSISourceProxy::MarkStartEvent()
 {
   if (this->StartEventCounter++ == 0)
   {
+    std::lock_guard<std::mutex> lock(::TimerLogMutex);
     std::ostringstream filterName;
     filterName << "Execute " << this->GetLogNameOrDefault() << " id: " << this->GetGlobalID();
     vtkTimerLog::MarkStartEvent(filterName.str().c_str());
@@ -300,6 +387,7 @@ void vtkSISourceProxy::MarkEndEvent()
 {
   if (--this->StartEventCounter == 0)
   {
+    std::lock_guard<std::mutex> lock(::TimerLogMutex);
     vtkLogEndScope(vtkLogIdentifier(this));
 
     std::ostringstream filterName;
@@ -43,6 +43,20 @@ public:
    */
   virtual void UpdatePipeline(int port, double time, bool doTime);
 
+  ///@{
+  /**
+   * Schedules the update of an output port, like UpdatePipeline() does, and
+   * updates all the scheduled output ports with a vtkPVPipelineScheduler.
+   * Independent branches of the pipeline are updated concurrently when
+   * vtkPVPipelineScheduler::GetEnableConcurrentUpdates() is true. When a
+   * message of the stream fails before UpdateScheduledPipelines(), the
+   * scheduled output ports are removed.
+   * Called from client by vtkSMSourceProxy::UpdatePipelines().
+   */
+  virtual void ScheduleUpdatePipeline(int port, double time, bool doTime);
+  static void UpdateScheduledPipelines();
+  ///@}
+
   /**
    * setups extract selection proxies.
    */
@@ -88,6 +102,12 @@ protected:
    */
   virtual bool CreateOutputPorts();
 
+  /**
+   * Sets the update request of an output port for an update. Returns the
+   * output port, or nullptr if it should not be updated.
+   */
+  vtkAlgorithmOutput* PrepareUpdatePipeline(int port, double time, bool doTime);
+
   ///@{
   /**
    * Callbacks to add start/end events to the timer log.
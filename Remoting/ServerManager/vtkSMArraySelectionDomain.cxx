@@ -5,8 +5,13 @@
 #include "vtkObjectFactory.h"
 #include "vtkPVXMLElement.h"
 #include "vtkSMPropertyHelper.h"
+#include "vtkSMStringVectorProperty.h"
 #include "vtkSMVectorProperty.h"
 
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 vtkStandardNewMacro(vtkSMArraySelectionDomain);
 
 //---------------------------------------------------------------------------
@@ -32,16 +37,45 @@ int vtkSMArraySelectionDomain::SetDefaultValues(vtkSMProperty* prop, bool use_un
 
     vprop->Copy(infoProp);
 
-    if (vtkSMArraySelectionDomain::LoadAllVariables == true)
+    vtkPVXMLElement* omitFromLoadAllVariablesHint =
+      (prop->GetHints() ? prop->GetHints()->FindNestedElementByName("OmitFromLoadAllVariables")
+                        : nullptr);
+    if (vtkSMArraySelectionDomain::LoadAllVariables == true && !omitFromLoadAllVariablesHint)
     {
-      vtkSMPropertyHelper helper(vprop);
-
-      for (unsigned int i = 0; i < this->GetNumberOfStrings(); i++)
+      vtkSMStringVectorProperty* svp = vtkSMStringVectorProperty::SafeDownCast(vprop);
+      if (svp && svp->GetNumberOfElementsPerCommand() == 2 && svp->GetRepeatCommand())
+      {
+        // Same result as calling vtkSMPropertyHelper::SetStatus() for each
+        // string, but in a single pass: that would scan all the elements and
+        // copy them for each array, which is quadratic in the number of arrays.
+        std::unordered_set<std::string> pending;
+        pending.reserve(this->GetNumberOfStrings());
+        for (unsigned int i = 0; i < this->GetNumberOfStrings(); i++)
+        {
+          pending.insert(this->GetString(i));
+        }
+        std::vector<std::string> elements = svp->GetElements();
+        for (size_t cc = 0; (cc + 1) < elements.size(); cc += 2)
+        {
+          if (pending.erase(elements[cc]) > 0)
+          {
+            elements[cc + 1] = "1";
+          }
+        }
+        for (unsigned int i = 0; i < this->GetNumberOfStrings(); i++)
+        {
+          if (pending.erase(this->GetString(i)) > 0)
+          {
+            elements.emplace_back(this->GetString(i));
+            elements.emplace_back("1");
+          }
+        }
+        svp->SetElements(elements);
+      }
+      else
       {
-        vtkPVXMLElement* omitFromLoadAllVariablesHint =
-          (prop->GetHints() ? prop->GetHints()->FindNestedElementByName("OmitFromLoadAllVariables")
-                            : nullptr);
-        if (!omitFromLoadAllVariablesHint)
+        vtkSMPropertyHelper helper(vprop);
+        for (unsigned int i = 0; i < this->GetNumberOfStrings(); i++)
         {
           helper.SetStatus(this->GetString(i), 1);
         }
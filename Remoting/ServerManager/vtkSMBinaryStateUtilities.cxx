@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSMBinaryStateUtilities.h"
+
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+#include "vtkSMCoreUtilities.h"
+
+#include <vtksys/FStream.hxx>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// Header of a binary state: signature, byte order mark and format version.
+constexpr char BinaryStateMagic[8] = { 'P', 'V', 'S', 'M', 'B', 'I', 'N', '\0' };
+constexpr vtkTypeUInt32 BinaryStateByteOrderMark = 0x01020304;
+constexpr vtkTypeUInt32 BinaryStateFormatVersion = 1;
+constexpr size_t BinaryStateHeaderSize = sizeof(BinaryStateMagic) + 2 * sizeof(vtkTypeUInt32);
+
+bool ReadFile(const char* filename, std::string& buffer)
+{
+  vtksys::ifstream file(filename, std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file)
+  {
+    return false;
+  }
+  buffer.assign(static_cast<size_t>(file.tellg()), '\0');
+  file.seekg(0);
+  return buffer.empty() || static_cast<bool>(file.read(&buffer[0], buffer.size()));
+}
+}
+
+vtkStandardNewMacro(vtkSMBinaryStateUtilities);
+//----------------------------------------------------------------------------
+vtkSMBinaryStateUtilities::vtkSMBinaryStateUtilities() = default;
+
+//----------------------------------------------------------------------------
+vtkSMBinaryStateUtilities::~vtkSMBinaryStateUtilities() = default;
+
+//----------------------------------------------------------------------------
+bool vtkSMBinaryStateUtilities::IsBinaryState(const char* filename)
+{
+  if (!filename)
+  {
+    return false;
+  }
+  vtksys::ifstream file(filename, std::ios::in | std::ios::binary);
+  char magic[sizeof(BinaryStateMagic)];
+  return file && file.read(magic, sizeof(magic)) &&
+    memcmp(magic, BinaryStateMagic, sizeof(magic)) == 0;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMBinaryStateUtilities::Write(vtkPVXMLElement* root, const char* filename)
+{
+  if (!root || !filename)
+  {
+    vtkGenericWarningMacro("Invalid arguments.");
+    return false;
+  }
+
+  std::string buffer(BinaryStateMagic, sizeof(BinaryStateMagic));
+  buffer.append(
+    reinterpret_cast<const char*>(&BinaryStateByteOrderMark), sizeof(BinaryStateByteOrderMark));
+  buffer.append(
+    reinterpret_cast<const char*>(&BinaryStateFormatVersion), sizeof(BinaryStateFormatVersion));
+  root->SerializeBinary(buffer);
+
+  if (!vtkSMCoreUtilities::WriteFileAtomically(filename, buffer))
+  {
+    vtkGenericWarningMacro("Failed to write binary state '" << filename << "'.");
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkPVXMLElement> vtkSMBinaryStateUtilities::Read(const char* filename)
+{
+  std::string buffer;
+  if (!filename || !::ReadFile(filename, buffer))
+  {
+    vtkGenericWarningMacro("Failed to read binary state '" << (filename ? filename : "") << "'.");
+    return nullptr;
+  }
+
+  const char* data = buffer.c_str();
+  const char* end = data + buffer.size();
+  if (buffer.size() < BinaryStateHeaderSize ||
+    memcmp(data, BinaryStateMagic, sizeof(BinaryStateMagic)) != 0)
+  {
+    vtkGenericWarningMacro("'" << filename << "' is not a binary state.");
+    return nullptr;
+  }
+  data += sizeof(BinaryStateMagic);
+
+  vtkTypeUInt32 byteOrderMark, version;
+  memcpy(&byteOrderMark, data, sizeof(byteOrderMark));
+  data += sizeof(byteOrderMark);
+  memcpy(&version, data, sizeof(version));
+  data += sizeof(version);
+  if (byteOrderMark != BinaryStateByteOrderMark)
+  {
+    vtkGenericWarningMacro("Binary state '" << filename
+                                            << "' was written on a machine with a different "
+                                               "byte order. Convert it to XML there.");
+    return nullptr;
+  }
+  if (version != BinaryStateFormatVersion)
+  {
+    vtkGenericWarningMacro(
+      "Binary state '" << filename << "' uses unsupported format version " << version << ".");
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkPVXMLElement> root;
+  root.TakeReference(vtkPVXMLElement::NewFromBinary(data, end));
+  if (!root || data != end)
+  {
+    vtkGenericWarningMacro("Binary state '" << filename << "' is corrupted.");
+    return nullptr;
+  }
+  return root;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMBinaryStateUtilities::ConvertToXML(const char* binaryFileName, const char* xmlFileName)
+{
+  auto root = vtkSMBinaryStateUtilities::Read(binaryFileName);
+  if (!root || !xmlFileName)
+  {
+    return false;
+  }
+  std::ostringstream xmlStream;
+  root->PrintXML(xmlStream, vtkIndent());
+  if (!vtkSMCoreUtilities::WriteFileAtomically(xmlFileName, xmlStream.str()))
+  {
+    vtkGenericWarningMacro("Failed to write XML state '" << xmlFileName << "'.");
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMBinaryStateUtilities::ConvertToBinary(const char* xmlFileName, const char* binaryFileName)
+{
+  std::string contents;
+  if (!xmlFileName || !::ReadFile(xmlFileName, contents))
+  {
+    vtkGenericWarningMacro(
+      "Failed to read XML state '" << (xmlFileName ? xmlFileName : "") << "'.");
+    return false;
+  }
+  vtkNew<vtkPVXMLParser> parser;
+  if (!parser->Parse(contents.c_str()))
+  {
+    vtkGenericWarningMacro("Failed to parse XML state '" << xmlFileName << "'.");
+    return false;
+  }
+  return vtkSMBinaryStateUtilities::Write(parser->GetRootElement(), binaryFileName);
+}
+
+//----------------------------------------------------------------------------
+void vtkSMBinaryStateUtilities::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSMBinaryStateUtilities
+ * @brief   read and write server manager state in a compact binary form.
+ *
+ * vtkSMBinaryStateUtilities saves the XML state tree of the server manager,
+ * as produced by vtkSMSessionProxyManager::SaveXMLState(), in a binary file
+ * (conventionally with the `.pvsmb` extension). The file holds the same
+ * elements, attributes and character data as the `.pvsm` XML, so converting
+ * between the two forms is lossless. Writing and reading it avoids formatting,
+ * escaping and parsing the XML text, which dominate the time spent saving and
+ * loading states with large property arrays.
+ *
+ * The file uses the native byte order; files written on a machine with a
+ * different byte order are rejected. Use `ConvertToXML` to exchange a state
+ * with such a machine or to diff states.
+ *
+ * @sa vtkSMSessionProxyManager::SaveBinaryState,
+ * vtkSMSessionProxyManager::LoadBinaryState
+ */
+
+#ifndef vtkSMBinaryStateUtilities_h
+#define vtkSMBinaryStateUtilities_h
+
+#include "vtkObject.h"
+#include "vtkRemotingServerManagerModule.h" //needed for exports
+#include "vtkSmartPointer.h"                // needed for vtkSmartPointer
+
+class vtkPVXMLElement;
+
+class VTKREMOTINGSERVERMANAGER_EXPORT vtkSMBinaryStateUtilities : public vtkObject
+{
+public:
+  static vtkSMBinaryStateUtilities* New();
+  vtkTypeMacro(vtkSMBinaryStateUtilities, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns true if the file starts with the signature of a binary state.
+   */
+  static bool IsBinaryState(const char* filename);
+
+  /**
+   * Writes the state tree rooted at `root` to `filename`. The file is
+   * written next to its destination first and renamed once complete, so that
+   * an interrupted save never leaves a truncated state behind.
+   * Returns true on success.
+   */
+  static bool Write(vtkPVXMLElement* root, const char* filename);
+
+  /**
+   * Reads a state tree written by `Write`. Returns nullptr if the file cannot
+   * be read or is not a valid binary state.
+   */
+  static vtkSmartPointer<vtkPVXMLElement> Read(const char* filename);
+
+  ///@{
+  /**
+   * Converts a binary state to a `.pvsm` XML state and back.
+   * Returns true on success.
+   */
+  static bool ConvertToXML(const char* binaryFileName, const char* xmlFileName);
+  static bool ConvertToBinary(const char* xmlFileName, const char* binaryFileName);
+  ///@}
+
+protected:
+  vtkSMBinaryStateUtilities();
+  ~vtkSMBinaryStateUtilities() override;
+
+private:
+  vtkSMBinaryStateUtilities(const vtkSMBinaryStateUtilities&) = delete;
+  void operator=(const vtkSMBinaryStateUtilities&) = delete;
+};
+
+#endif
@@ -23,6 +23,7 @@
 #include "vtkSMSourceProxy.h"
 #include "vtkSMStringVectorProperty.h"
 #include "vtkSmartPointer.h"
+#include <vtksys/FStream.hxx>
 #include <vtksys/SystemTools.hxx>
 
 #include <cassert>
@@ -30,6 +31,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
+#include <random>
 #include <set>
 #include <sstream>
 #include <string>
@@ -665,3 +667,28 @@ const char* vtkSMCoreUtilities::GetStringForCellType(int cellType)
   }
   return "Unknown";
 }
+
+//----------------------------------------------------------------------------
+bool vtkSMCoreUtilities::WriteFileAtomically(
+  const std::string& filename, const std::string& contents)
+{
+  std::ostringstream tmpName;
+  tmpName << filename << "." << std::hex << std::random_device()() << ".tmp";
+  {
+    vtksys::ofstream file(
+      tmpName.str().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(contents.c_str(), contents.size()))
+    {
+      file.close();
+      vtksys::SystemTools::RemoveFile(tmpName.str());
+      return false;
+    }
+  }
+  // RenameFile replaces an existing file, on Windows too.
+  if (!vtksys::SystemTools::RenameFile(tmpName.str(), filename))
+  {
+    vtksys::SystemTools::RemoveFile(tmpName.str());
+    return false;
+  }
+  return true;
+}
@@ -132,6 +132,13 @@ public:
    */
   static std::string FindLargestPrefix(const std::vector<std::string>& files);
 
+  /**
+   * Writes `contents` to `filename` under a temporary name first, then renames
+   * it, so that readers never see a partially written file. Returns false on
+   * failure, in which case `filename` is left untouched.
+   */
+  static bool WriteFileAtomically(const std::string& filename, const std::string& contents);
+
 protected:
   vtkSMCoreUtilities();
   ~vtkSMCoreUtilities() override;
@@ -2,7 +2,14 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkSMDataExtractWriterProxy.h"
 
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerInterpreterInitializer.h"
+#include "vtkClientServerStream.h"
+#include "vtkDataObject.h"
 #include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
 #include "vtkSMDomain.h"
 #include "vtkSMExtractsController.h"
 #include "vtkSMOutputPort.h"
@@ -35,10 +42,18 @@ bool vtkSMDataExtractWriterProxy::Write(vtkSMExtractsController* extractor)
     return false;
   }
 
+  // the writer may still be writing a previous extract in the background.
+  extractor->WaitForPendingExtracts(this);
+
   auto convertedName =
     this->GenerateExtractsFileName(fname, extractor->GetRealExtractsOutputDirectory());
   vtkSMPropertyHelper(writer, "FileName").Set(convertedName.c_str());
   writer->UpdateVTKObjects();
+  if (extractor->CanExtractAsynchronously() &&
+    this->WriteAsynchronously(extractor, writer, convertedName))
+  {
+    return true;
+  }
   writer->UpdatePipeline(extractor->GetTime());
 
   // On success, add to summary.
@@ -46,6 +61,76 @@ bool vtkSMDataExtractWriterProxy::Write(vtkSMExtractsController* extractor)
   return true;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMDataExtractWriterProxy::WriteAsynchronously(
+  vtkSMExtractsController* extractor, vtkSMWriterProxy* writer, const std::string& filename)
+{
+  auto algorithm = vtkAlgorithm::SafeDownCast(writer->GetClientSideObject());
+  if (!algorithm || algorithm->GetNumberOfInputPorts() != 1 ||
+    algorithm->GetNumberOfInputConnections(0) != 1)
+  {
+    return false;
+  }
+
+  // Update the input, including any array selection the writer proxy added
+  // in front of the writer, for the requested time.
+  vtkSmartPointer<vtkAlgorithmOutput> connection = algorithm->GetInputConnection(0, 0);
+  auto producer = connection->GetProducer();
+  if (!producer->UpdateTimeStep(extractor->GetTime()))
+  {
+    return false;
+  }
+
+  auto data = producer->GetOutputDataObject(connection->GetIndex());
+  if (!data)
+  {
+    return false;
+  }
+
+  auto snapshot = vtkSmartPointer<vtkDataObject>::Take(data->NewInstance());
+  snapshot->DeepCopy(data);
+
+  // The global interpreter keeps being used on this thread while the extract
+  // is written.
+  auto globalInterpreter = vtkClientServerInterpreterInitializer::GetGlobalInterpreter();
+  const bool usesInterpreter =
+    algorithm->IsA("vtkParallelSerialWriter") || algorithm->IsA("vtkFileSeriesWriter");
+  if (usesInterpreter)
+  {
+    if (!this->AsynchronousInterpreter)
+    {
+      this->AsynchronousInterpreter.TakeReference(
+        vtkClientServerInterpreterInitializer::GetInitializer()->NewInterpreter());
+    }
+    vtkClientServerStream stream;
+    stream << vtkClientServerStream::Invoke << algorithm << "SetInterpreter"
+           << this->AsynchronousInterpreter.GetPointer() << vtkClientServerStream::End;
+    globalInterpreter->ProcessStream(stream);
+  }
+
+  // Connections must only be changed on this thread: the writer is fed the
+  // snapshot until the extract has been written and then reconnected.
+  algorithm->SetInputDataObject(0, snapshot);
+  return extractor->EnqueueExtract(
+    this, filename,
+    [algorithm]() {
+      // same as what the writer's `Write` does.
+      algorithm->Modified();
+      algorithm->Update();
+      return true;
+    },
+    [algorithm, connection, usesInterpreter, globalInterpreter](bool) {
+      algorithm->SetInputConnection(0, connection);
+      if (usesInterpreter)
+      {
+        vtkClientServerStream stream;
+        stream << vtkClientServerStream::Invoke << algorithm << "SetInterpreter"
+               << globalInterpreter << vtkClientServerStream::End;
+        globalInterpreter->ProcessStream(stream);
+      }
+    });
+}
+
 //----------------------------------------------------------------------------
 bool vtkSMDataExtractWriterProxy::CanExtract(vtkSMProxy* proxy)
 {
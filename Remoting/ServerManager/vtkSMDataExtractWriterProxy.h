@@ -7,6 +7,15 @@
  * vtkSMDataExtractWriterProxy is an extract writer intended to write extracts
  * using ParaView writer proxies. The actual writer to use is defined a "Writer"
  * subproxy.
+ *
+ * When the vtkSMExtractsController can extract asynchronously, the writer's
+ * input is updated and deep copied on the calling thread and the writer then
+ * writes that snapshot on a worker thread. A deep copy is needed since
+ * simulation codes are free to reuse the memory they share with Catalyst as
+ * soon as the Catalyst execute call returns. Writers such as
+ * vtkParallelSerialWriter or vtkFileSeriesWriter, which invoke their internal
+ * writer through the client-server interpreter, are given a dedicated
+ * interpreter while writing in the background.
  */
 
 #ifndef vtkSMDataExtractWriterProxy_h
@@ -14,6 +23,11 @@
 
 #include "vtkSMExtractWriterProxy.h"
 
+#include "vtkSmartPointer.h" // for vtkSmartPointer
+
+class vtkClientServerInterpreter;
+class vtkSMWriterProxy;
+
 class VTKREMOTINGSERVERMANAGER_EXPORT vtkSMDataExtractWriterProxy : public vtkSMExtractWriterProxy
 {
 public:
@@ -36,9 +50,21 @@ protected:
   vtkSMDataExtractWriterProxy();
   ~vtkSMDataExtractWriterProxy() override;
 
+  /**
+   * Snapshots the writer's input and enqueues the write with the controller.
+   * Returns false if the writer cannot be used asynchronously, in which case
+   * nothing has been enqueued.
+   */
+  bool WriteAsynchronously(
+    vtkSMExtractsController* extractor, vtkSMWriterProxy* writer, const std::string& filename);
+
 private:
   vtkSMDataExtractWriterProxy(const vtkSMDataExtractWriterProxy&) = delete;
   void operator=(const vtkSMDataExtractWriterProxy&) = delete;
+
+  // Meta-writers invoke their internal writer through an interpreter. When
+  // writing asynchronously, they use this one instead of the global one.
+  vtkSmartPointer<vtkClientServerInterpreter> AsynchronousInterpreter;
 };
 
 #endif
@@ -16,9 +16,13 @@
 
 #include "vtkSMExtractTriggerProxy.h"
 
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
+#include "vtkProcessModule.h"
 #include "vtkSMExtractsController.h"
 #include "vtkSMPropertyHelper.h"
+#include "vtkSMSessionProxyManager.h"
 
 #if vtkSMExtractTriggerProxy_ENABLE_PYTHON
 namespace
@@ -76,6 +80,9 @@ vtkSMExtractTriggerProxy::vtkSMExtractTriggerProxy()
 {
   this->LastTimeValue = VTK_DOUBLE_MIN;
   this->LastOutputTimeValue = VTK_DOUBLE_MIN;
+  this->LastBudgetTimeStep = -1;
+  this->LastBudgetDecision = false;
+  this->NumberOfSkippedSteps = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -178,6 +185,10 @@ bool vtkSMExtractTriggerProxy::IsActivated(vtkSMExtractsController* controller)
     this->LastTimeValue = timevalue;
     return doIt;
   }
+  else if (triggerName == "Budget")
+  {
+    return this->IsBudgetActivated(controller);
+  }
   else if (triggerName == "Python")
   {
 #if vtkSMExtractTriggerProxy_ENABLE_PYTHON
@@ -194,10 +205,94 @@ bool vtkSMExtractTriggerProxy::IsActivated(vtkSMExtractsController* controller)
   return false;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMExtractTriggerProxy::IsBudgetActivated(vtkSMExtractsController* controller)
+{
+  const int timestep = controller->GetTimeStep();
+  if (timestep == this->LastBudgetTimeStep)
+  {
+    // this method is called multiple times per timestep (to decide whether to
+    // execute the pipeline and then to generate the extract); decide once.
+    return this->LastBudgetDecision;
+  }
+
+  const int frequency = vtkSMPropertyHelper(this, "Frequency").GetAsInt();
+  if (frequency > 1 && timestep % frequency != 0)
+  {
+    return false;
+  }
+
+  this->LastBudgetTimeStep = timestep;
+  this->LastBudgetDecision = true;
+  if (controller->GetNumberOfCycles() == 0)
+  {
+    // no cost accounted yet.
+    this->NumberOfSkippedSteps = 0;
+    return true;
+  }
+
+  // expected cost: that of the extractor this trigger controls or, for a
+  // global trigger, the average time spent in Catalyst per cycle.
+  std::string name = "global trigger";
+  double expected = controller->GetCatalystTime() / controller->GetNumberOfCycles();
+  if (auto extractor = controller->GetActiveExtractor())
+  {
+    auto pxm = extractor->GetSessionProxyManager();
+    const char* pname = pxm ? pxm->GetProxyName("extractors", extractor) : nullptr;
+    name = pname ? pname : "extractor";
+    auto costs = controller->GetExtractCosts(extractor);
+    expected = costs ? costs->GetAverageTime() : 0.0;
+  }
+
+  // the costs are measured on each rank. In symmetric mode, all ranks must
+  // agree on the decision since extract writers are collective: decide based on
+  // the largest costs and the shortest simulation time over all ranks.
+  double costs[3] = { controller->GetCatalystTime(), expected, -controller->GetSolverTime() };
+  auto pm = vtkProcessModule::GetProcessModule();
+  auto pmController = pm ? pm->GetGlobalController() : nullptr;
+  if (pm && pm->GetSymmetricMPIMode() && pmController &&
+    pmController->GetNumberOfProcesses() > 1)
+  {
+    double local[3] = { costs[0], costs[1], costs[2] };
+    pmController->AllReduce(local, costs, 3, vtkCommunicator::MAX_OP);
+  }
+  expected = costs[1];
+
+  const double maxOverhead = vtkSMPropertyHelper(this, "MaximumOverhead").GetAsDouble();
+  const double solverTime = -costs[2];
+  const double overhead =
+    solverTime > 0 ? 100.0 * (costs[0] + expected) / solverTime : VTK_DOUBLE_MAX;
+  if (overhead <= maxOverhead)
+  {
+    this->NumberOfSkippedSteps = 0;
+    return true;
+  }
+
+  const int maxSkipped = vtkSMPropertyHelper(this, "MaximumNumberOfSkippedSteps").GetAsInt();
+  if (maxSkipped > 0 && this->NumberOfSkippedSteps >= maxSkipped)
+  {
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+      "'%s' activated at timestep %d despite the budget: %d extracts skipped in a row.",
+      name.c_str(), timestep, this->NumberOfSkippedSteps);
+    this->NumberOfSkippedSteps = 0;
+    return true;
+  }
+
+  ++this->NumberOfSkippedSteps;
+  this->LastBudgetDecision = false;
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "'%s' skipped at timestep %d: an expected cost of %.3f s would bring the Catalyst "
+    "overhead to %.1f%% of the %.3f s spent in the simulation (limit is %.1f%%).",
+    name.c_str(), timestep, expected, overhead, solverTime, maxOverhead);
+  return false;
+}
+
 //----------------------------------------------------------------------------
 void vtkSMExtractTriggerProxy::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "LastTimeValue: " << this->LastTimeValue << endl;
   os << indent << "LastOutputTimeValue: " << this->LastOutputTimeValue << endl;
+  os << indent << "LastBudgetTimeStep: " << this->LastBudgetTimeStep << endl;
+  os << indent << "NumberOfSkippedSteps: " << this->NumberOfSkippedSteps << endl;
 }
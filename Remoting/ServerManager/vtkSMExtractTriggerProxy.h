@@ -8,6 +8,13 @@
  * an extractor. Currently, this class directly implements a time-based
  * trigger which relies on properties to indicate the start-time, end-time, and
  * update frequency. Subclasses can be added to define new types of triggers.
+ *
+ * The `Budget` trigger adapts the cadence to the cost of the extracts
+ * accounted by vtkSMExtractsController (see @ref ExtractCosts): every
+ * **Frequency** timesteps, it skips the extract if its expected cost would
+ * bring the time spent in Catalyst above **MaximumOverhead** percent of the
+ * time spent in the simulation, unless **MaximumNumberOfSkippedSteps**
+ * consecutive extracts have already been skipped.
  */
 
 #ifndef vtkSMExtractTriggerProxy_h
@@ -39,6 +46,11 @@ private:
   vtkSMExtractTriggerProxy(const vtkSMExtractTriggerProxy&) = delete;
   void operator=(const vtkSMExtractTriggerProxy&) = delete;
 
+  /**
+   * Implements the `Budget` trigger.
+   */
+  bool IsBudgetActivated(vtkSMExtractsController* controller);
+
   /**
    * Queue of time values that we keep for the TimeValue trigger to keep
    * track of the most recent time values to determine if we should
@@ -48,6 +60,14 @@ private:
   std::deque<double> TimeStepLengths;
   double LastTimeValue;
   double LastOutputTimeValue;
+
+  /**
+   * State of the Budget trigger: the decision made for the last timestep it
+   * was evaluated for, and the number of consecutive extracts skipped.
+   */
+  int LastBudgetTimeStep;
+  bool LastBudgetDecision;
+  int NumberOfSkippedSteps;
 };
 
 #endif
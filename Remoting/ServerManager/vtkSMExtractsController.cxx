@@ -8,7 +8,9 @@
 #include "vtkMultiProcessController.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkPVProxyDefinitionIterator.h"
+#include "vtkPVSession.h"
 #include "vtkPVStringFormatter.h"
 #include "vtkProcessModule.h"
 #include "vtkRemoteWriterHelper.h"
@@ -29,13 +31,20 @@
 #include "vtkSmartPointer.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
+#include "vtkThreadedCallbackQueue.h"
+#include "vtkTimerLog.h"
 
 // clang-format off
 #include "vtk_doubleconversion.h"
 #include VTK_DOUBLECONVERSION_HEADER(double-conversion.h)
 // clang-format on
 
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory>
 #include <sstream>
+#include <vtksys/SystemInformation.hxx>
 #include <vtksys/SystemTools.hxx>
 
 namespace
@@ -81,6 +90,30 @@ std::string DefaultFilename(vtkSMProxy* input, std::string pattern)
 }
 }
 
+class vtkSMExtractsController::vtkInternals
+{
+public:
+  struct PendingExtract
+  {
+    vtkSmartPointer<vtkSMExtractWriterProxy> Writer;
+    std::string FileName;
+    SummaryParametersT Params;
+    ExtractCompletedT Completed;
+    // written by the worker thread, only read once `Future` has been waited on.
+    std::shared_ptr<bool> Status;
+    vtkThreadedCallbackQueue::SharedFutureBasePointer Future;
+    double EnqueueTime;
+  };
+
+  std::deque<PendingExtract> PendingExtracts;
+
+  std::map<vtkSMProxy*, ExtractCosts> Costs;
+  vtksys::SystemInformation SystemInformation;
+  bool InCycle = false;
+  double CycleStart = 0.0;
+  double LastCycleEnd = -1.0;
+};
+
 vtkStandardNewMacro(vtkSMExtractsController);
 //----------------------------------------------------------------------------
 vtkSMExtractsController::vtkSMExtractsController()
@@ -90,6 +123,13 @@ vtkSMExtractsController::vtkSMExtractsController()
   , EnvironmentExtractsOutputDirectory(nullptr)
   , SummaryTable(nullptr)
   , ExtractsOutputDirectoryValid(false)
+  , Asynchronous(false)
+  , MaximumNumberOfPendingExtracts(4)
+  , CatalystTime(0.0)
+  , SolverTime(0.0)
+  , NumberOfCycles(0)
+  , ActiveExtractor(nullptr)
+  , Internals(new vtkSMExtractsController::vtkInternals())
 {
   if (vtksys::SystemTools::HasEnv("PARAVIEW_OVERRIDE_EXTRACTS_OUTPUT_DIRECTORY"))
   {
@@ -101,6 +141,7 @@ vtkSMExtractsController::vtkSMExtractsController()
 //----------------------------------------------------------------------------
 vtkSMExtractsController::~vtkSMExtractsController()
 {
+  this->Flush();
   this->SetExtractsOutputDirectory(nullptr);
   this->SetEnvironmentExtractsOutputDirectory(nullptr);
 }
@@ -172,8 +213,24 @@ bool vtkSMExtractsController::Extract(vtkSMProxy* extractor)
     PV_STRING_FORMATTER_NAMED_SCOPE(
       "EXTRACT", fmt::arg("timestep", this->GetTimeStep()), fmt::arg("time", this->GetTime()));
 
+    const std::string name = this->GetName(writer);
+    vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "extract '%s' (timestep=%d, time=%g)",
+      name.c_str(), this->GetTimeStep(), this->GetTime());
+    auto& internals = (*this->Internals);
+    const double start = vtkTimerLog::GetUniversalTime();
+    const auto memory = internals.SystemInformation.GetProcMemoryUsed();
     bool extractResult = writer->Write(this);
 
+    auto& costs = internals.Costs[extractor];
+    ++costs.NumberOfExtracts;
+    costs.LastTime = vtkTimerLog::GetUniversalTime() - start;
+    costs.TotalTime += costs.LastTime;
+    costs.LastMemory =
+      static_cast<vtkTypeInt64>(internals.SystemInformation.GetProcMemoryUsed() - memory);
+    costs.MaximumMemory = std::max(costs.MaximumMemory, costs.LastMemory);
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "extract '%s': %.3f s, %lld KiB", name.c_str(),
+      costs.LastTime, static_cast<long long>(costs.LastMemory));
+
     if (!extractResult)
     {
       vtkErrorMacro("Write failed! Extracts may not be generated correctly!");
@@ -185,6 +242,188 @@ bool vtkSMExtractsController::Extract(vtkSMProxy* extractor)
   return false;
 }
 
+//----------------------------------------------------------------------------
+bool vtkSMExtractsController::CanExtractAsynchronously() const
+{
+  if (!this->Asynchronous)
+  {
+    return false;
+  }
+
+  // Writers for parallel runs communicate between ranks while writing and
+  // cannot do so from worker threads. In client-server mode, the data is not
+  // available on this process to be snapshotted. Only support the builtin,
+  // single process case.
+  auto pm = vtkProcessModule::GetProcessModule();
+  auto session = pm ? vtkPVSession::SafeDownCast(pm->GetSession()) : nullptr;
+  return session != nullptr &&
+    (session->GetProcessRoles() & vtkPVSession::CLIENT_AND_SERVERS) ==
+    vtkPVSession::CLIENT_AND_SERVERS &&
+    pm->GetNumberOfLocalPartitions() == 1;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMExtractsController::EnqueueExtract(vtkSMExtractWriterProxy* writer,
+  const std::string& filename, ExtractTaskT task, ExtractCompletedT completed,
+  const SummaryParametersT& params)
+{
+  if (!writer || !task)
+  {
+    return false;
+  }
+
+  // Apply backpressure: failures of older extracts are reported as they
+  // complete and do not prevent this one from being enqueued.
+  auto& internals = (*this->Internals);
+  while (static_cast<int>(internals.PendingExtracts.size()) >=
+    this->MaximumNumberOfPendingExtracts)
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "waiting on pending extracts (%d queued)",
+      static_cast<int>(internals.PendingExtracts.size()));
+    this->CompleteOldestPendingExtract();
+  }
+
+  vtkInternals::PendingExtract pending;
+  pending.Writer = writer;
+  pending.FileName = filename;
+  pending.Params = params;
+  pending.Completed = std::move(completed);
+  pending.Status = std::make_shared<bool>(false);
+  pending.EnqueueTime = vtkTimerLog::GetUniversalTime();
+
+  auto result = pending.Status;
+  auto queue = vtkProcessModule::GetProcessModule()->GetCallbackQueue();
+  pending.Future = queue->Push([task, result, filename]() {
+    vtkVLogScopeF(
+      PARAVIEW_LOG_CATALYST_VERBOSITY(), "write extract '%s' in background", filename.c_str());
+    *result = task();
+  });
+  internals.PendingExtracts.push_back(std::move(pending));
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMExtractsController::CompleteOldestPendingExtract()
+{
+  auto& internals = (*this->Internals);
+  if (internals.PendingExtracts.empty())
+  {
+    return true;
+  }
+
+  auto pending = std::move(internals.PendingExtracts.front());
+  internals.PendingExtracts.pop_front();
+
+  pending.Future->Wait();
+  const bool status = *pending.Status;
+  vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "extract '%s' %s %.3f s after being enqueued",
+    pending.FileName.c_str(), status ? "written" : "failed",
+    vtkTimerLog::GetUniversalTime() - pending.EnqueueTime);
+  if (pending.Completed)
+  {
+    pending.Completed(status);
+  }
+
+  if (!status)
+  {
+    vtkErrorMacro("Failed to write '" << pending.FileName.c_str()
+                                      << "'! Extracts may not be generated correctly!");
+    return false;
+  }
+
+  this->AddSummaryEntry(pending.Writer, pending.FileName, pending.Params);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMExtractsController::WaitForPendingExtracts(vtkSMExtractWriterProxy* writer)
+{
+  // extracts are completed in order so that summary table entries keep
+  // the same order as when writing synchronously.
+  auto& internals = (*this->Internals);
+  auto last = std::find_if(internals.PendingExtracts.rbegin(), internals.PendingExtracts.rend(),
+    [writer](const vtkInternals::PendingExtract& pending) { return pending.Writer == writer; });
+  bool status = true;
+  for (auto count = std::distance(last, internals.PendingExtracts.rend()); count > 0; --count)
+  {
+    status = this->CompleteOldestPendingExtract() && status;
+  }
+  return status;
+}
+
+//----------------------------------------------------------------------------
+bool vtkSMExtractsController::Flush()
+{
+  auto& internals = (*this->Internals);
+  if (internals.PendingExtracts.empty())
+  {
+    return true;
+  }
+
+  vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(), "flush %d pending extracts",
+    static_cast<int>(internals.PendingExtracts.size()));
+  bool status = true;
+  while (!internals.PendingExtracts.empty())
+  {
+    status = this->CompleteOldestPendingExtract() && status;
+  }
+  return status;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMExtractsController::BeginCycle()
+{
+  auto& internals = (*this->Internals);
+  const double now = vtkTimerLog::GetUniversalTime();
+  if (internals.LastCycleEnd >= 0)
+  {
+    this->SolverTime += now - internals.LastCycleEnd;
+  }
+  internals.CycleStart = now;
+  internals.InCycle = true;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMExtractsController::EndCycle()
+{
+  auto& internals = (*this->Internals);
+  if (!internals.InCycle)
+  {
+    return;
+  }
+  internals.LastCycleEnd = vtkTimerLog::GetUniversalTime();
+  internals.InCycle = false;
+  this->CatalystTime += internals.LastCycleEnd - internals.CycleStart;
+  ++this->NumberOfCycles;
+}
+
+//----------------------------------------------------------------------------
+const vtkSMExtractsController::ExtractCosts* vtkSMExtractsController::GetExtractCosts(
+  vtkSMProxy* extractor) const
+{
+  const auto& costs = this->Internals->Costs;
+  auto iter = costs.find(extractor);
+  return iter != costs.end() ? &iter->second : nullptr;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMExtractsController::LogExtractCosts() const
+{
+  vtkVLogScopeF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+    "extract costs: %d cycles, %.3f s in Catalyst, %.3f s in the simulation", this->NumberOfCycles,
+    this->CatalystTime, this->SolverTime);
+  for (const auto& item : this->Internals->Costs)
+  {
+    auto pxm = item.first->GetSessionProxyManager();
+    const char* name = pxm ? pxm->GetProxyName("extractors", item.first) : nullptr;
+    const auto& costs = item.second;
+    vtkVLogF(PARAVIEW_LOG_CATALYST_VERBOSITY(),
+      "'%s': %d extracts, %.3f s in total (%.3f s on average), up to %lld KiB",
+      name ? name : "(unnamed)", costs.NumberOfExtracts, costs.TotalTime, costs.GetAverageTime(),
+      static_cast<long long>(costs.MaximumMemory));
+  }
+}
+
 //----------------------------------------------------------------------------
 bool vtkSMExtractsController::IsAnyTriggerActivated(vtkSMSessionProxyManager* pxm)
 {
@@ -246,13 +485,10 @@ bool vtkSMExtractsController::IsTriggerActivated(vtkSMProxy* extractor)
   auto trigger =
     vtkSMExtractTriggerProxy::SafeDownCast(vtkSMPropertyHelper(extractor, "Trigger").GetAsProxy(0));
   // note, if no trigger is provided, we assume it is always enabled.
-  if (trigger != nullptr && !trigger->IsActivated(this))
-  {
-    // skipping, nothing to do.
-    return false;
-  }
-
-  return true;
+  this->ActiveExtractor = extractor;
+  const bool activated = trigger == nullptr || trigger->IsActivated(this);
+  this->ActiveExtractor = nullptr;
+  return activated;
 }
 
 //----------------------------------------------------------------------------
@@ -689,4 +925,10 @@ void vtkSMExtractsController::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Time: " << this->Time << endl;
   os << indent << "ExtractsOutputDirectory: "
      << (this->ExtractsOutputDirectory ? this->ExtractsOutputDirectory : "(nullptr)") << endl;
+  os << indent << "Asynchronous: " << this->Asynchronous << endl;
+  os << indent << "MaximumNumberOfPendingExtracts: " << this->MaximumNumberOfPendingExtracts
+     << endl;
+  os << indent << "CatalystTime: " << this->CatalystTime << endl;
+  os << indent << "SolverTime: " << this->SolverTime << endl;
+  os << indent << "NumberOfCycles: " << this->NumberOfCycles << endl;
 }
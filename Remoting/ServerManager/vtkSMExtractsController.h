@@ -23,6 +23,31 @@
  * Currently, this summary table is used to generated a Cinema specification
  * which can be used to explore the generated extracts using Cinema tools
  * (https://cinemascience.github.io/).
+ *
+ * @section AsynchronousExtracts Asynchronous extracts
+ *
+ * When `Asynchronous` is enabled, extract writers that support it only
+ * snapshot the data to write (or capture the image to save) in `Extract` and
+ * hand the actual file writing over to the process module's callback queue
+ * (see `vtkProcessModule::GetCallbackQueue`). The number of extracts pending
+ * at any time is bounded by `MaximumNumberOfPendingExtracts`: when the limit is
+ * reached, `Extract` blocks until the oldest pending extract has been written.
+ * `Flush` waits for all pending extracts and is called on destruction. Summary
+ * table entries for asynchronous extracts are added once they are written.
+ *
+ * Asynchronous extracts are only supported in single process builtin
+ * sessions, since parallel writers communicate between ranks while writing.
+ * Otherwise, extracts are written synchronously.
+ *
+ * @section ExtractCosts Cost accounting
+ *
+ * vtkSMExtractsController records the wall-clock time and the change in
+ * resident memory of every extract it generates (see `GetExtractCosts`). When
+ * the caller delimits the processing of each simulation cycle with
+ * `BeginCycle` and `EndCycle`, it also accounts for the time spent in Catalyst
+ * and in the simulation. Triggers use these to adapt the extracts cadence,
+ * e.g. the `Budget` trigger skips extracts that would bring the Catalyst
+ * overhead above a percentage of the simulation time.
  */
 
 #ifndef vtkSMExtractsController_h
@@ -32,9 +57,11 @@
 #include "vtkRemotingServerManagerModule.h" // for exports
 #include "vtkSmartPointer.h"                // for vtkSmartPointer
 
-#include <map>    // for std::map
-#include <string> // for std::string
-#include <vector> // for std::vector
+#include <functional> // for std::function
+#include <map>        // for std::map
+#include <memory>     // for std::unique_ptr
+#include <string>     // for std::string
+#include <vector>     // for std::vector
 
 class vtkCollection;
 class vtkSMExtractWriterProxy;
@@ -211,6 +238,123 @@ public:
     const SummaryParametersT& params = SummaryParametersT{});
   ///@}
 
+  ///@{
+  /**
+   * Enable/disable asynchronous extracts. See @ref AsynchronousExtracts.
+   * Default is false.
+   */
+  vtkSetMacro(Asynchronous, bool);
+  vtkGetMacro(Asynchronous, bool);
+  vtkBooleanMacro(Asynchronous, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Maximum number of asynchronous extracts that may be pending at any time.
+   * Once reached, enqueuing another extract waits for the oldest one to
+   * complete. Default is 4.
+   */
+  vtkSetClampMacro(MaximumNumberOfPendingExtracts, int, 1, VTK_INT_MAX);
+  vtkGetMacro(MaximumNumberOfPendingExtracts, int);
+  ///@}
+
+  /**
+   * Returns true if `Asynchronous` is enabled and the current session supports
+   * it. Extract writers use this to decide whether to call `EnqueueExtract`.
+   */
+  bool CanExtractAsynchronously() const;
+
+  /**
+   * Wait for all pending asynchronous extracts to be written. Returns false
+   * if any of them failed.
+   */
+  bool Flush();
+
+  ///@{
+  /**
+   * Called by vtkSMExtractWriterProxy subclasses to write an extract
+   * asynchronously. `task` is executed on a worker thread and must only touch
+   * objects that are not modified until it has completed, e.g. a snapshot of
+   * the data to write. `completed` is then called on the thread that calls
+   * `Extract` or `Flush`, with the status returned by `task`, to release or
+   * restore whatever `task` was using. On success, `filename` is added to the
+   * summary table as with `AddSummaryEntry`. Returns false if nothing was
+   * enqueued.
+   */
+  using ExtractTaskT = std::function<bool()>;
+  using ExtractCompletedT = std::function<void(bool)>;
+  bool EnqueueExtract(vtkSMExtractWriterProxy* writer, const std::string& filename,
+    ExtractTaskT task, ExtractCompletedT completed = nullptr,
+    const SummaryParametersT& params = SummaryParametersT{});
+  ///@}
+
+  /**
+   * Wait for pending asynchronous extracts enqueued by `writer`. Extract
+   * writers that reuse the same VTK objects for every extract must call this
+   * before updating them.
+   */
+  bool WaitForPendingExtracts(vtkSMExtractWriterProxy* writer);
+
+  ///@{
+  /**
+   * Mark the beginning and the end of the Catalyst processing of a simulation
+   * cycle. See @ref ExtractCosts.
+   */
+  void BeginCycle();
+  void EndCycle();
+  ///@}
+
+  ///@{
+  /**
+   * Wall-clock time, in seconds, spent so far between `BeginCycle` and
+   * `EndCycle` (Catalyst) and between `EndCycle` and the next `BeginCycle`
+   * (simulation), and number of cycles completed.
+   */
+  vtkGetMacro(CatalystTime, double);
+  vtkGetMacro(SolverTime, double);
+  vtkGetMacro(NumberOfCycles, int);
+  ///@}
+
+  /**
+   * Cost of the extracts generated by an extractor: number of extracts,
+   * wall-clock time in seconds of the last one and of all of them, and change
+   * in the resident memory of the process, in KiB, for the last one and the
+   * largest such change. For asynchronous extracts, only the part done in
+   * `Extract` is accounted for.
+   */
+  struct ExtractCosts
+  {
+    int NumberOfExtracts = 0;
+    double LastTime = 0.0;
+    double TotalTime = 0.0;
+    vtkTypeInt64 LastMemory = 0;
+    vtkTypeInt64 MaximumMemory = 0;
+
+    double GetAverageTime() const
+    {
+      return this->NumberOfExtracts > 0 ? this->TotalTime / this->NumberOfExtracts : 0.0;
+    }
+  };
+
+  /**
+   * Returns the costs of the extracts generated by `extractor` so far or
+   * nullptr if it has not generated any.
+   */
+  const ExtractCosts* GetExtractCosts(vtkSMProxy* extractor) const;
+
+  /**
+   * Logs the costs of the extracts generated so far, as well as the Catalyst
+   * and simulation times.
+   */
+  void LogExtractCosts() const;
+
+  /**
+   * Returns the extractor whose trigger is being evaluated by
+   * `IsTriggerActivated`, if any. Triggers use it to look up the cost of the
+   * extractor they control.
+   */
+  vtkSMProxy* GetActiveExtractor() const { return this->ActiveExtractor; }
+
   /**
    * Returns true of the extractor is enabled.
    */
@@ -253,6 +397,12 @@ private:
    */
   static std::string GetSummaryTableFilenameColumnName(const std::string& fname);
 
+  /**
+   * Waits for the oldest pending extract, calls its completion callback and
+   * updates the summary table. Returns the status of the extract.
+   */
+  bool CompleteOldestPendingExtract();
+
   int TimeStep;
   double Time;
   char* ExtractsOutputDirectory;
@@ -260,6 +410,15 @@ private:
   vtkSmartPointer<vtkTable> SummaryTable;
   mutable std::string LastExtractsOutputDirectory;
   mutable bool ExtractsOutputDirectoryValid;
+  bool Asynchronous;
+  int MaximumNumberOfPendingExtracts;
+  double CatalystTime;
+  double SolverTime;
+  int NumberOfCycles;
+  vtkSMProxy* ActiveExtractor;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 
   vtkSetStringMacro(EnvironmentExtractsOutputDirectory);
 };
@@ -9,6 +9,7 @@
 #include "vtkPVSession.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
+#include "vtkSMBinaryStateUtilities.h"
 #include "vtkSMCoreUtilities.h"
 #include "vtkSMFileListDomain.h"
 #include "vtkSMProperty.h"
@@ -27,6 +28,7 @@
 #include <vtksys/SystemTools.hxx>
 
 #include <algorithm>
+#include <cctype>
 #include <set>
 #include <sstream>
 
@@ -441,6 +443,31 @@ void ReplaceEnvironmentVariables(std::string& contents)
     vtksys::SystemTools::ReplaceString(contents, pair.first, pair.second);
   }
 }
+
+// Copies `element` as a child of `parent`, replacing environment variables in
+// its attributes and character data like ReplaceEnvironmentVariables does for
+// XML text.
+void CopyToPugiXML(vtkPVXMLElement* element, pugi::xml_node& parent)
+{
+  auto node = parent.append_child(element->GetName());
+  for (unsigned int cc = 0, max = element->GetNumberOfAttributes(); cc < max; ++cc)
+  {
+    std::string value = element->GetAttributeValue(cc);
+    ::ReplaceEnvironmentVariables(value);
+    node.append_attribute(element->GetAttributeName(cc)).set_value(value.c_str());
+  }
+  std::string data = element->GetCharacterData();
+  const auto isSpace = [](unsigned char c) { return std::isspace(c) != 0; };
+  if (!std::all_of(data.begin(), data.end(), isSpace))
+  {
+    ::ReplaceEnvironmentVariables(data);
+    node.append_child(pugi::node_pcdata).set_value(data.c_str());
+  }
+  for (unsigned int cc = 0, max = element->GetNumberOfNestedElements(); cc < max; ++cc)
+  {
+    ::CopyToPugiXML(element->GetNestedElement(cc), node);
+  }
+}
 }
 
 //----------------------------------------------------------------------------
@@ -489,6 +516,7 @@ bool vtkSMLoadStateOptionsProxy::PrepareToLoad(const char* statefilename, vtkTyp
     return false;
   }
   this->SetStateFileName(statefilename);
+  auto& internals = (*this->Internals);
   std::string contents;
   const auto fileNameExt = vtksys::SystemTools::GetFilenameLastExtension(statefilename);
   if (fileNameExt == ".png")
@@ -499,6 +527,22 @@ bool vtkSMLoadStateOptionsProxy::PrepareToLoad(const char* statefilename, vtkTyp
       return false;
     }
   }
+  else if (location == vtkPVSession::CLIENT &&
+    vtkSMBinaryStateUtilities::IsBinaryState(statefilename))
+  {
+    auto root = vtkSMBinaryStateUtilities::Read(statefilename);
+    if (!root)
+    {
+      vtkErrorMacro("Failed to load state file '" << statefilename << "'.");
+      return false;
+    }
+    // use the decoded tree as is rather than printing it as XML to parse it
+    // again.
+    internals.StateXML.reset();
+    ::CopyToPugiXML(root, internals.StateXML);
+    internals.Process(this);
+    return true;
+  }
   else
   {
     contents = pxm->LoadString(statefilename, location);
@@ -510,7 +554,6 @@ bool vtkSMLoadStateOptionsProxy::PrepareToLoad(const char* statefilename, vtkTyp
   }
   ::ReplaceEnvironmentVariables(contents);
 
-  auto& internals = (*this->Internals);
   auto result = internals.StateXML.load_string(contents.c_str());
   if (!result)
   {
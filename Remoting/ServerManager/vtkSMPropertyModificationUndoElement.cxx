@@ -8,6 +8,7 @@
 #include "vtkSMProperty.h"
 #include "vtkSMProxy.h"
 #include "vtkSMSession.h"
+#include "vtkSMUndoStateInternals.h"
 
 vtkStandardNewMacro(vtkSMPropertyModificationUndoElement);
 //-----------------------------------------------------------------------------
@@ -16,7 +17,7 @@ vtkSMPropertyModificationUndoElement::vtkSMPropertyModificationUndoElement()
   this->SetMergeable(true);
   this->PropertyName = nullptr;
   this->ProxyGlobalID = 0;
-  this->PropertyState = new vtkSMMessage();
+  this->PropertyState = new vtkSMUndoStateInternals();
 }
 
 //-----------------------------------------------------------------------------
@@ -54,7 +55,9 @@ int vtkSMPropertyModificationUndoElement::RevertToState()
   vtkSMProperty* property = (proxy ? proxy->GetProperty(this->PropertyName) : nullptr);
   if (property)
   {
-    property->ReadFrom(this->PropertyState, 0, nullptr); // 0 because only one
+    vtkSMMessage state;
+    this->PropertyState->Get(state);
+    property->ReadFrom(&state, 0, nullptr); // 0 because only one
     proxy->UpdateProperty(this->PropertyName);
   }
   return 1;
@@ -76,8 +79,9 @@ void vtkSMPropertyModificationUndoElement::ModifiedProperty(
   this->ProxyGlobalID = proxy->GetGlobalID();
   this->SetPropertyName(propertyname);
 
-  this->PropertyState->Clear();
-  property->WriteTo(this->PropertyState);
+  vtkSMMessage state;
+  property->WriteTo(&state);
+  this->PropertyState->Set(this->ProxyGlobalID, state);
 }
 
 //-----------------------------------------------------------------------------
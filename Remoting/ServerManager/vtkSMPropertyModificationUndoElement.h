@@ -8,6 +8,8 @@
  * The undo action sets the property to the value that was pushed on
  * to the server previous to the modification.
  * The redo action sets the property to the modified value.
+ * The value is kept serialized and shared with the other undo elements that
+ * hold the same value of the property.
  */
 
 #ifndef vtkSMPropertyModificationUndoElement_h
@@ -17,6 +19,7 @@
 #include "vtkSMMessageMinimal.h"            // needed for vtkSMMessage
 #include "vtkSMUndoElement.h"
 class vtkSMProxy;
+class vtkSMUndoStateInternals;
 
 class VTKREMOTINGSERVERMANAGER_EXPORT vtkSMPropertyModificationUndoElement : public vtkSMUndoElement
 {
@@ -60,9 +63,11 @@ protected:
 
   vtkTypeUInt32 ProxyGlobalID;
   char* PropertyName;
-  vtkSMMessage* PropertyState;
+  vtkSMUndoStateInternals* PropertyState;
 
 private:
+  friend class vtkSMUndoStack;
+
   vtkSMPropertyModificationUndoElement(const vtkSMPropertyModificationUndoElement&) = delete;
   void operator=(const vtkSMPropertyModificationUndoElement&) = delete;
 };
@@ -13,7 +13,6 @@
 #include "vtkObjectFactory.h"
 #include "vtkPVInformation.h"
 #include "vtkPVLogger.h"
-#include "vtkPVPluginLoader.h"
 #include "vtkPVXMLElement.h"
 #include "vtkProcessModule.h"
 #include "vtkSIProxy.h"
@@ -21,7 +20,6 @@
 #include "vtkSMDocumentation.h"
 #include "vtkSMInputProperty.h"
 #include "vtkSMMessage.h"
-#include "vtkSMPluginLoaderProxy.h"
 #include "vtkSMPropertyGroup.h"
 #include "vtkSMPropertyIterator.h"
 #include "vtkSMProxyListDomain.h"
@@ -899,18 +897,11 @@ bool vtkSMProxy::LoadPluginIfEnsured()
 {
   if (this->EnsurePluginLoaded)
   {
-    // Ensure local plugin is loaded
+    // Loads the plugin locally and remotely, only the first time one of its
+    // proxies is instantiated in this session.
     const char* pluginName = this->EnsurePluginLoaded->GetAttributeOrEmpty("name");
-    vtkNew<vtkPVPluginLoader> loader;
-    bool ret = loader->LoadPluginByName(pluginName, false);
-
-    // Ensure remote plugin is loaded
     vtkSMSessionProxyManager* pxm = this->GetSessionProxyManager();
-    auto proxy = vtkSmartPointer<vtkSMPluginLoaderProxy>::Take(
-      vtkSMPluginLoaderProxy::SafeDownCast(pxm->NewProxy("misc", "PluginLoader")));
-    proxy->UpdateVTKObjects();
-    ret &= proxy->LoadPluginByName(pluginName, false);
-    return ret;
+    return pxm && pxm->LoadPluginOnDemand(pluginName);
   }
   return false;
 }
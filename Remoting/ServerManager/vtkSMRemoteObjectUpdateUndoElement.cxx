@@ -11,6 +11,7 @@
 #include "vtkSMRemoteObject.h"
 #include "vtkSMSession.h"
 #include "vtkSMStateLocator.h"
+#include "vtkSMUndoStateInternals.h"
 
 #include <vtkNew.h>
 
@@ -21,17 +22,18 @@ vtkSetObjectImplementationMacro(
 vtkSMRemoteObjectUpdateUndoElement::vtkSMRemoteObjectUpdateUndoElement()
 {
   this->ProxyLocator = nullptr;
-  this->AfterState = new vtkSMMessage();
-  this->BeforeState = new vtkSMMessage();
+  this->GlobalId = 0;
+  this->AfterStateData = new vtkSMUndoStateInternals();
+  this->BeforeStateData = new vtkSMUndoStateInternals();
 }
 
 //-----------------------------------------------------------------------------
 vtkSMRemoteObjectUpdateUndoElement::~vtkSMRemoteObjectUpdateUndoElement()
 {
-  delete this->AfterState;
-  delete this->BeforeState;
-  this->AfterState = nullptr;
-  this->BeforeState = nullptr;
+  delete this->AfterStateData;
+  delete this->BeforeStateData;
+  this->AfterStateData = nullptr;
+  this->BeforeStateData = nullptr;
 
   this->SetProxyLocator(nullptr);
 }
@@ -41,23 +43,28 @@ void vtkSMRemoteObjectUpdateUndoElement::PrintSelf(ostream& os, vtkIndent indent
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "GlobalId: " << this->GetGlobalId() << endl;
+  vtkSMMessage state;
   os << indent << "Before state: " << endl;
-  if (this->BeforeState)
-    this->BeforeState->PrintDebugString();
+  this->GetBeforeState(&state);
+  state.PrintDebugString();
   os << indent << "After state: " << endl;
-  if (this->AfterState)
-    this->AfterState->PrintDebugString();
+  this->GetAfterState(&state);
+  state.PrintDebugString();
 }
 //-----------------------------------------------------------------------------
 int vtkSMRemoteObjectUpdateUndoElement::Undo()
 {
-  return this->UpdateState(this->BeforeState);
+  vtkSMMessage state;
+  this->GetBeforeState(&state);
+  return this->UpdateState(&state);
 }
 
 //-----------------------------------------------------------------------------
 int vtkSMRemoteObjectUpdateUndoElement::Redo()
 {
-  return this->UpdateState(this->AfterState);
+  vtkSMMessage state;
+  this->GetAfterState(&state);
+  return this->UpdateState(&state);
 }
 
 //-----------------------------------------------------------------------------
@@ -93,12 +100,14 @@ int vtkSMRemoteObjectUpdateUndoElement::UpdateState(const vtkSMMessage* state)
 void vtkSMRemoteObjectUpdateUndoElement::SetUndoRedoState(
   const vtkSMMessage* before, const vtkSMMessage* after)
 {
-  this->BeforeState->Clear();
-  this->AfterState->Clear();
+  this->GlobalId = 0;
+  this->BeforeStateData->Clear();
+  this->AfterStateData->Clear();
   if (before && after)
   {
-    this->BeforeState->CopyFrom(*before);
-    this->AfterState->CopyFrom(*after);
+    this->GlobalId = before->global_id();
+    this->BeforeStateData->Set(this->GlobalId, *before);
+    this->AfterStateData->Set(this->GlobalId, *after);
   }
   else
   {
@@ -106,8 +115,20 @@ void vtkSMRemoteObjectUpdateUndoElement::SetUndoRedoState(
       << "At least one of the provided states is NULL.");
   }
 }
+//-----------------------------------------------------------------------------
+void vtkSMRemoteObjectUpdateUndoElement::GetBeforeState(vtkSMMessage* state)
+{
+  this->BeforeStateData->Get(*state);
+}
+
+//-----------------------------------------------------------------------------
+void vtkSMRemoteObjectUpdateUndoElement::GetAfterState(vtkSMMessage* state)
+{
+  this->AfterStateData->Get(*state);
+}
+
 //-----------------------------------------------------------------------------
 vtkTypeUInt32 vtkSMRemoteObjectUpdateUndoElement::GetGlobalId()
 {
-  return this->BeforeState->global_id();
+  return this->GlobalId;
 }
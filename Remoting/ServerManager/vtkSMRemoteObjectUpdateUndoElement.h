@@ -7,6 +7,10 @@
  * This class keeps the before and after state of the RemoteObject in the
  * vtkSMMessage form. It works with any proxy and RemoteObject. It is a very
  * generic undoElement.
+ *
+ * The states are kept serialized and split per property, sharing the
+ * properties that did not change with the other undo elements of the same
+ * object (see vtkSMUndoStack::GetActualMemorySize()).
  */
 
 #ifndef vtkSMRemoteObjectUpdateUndoElement_h
@@ -18,6 +22,7 @@
 #include "vtkWeakPointer.h" //  needed for vtkWeakPointer.
 
 class vtkSMProxyLocator;
+class vtkSMUndoStateInternals;
 
 class VTKREMOTINGSERVERMANAGER_EXPORT vtkSMRemoteObjectUpdateUndoElement : public vtkSMUndoElement
 {
@@ -48,9 +53,14 @@ public:
    */
   virtual void SetUndoRedoState(const vtkSMMessage* before, const vtkSMMessage* after);
 
-  // Current full state of the UndoElement
-  vtkSMMessage* BeforeState;
-  vtkSMMessage* AfterState;
+  ///@{
+  /**
+   * Get the full state of the remote object before and after the change. These
+   * replace the former public `BeforeState` and `AfterState` members.
+   */
+  void GetBeforeState(vtkSMMessage* state);
+  void GetAfterState(vtkSMMessage* state);
+  ///@}
 
   virtual vtkTypeUInt32 GetGlobalId();
 
@@ -63,7 +73,13 @@ protected:
 
   vtkSMProxyLocator* ProxyLocator;
 
+  vtkTypeUInt32 GlobalId;
+  vtkSMUndoStateInternals* BeforeStateData;
+  vtkSMUndoStateInternals* AfterStateData;
+
 private:
+  friend class vtkSMUndoStack;
+
   vtkSMRemoteObjectUpdateUndoElement(const vtkSMRemoteObjectUpdateUndoElement&) = delete;
   void operator=(const vtkSMRemoteObjectUpdateUndoElement&) = delete;
 };
@@ -54,6 +54,7 @@ vtkSMSession::vtkSMSession(bool initialize_during_constructor /*=true*/,
   }
 
   this->SessionProxyManager = nullptr;
+  this->PushBatchCount = 0;
   this->StateLocator = vtkSMStateLocator::New();
 
   // Create and setup deserializer for the local ProxyLocator
@@ -114,6 +115,26 @@ void vtkSMSession::PushState(vtkSMMessage* msg)
   this->Superclass::PushState(msg);
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSession::BeginPushBatch()
+{
+  ++this->PushBatchCount;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSession::EndPushBatch()
+{
+  if (this->PushBatchCount == 0)
+  {
+    vtkWarningMacro("EndPushBatch() called without a matching BeginPushBatch().");
+    return;
+  }
+  if (--this->PushBatchCount == 0)
+  {
+    this->FlushPushBatch();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSession::UpdateStateHistory(vtkSMMessage* msg)
 {
@@ -203,6 +224,7 @@ bool vtkSMSession::IsMPIInitialized(vtkTypeUInt32)
 void vtkSMSession::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "PushBatchActive: " << this->GetPushBatchActive() << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -386,3 +408,22 @@ void vtkSMSession::ProcessNotification(const vtkSMMessage* message)
     this->StopProcessingRemoteNotification(previousValue);
   }
 }
+
+//----------------------------------------------------------------------------
+vtkSMPushBatchScope::vtkSMPushBatchScope(vtkSMSession* session)
+  : Session(session)
+{
+  if (this->Session)
+  {
+    this->Session->BeginPushBatch();
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkSMPushBatchScope::~vtkSMPushBatchScope()
+{
+  if (this->Session)
+  {
+    this->Session->EndPushBatch();
+  }
+}
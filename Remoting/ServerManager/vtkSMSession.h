@@ -132,6 +132,27 @@ public:
    */
   void PushState(vtkSMMessage* msg) override;
 
+  ///@{
+  /**
+   * Begin/end a push batch. Within a batch, sessions connected to remote
+   * processes may hold back the states given to PushState() and send them in a
+   * single message once the outermost batch ends. Consecutive property updates
+   * of the same proxy are then folded into one, the last value of a property
+   * winning. Batches may be nested. Any request that needs the servers to be up
+   * to date (pull, gather information, stream execution...) sends the pending
+   * states first, hence batching never changes the order the servers process
+   * them in. Prefer vtkSMPushBatchScope to calling these directly from C++.
+   */
+  void BeginPushBatch();
+  void EndPushBatch();
+  ///@}
+
+  /**
+   * Returns true if the session is within a BeginPushBatch() and
+   * EndPushBatch() block.
+   */
+  bool GetPushBatchActive() const { return this->PushBatchCount > 0; }
+
   /**
    * Sends the message to all clients.
    */
@@ -300,6 +321,13 @@ protected:
    */
   void UpdateStateHistory(vtkSMMessage* msg);
 
+  /**
+   * Called when the outermost push batch ends. Subclasses that hold back
+   * pushed states should send them here. Default implementation does nothing
+   * since the builtin session applies states immediately.
+   */
+  virtual void FlushPushBatch() {}
+
   vtkSMSessionProxyManager* SessionProxyManager;
   vtkSMStateLocator* StateLocator;
   vtkSMProxyLocator* ProxyLocator;
@@ -307,6 +335,33 @@ protected:
 private:
   vtkSMSession(const vtkSMSession&) = delete;
   void operator=(const vtkSMSession&) = delete;
+
+  int PushBatchCount;
 };
 
+#if !defined(__VTK_WRAP__)
+/**
+ * Helper that calls session->BeginPushBatch() in its constructor and
+ * session->EndPushBatch() in its destructor.
+ * @code
+ * {
+ *    vtkSMPushBatchScope batch(session);
+ *    ...
+ * }
+ * @endcode
+ */
+class VTKREMOTINGSERVERMANAGER_EXPORT vtkSMPushBatchScope
+{
+  vtkSMSession* Session;
+
+public:
+  vtkSMPushBatchScope(vtkSMSession* session);
+  ~vtkSMPushBatchScope();
+
+private:
+  vtkSMPushBatchScope(const vtkSMPushBatchScope&) = delete;
+  void operator=(const vtkSMPushBatchScope&) = delete;
+};
+#endif
+
 #endif
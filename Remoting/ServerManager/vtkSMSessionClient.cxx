@@ -36,6 +36,7 @@
 #include <vtksys/RegularExpression.hxx>
 
 #include <cassert>
+#include <map>
 #include <set>
 
 //****************************************************************************/
@@ -49,6 +50,73 @@ void RMICallback(
   vtkSMSessionClient* self = reinterpret_cast<vtkSMSessionClient*>(localArg);
   self->OnServerNotificationMessageRMI(remoteArg, remoteArgLength);
 }
+
+// Returns true if `message` only carries property values for an existing
+// remote object, i.e. what vtkSMProxy::UpdateVTKObjects() pushes once the
+// proxy has been created. Command properties (without value) are excluded
+// since each push triggers a call on the server.
+bool IsPropertyUpdate(const vtkSMMessage& message)
+{
+  if (message.share_only() || message.ExtensionSize(ProxyState::property) == 0)
+  {
+    return false;
+  }
+  for (int cc = 0; cc < message.ExtensionSize(ProxyState::property); ++cc)
+  {
+    if (!message.GetExtension(ProxyState::property, cc).has_value())
+    {
+      return false;
+    }
+  }
+  vtkSMMessage header;
+  header.set_global_id(message.global_id());
+  header.set_location(message.location());
+  header.set_client_id(message.client_id());
+  header.set_req_def(message.req_def());
+  vtkSMMessage rest(message);
+  rest.ClearExtension(ProxyState::property);
+  return rest.SerializeAsString() == header.SerializeAsString();
+}
+
+// Folds the property values of `update` into `target`, replacing the values
+// of properties already present. Returns false, leaving `target` untouched,
+// if the two messages cannot be folded.
+bool FoldPropertyUpdate(vtkSMMessage& target, const vtkSMMessage& update)
+{
+  if (target.global_id() != update.global_id() || target.location() != update.location() ||
+    target.share_only() || !IsPropertyUpdate(update))
+  {
+    return false;
+  }
+
+  std::map<std::string, int> indices;
+  for (int cc = 0; cc < target.ExtensionSize(ProxyState::property); ++cc)
+  {
+    const auto& prop = target.GetExtension(ProxyState::property, cc);
+    if (!prop.has_value())
+    {
+      // a command is pending, values set after it must be pushed after it.
+      return false;
+    }
+    indices[prop.name()] = cc;
+  }
+
+  for (int cc = 0; cc < update.ExtensionSize(ProxyState::property); ++cc)
+  {
+    const auto& prop = update.GetExtension(ProxyState::property, cc);
+    auto iter = indices.find(prop.name());
+    if (iter != indices.end())
+    {
+      target.MutableExtension(ProxyState::property, iter->second)->CopyFrom(prop);
+    }
+    else
+    {
+      indices[prop.name()] = target.ExtensionSize(ProxyState::property);
+      target.AddExtension(ProxyState::property)->CopyFrom(prop);
+    }
+  }
+  return true;
+}
 };
 //****************************************************************************/
 vtkStandardNewMacro(vtkSMSessionClient);
@@ -81,6 +149,9 @@ vtkSMSessionClient::vtkSMSessionClient()
   // Default value
   this->NoMoreDelete = false;
   this->NotBusy = 0;
+  this->PendingPushes = new vtkSMMessageCollection();
+  this->NumberOfPushMessages = 0;
+  this->NumberOfPushBatchMessages = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -109,6 +180,9 @@ vtkSMSessionClient::~vtkSMSessionClient()
 
   delete this->ServerLastInvokeResult;
   this->ServerLastInvokeResult = nullptr;
+
+  delete this->PendingPushes;
+  this->PendingPushes = nullptr;
 }
 
 //----------------------------------------------------------------------------
@@ -522,6 +596,7 @@ bool vtkSMSessionClient::IsMPIInitialized(vtkTypeUInt32 servers)
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::CloseSession()
 {
+  this->FlushPushBatch();
   if (this->DataServerController)
   {
     this->DataServerController->TriggerRMIOnAllChildren(vtkPVSessionServer::CLOSE_SESSION);
@@ -585,8 +660,20 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
   {
     controllers[num_controllers++] = this->RenderServerController;
   }
-  if (num_controllers > 0)
+  if (num_controllers > 0 && this->GetPushBatchActive())
   {
+    // Hold the state back until the batch ends, folding it into the previous
+    // one when it only updates property values of the same proxy.
+    int count = this->PendingPushes->item_size();
+    if (count == 0 || !FoldPropertyUpdate(*this->PendingPushes->mutable_item(count - 1), *message))
+    {
+      this->PendingPushes->add_item()->CopyFrom(*message);
+    }
+  }
+  else if (num_controllers > 0)
+  {
+    this->FlushPushBatch();
+
     vtkMultiProcessStream stream;
     stream << static_cast<int>(vtkPVSessionServer::PUSH);
     stream << message->SerializeAsString();
@@ -596,6 +683,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
     {
       controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
         static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+      ++this->NumberOfPushMessages;
     }
   }
 
@@ -626,6 +714,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         // Add extra-information
         msg.set_share_only(true);
         msg.set_client_id(this->ServerInformation->GetClientId());
+        this->FlushPushBatch();
 
         vtkMultiProcessStream stream;
         stream << static_cast<int>(vtkPVSessionServer::PUSH);
@@ -634,6 +723,7 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
         stream.GetRawData(raw_message);
         this->DataServerController->TriggerRMIOnAllChildren(&raw_message[0],
           static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+        ++this->NumberOfPushMessages;
       }
       else if (!remoteObject)
       {
@@ -655,10 +745,63 @@ void vtkSMSessionClient::PushState(vtkSMMessage* message)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkSMSessionClient::FlushPushBatch()
+{
+  if (this->PendingPushes->item_size() == 0)
+  {
+    return;
+  }
+
+  // Split the pending states per server, keeping their order.
+  vtkSMMessageCollection dataServerPushes;
+  vtkSMMessageCollection renderServerPushes;
+  for (int cc = 0; cc < this->PendingPushes->item_size(); ++cc)
+  {
+    const vtkSMMessage& message = this->PendingPushes->item(cc);
+    if ((message.location() & (vtkPVSession::DATA_SERVER | vtkPVSession::DATA_SERVER_ROOT)) != 0)
+    {
+      dataServerPushes.add_item()->CopyFrom(message);
+    }
+    if ((message.location() & (vtkPVSession::RENDER_SERVER | vtkPVSession::RENDER_SERVER_ROOT)) !=
+      0)
+    {
+      renderServerPushes.add_item()->CopyFrom(message);
+    }
+  }
+  this->PendingPushes->Clear();
+
+  vtkMultiProcessController* controllers[2] = { this->DataServerController,
+    this->RenderServerController };
+  const vtkSMMessageCollection* pushes[2] = { &dataServerPushes, &renderServerPushes };
+  for (int cc = 0; cc < 2; cc++)
+  {
+    if (controllers[cc] == nullptr || pushes[cc]->item_size() == 0)
+    {
+      continue;
+    }
+    vtkMultiProcessStream stream;
+    stream << static_cast<int>(vtkPVSessionServer::PUSH_BATCH);
+    stream << pushes[cc]->SerializeAsString();
+    std::vector<unsigned char> raw_message;
+    stream.GetRawData(raw_message);
+    controllers[cc]->TriggerRMIOnAllChildren(&raw_message[0],
+      static_cast<int>(raw_message.size()), vtkPVSessionServer::CLIENT_SERVER_MESSAGE_RMI);
+    ++this->NumberOfPushBatchMessages;
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkSMSessionClient::GetNumberOfPendingPushes()
+{
+  return this->PendingPushes->item_size();
+}
+
 //----------------------------------------------------------------------------
 void vtkSMSessionClient::PullState(vtkSMMessage* message)
 {
   this->StartBusyWork();
+  this->FlushPushBatch();
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
 
@@ -714,6 +857,7 @@ void vtkSMSessionClient::ExecuteStream(
     return;
   }
 
+  this->FlushPushBatch();
   location = this->GetRealLocation(location);
 
   vtkMultiProcessController* controllers[2] = { nullptr, nullptr };
@@ -758,6 +902,7 @@ void vtkSMSessionClient::ExecuteStream(
 const vtkClientServerStream& vtkSMSessionClient::GetLastResult(vtkTypeUInt32 location)
 {
   this->StartBusyWork();
+  this->FlushPushBatch();
   location = this->GetRealLocation(location);
 
   vtkMultiProcessController* controller = nullptr;
@@ -806,6 +951,7 @@ bool vtkSMSessionClient::GatherInformation(
   vtkTypeUInt32 location, vtkPVInformation* information, vtkTypeUInt32 globalid)
 {
   this->StartBusyWork();
+  this->FlushPushBatch();
   if (this->RenderServerController == nullptr)
   {
     // re-route all render-server messages to data-server.
@@ -903,6 +1049,7 @@ void vtkSMSessionClient::UnRegisterSIObject(vtkSMMessage* message)
   {
     return;
   }
+  this->FlushPushBatch();
 
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
@@ -944,6 +1091,7 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
   {
     return;
   }
+  this->FlushPushBatch();
 
   vtkTypeUInt32 location = this->GetRealLocation(message->location());
   message->set_location(location);
@@ -986,6 +1134,9 @@ void vtkSMSessionClient::RegisterSIObject(vtkSMMessage* message)
 void vtkSMSessionClient::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfPendingPushes: " << this->PendingPushes->item_size() << endl;
+  os << indent << "NumberOfPushMessages: " << this->NumberOfPushMessages << endl;
+  os << indent << "NumberOfPushBatchMessages: " << this->NumberOfPushBatchMessages << endl;
 }
 //----------------------------------------------------------------------------
 vtkTypeUInt32 vtkSMSessionClient::GetNextGlobalUniqueIdentifier()
@@ -192,6 +192,17 @@ public:
    */
   int GetConnectID();
 
+  ///@{
+  /**
+   * Number of PUSH and PUSH_BATCH messages sent so far, counting one per
+   * server a message is sent to, and number of states held back by the
+   * ongoing push batch. Useful to check how states are batched.
+   */
+  vtkGetMacro(NumberOfPushMessages, vtkTypeUInt64);
+  vtkGetMacro(NumberOfPushBatchMessages, vtkTypeUInt64);
+  int GetNumberOfPendingPushes();
+  ///@}
+
   //---------------------------------------------------------------------------
   // API for GlobalId management
   //---------------------------------------------------------------------------
@@ -239,6 +250,13 @@ protected:
    */
   vtkTypeUInt32 GetRealLocation(vtkTypeUInt32);
 
+  /**
+   * Sends the states held back by an ongoing push batch to the servers, as a
+   * single PUSH_BATCH message per server. Called when the outermost batch ends
+   * and before any other request is sent to the servers.
+   */
+  void FlushPushBatch() override;
+
   // Both maybe the same when connected to pvserver.
   vtkMultiProcessController* RenderServerController;
   vtkMultiProcessController* DataServerController;
@@ -278,6 +296,9 @@ private:
   void operator=(const vtkSMSessionClient&) = delete;
 
   int NotBusy;
+  vtkSMMessageCollection* PendingPushes;
+  vtkTypeUInt64 NumberOfPushMessages;
+  vtkTypeUInt64 NumberOfPushBatchMessages;
   vtkTypeUInt32 LastGlobalID;
   vtkTypeUInt32 LastGlobalIDAvailable;
 };
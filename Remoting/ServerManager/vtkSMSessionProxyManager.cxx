@@ -8,16 +8,19 @@
 #include "vtkEventForwarderCommand.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVPluginLoader.h"
 #include "vtkPVProxyDefinitionIterator.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
 #include "vtkProcessModule.h"
 #include "vtkReservedRemoteObjectIds.h"
+#include "vtkSMBinaryStateUtilities.h"
 #include "vtkSMCollaborationManager.h"
 #include "vtkSMCoreUtilities.h"
 #include "vtkSMDeserializerProtobuf.h"
 #include "vtkSMDocumentation.h"
 #include "vtkSMPipelineState.h"
+#include "vtkSMPluginLoaderProxy.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMPropertyIterator.h"
 #include "vtkSMProxy.h"
@@ -325,6 +328,38 @@ vtkSMProxy* vtkSMSessionProxyManager::NewProxy(
   return proxy;
 }
 
+//---------------------------------------------------------------------------
+bool vtkSMSessionProxyManager::LoadPluginOnDemand(const char* pluginName)
+{
+  if (!pluginName || !*pluginName)
+  {
+    return false;
+  }
+  if (this->Internals->LoadedOnDemandPlugins.count(pluginName) != 0)
+  {
+    return true;
+  }
+
+  // Ensure local plugin is loaded
+  vtkNew<vtkPVPluginLoader> loader;
+  bool ret = loader->LoadPluginByName(pluginName, false);
+
+  // Ensure remote plugin is loaded
+  auto proxy = vtkSmartPointer<vtkSMPluginLoaderProxy>::Take(
+    vtkSMPluginLoaderProxy::SafeDownCast(this->NewProxy("misc", "PluginLoader")));
+  if (!proxy)
+  {
+    return false;
+  }
+  proxy->UpdateVTKObjects();
+  ret &= proxy->LoadPluginByName(pluginName, false);
+  if (ret)
+  {
+    this->Internals->LoadedOnDemandPlugins.insert(pluginName);
+  }
+  return ret;
+}
+
 //---------------------------------------------------------------------------
 vtkSMDocumentation* vtkSMSessionProxyManager::GetProxyDocumentation(
   const char* groupName, const char* proxyName)
@@ -1302,6 +1337,24 @@ bool vtkSMSessionProxyManager::SaveXMLState(const char* filename, vtkTypeUInt32
   return this->SaveString(xmlStream.str().c_str(), filename, location);
 }
 
+//---------------------------------------------------------------------------
+bool vtkSMSessionProxyManager::SaveBinaryState(const char* filename)
+{
+  vtkSmartPointer<vtkPVXMLElement> rootElement;
+  rootElement.TakeReference(this->SaveXMLState());
+  return vtkSMBinaryStateUtilities::Write(rootElement, filename);
+}
+
+//---------------------------------------------------------------------------
+void vtkSMSessionProxyManager::LoadBinaryState(
+  const char* filename, vtkSMStateLoader* loader /*=nullptr*/)
+{
+  if (auto rootElement = vtkSMBinaryStateUtilities::Read(filename))
+  {
+    this->LoadXMLState(rootElement, loader);
+  }
+}
+
 //---------------------------------------------------------------------------
 vtkPVXMLElement* vtkSMSessionProxyManager::SaveXMLState()
 {
@@ -162,6 +162,15 @@ public:
   vtkSMProxy* NewProxy(
     const char* groupName, const char* proxyName, const char* subProxyName = nullptr);
 
+  /**
+   * Loads the plugin `pluginName` locally and on the server, if it is not
+   * already loaded. Used by proxies of delayed load plugins, which only carry
+   * the plugin XMLs until one of them is first instantiated. A plugin loaded
+   * successfully is remembered so that later proxies do not need another
+   * round trip to the server. Returns true on success.
+   */
+  bool LoadPluginOnDemand(const char* pluginName);
+
   /**
    * Returns a vtkSMDocumentation object with the documentation
    * for the proxy with given name and group name. Note that the name and group
@@ -434,6 +443,17 @@ public:
    */
   bool SaveXMLState(const char* filename, vtkTypeUInt32 location = 0x10 /*vtkPVSession::CLIENT*/);
 
+  ///@{
+  /**
+   * Save and load the state of the server manager in the compact binary form
+   * of vtkSMBinaryStateUtilities. The binary state holds the same tree as the
+   * XML state, including what observers of `vtkCommand::SaveStateEvent` add,
+   * but is faster to write and read. The file is always on the client.
+   */
+  bool SaveBinaryState(const char* filename);
+  void LoadBinaryState(const char* filename, vtkSMStateLoader* loader = nullptr);
+  ///@}
+
   /**
    * Saves the state of the server manager as XML, and returns the
    * vtkPVXMLElement for the root of the state.
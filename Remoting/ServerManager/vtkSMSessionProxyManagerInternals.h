@@ -199,6 +199,9 @@ struct vtkSMSessionProxyManagerInternals
   // Data structure for storing the fullState
   vtkSMMessage State;
 
+  // Names of the delayed load plugins already loaded for this session.
+  std::set<std::string> LoadedOnDemandPlugins;
+
   // Keep ref to the proxyManager to access the session
   vtkSMSessionProxyManager* ProxyManager;
 
@@ -26,7 +26,9 @@
 #include "vtkSMStringVectorProperty.h"
 #include "vtkSmartPointer.h"
 
+#include <algorithm>
 #include <cassert>
+#include <iterator>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -361,6 +363,94 @@ void vtkSMSourceProxy::UpdatePipeline(double time)
   // this->InvalidateDataInformation();
 }
 
+//---------------------------------------------------------------------------
+void vtkSMSourceProxy::UpdatePipelines(vtkCollection* sources)
+{
+  vtkSMSourceProxy::UpdatePipelinesInternal(sources, 0.0, false);
+}
+
+//---------------------------------------------------------------------------
+void vtkSMSourceProxy::UpdatePipelines(vtkCollection* sources, double time)
+{
+  vtkSMSourceProxy::UpdatePipelinesInternal(sources, time, true);
+}
+
+//---------------------------------------------------------------------------
+void vtkSMSourceProxy::UpdatePipelinesInternal(
+  vtkCollection* sources, double time, bool doTime)
+{
+  if (!sources)
+  {
+    return;
+  }
+
+  // Schedule the update of the output ports of the sources sharing a session
+  // and a location, then update them with a single request to that location.
+  struct Group
+  {
+    vtkSMSession* Session;
+    vtkTypeUInt32 Location;
+    std::vector<vtkSMSourceProxy*> Sources;
+    vtkClientServerStream Stream;
+  };
+  std::vector<Group> groups;
+  for (int cc = 0; cc < sources->GetNumberOfItems(); ++cc)
+  {
+    vtkSMSourceProxy* source = vtkSMSourceProxy::SafeDownCast(sources->GetItemAsObject(cc));
+    if (!source || (!doTime && !source->NeedsUpdate))
+    {
+      continue;
+    }
+
+    vtkSMSession* session = source->GetSession();
+    const vtkTypeUInt32 location = source->GetLocation();
+    auto group = std::find_if(groups.begin(), groups.end(), [&](const Group& item) {
+      return item.Session == session && item.Location == location;
+    });
+    if (group == groups.end())
+    {
+      groups.push_back(Group{ session, location, {}, {} });
+      group = std::prev(groups.end());
+    }
+
+    source->CreateOutputPorts();
+    for (int port = 0; port < source->GetNumberOfOutputPorts(); ++port)
+    {
+      // for compound proxies, the output port belongs to one of the proxies
+      // it contains.
+      vtkSMOutputPort* outputPort = source->GetOutputPort(port);
+      group->Stream << vtkClientServerStream::Invoke
+                    << SIPROXY(outputPort->SourceProxy.GetPointer()) << "ScheduleUpdatePipeline"
+                    << outputPort->GetPortIndex() << time << (doTime ? 1 : 0)
+                    << vtkClientServerStream::End;
+    }
+    group->Sources.push_back(source);
+  }
+
+  for (Group& group : groups)
+  {
+    vtkSMSourceProxy* first = group.Sources.front();
+    group.Stream << vtkClientServerStream::Invoke << SIPROXY(first) << "UpdateScheduledPipelines"
+                 << vtkClientServerStream::End;
+    if (group.Session)
+    {
+      group.Session->PrepareProgress();
+    }
+    first->ExecuteStream(group.Stream);
+    if (group.Session)
+    {
+      group.Session->CleanupPendingProgress();
+    }
+
+    for (vtkSMSourceProxy* source : group.Sources)
+    {
+      // see UpdatePipeline(double) for why NeedsUpdate is set.
+      source->NeedsUpdate = true;
+      source->PostUpdateData(false);
+    }
+  }
+}
+
 //---------------------------------------------------------------------------
 void vtkSMSourceProxy::CreateVTKObjects()
 {
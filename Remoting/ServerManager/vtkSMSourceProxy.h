@@ -24,6 +24,7 @@
 #include "vtkRemotingServerManagerModule.h" //needed for exports
 #include "vtkSMProxy.h"
 
+class vtkCollection;
 class vtkPVArrayInformation;
 class vtkPVDataInformation;
 class vtkPVDataSetAttributesInformation;
@@ -58,6 +59,20 @@ public:
    */
   virtual void UpdatePipeline(double time);
 
+  ///@{
+  /**
+   * Updates the pipelines of all the source proxies in `sources` with a single
+   * request to the server, like calling UpdatePipeline() (or
+   * UpdatePipeline(time)) on each of them. The server updates independent
+   * branches of the pipeline concurrently when
+   * vtkPVGeneralSettings::GetEnableConcurrentPipelineUpdates() is true.
+   * Sources from a session other than the one of the first source are
+   * updated one after the other.
+   */
+  static void UpdatePipelines(vtkCollection* sources);
+  static void UpdatePipelines(vtkCollection* sources, double time);
+  ///@}
+
   ///@{
   /**
    * Returns if the output port proxies have been created.
@@ -297,6 +312,8 @@ protected:
    */
   void PostUpdateData(bool) override;
 
+  static void UpdatePipelinesInternal(vtkCollection* sources, double time, bool doTime);
+
   /**
    * Overridden to pass the logname to the internal ExtractSelection proxies.
    */
@@ -4,6 +4,7 @@
 
 #include "vtkClientServerStreamInstantiator.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
 #include "vtkPVXMLElement.h"
 #include "vtkSMProperty.h"
 #include "vtkSMPropertyLink.h"
@@ -20,6 +21,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <unordered_map>
 #include <vector>
 
 vtkObjectFactoryNewMacro(vtkSMStateLoader);
@@ -47,6 +49,33 @@ struct vtkSMStateLoaderInternals
   ProxyCreationOrderType ProxyCreationOrder;
   bool DeferProxyRegistration;
 
+  /// Proxy state elements of ProxyElementsRoot, indexed by id, so that
+  /// LocateProxyElement() does not walk the whole state for each proxy.
+  std::unordered_map<vtkTypeUInt32, vtkPVXMLElement*> ProxyElements;
+  vtkPVXMLElement* ProxyElementsRoot = nullptr;
+
+  /// Fills ProxyElements the same way LocateProxyElementInternal() searches:
+  /// proxies directly under an element come before the nested ones, and the
+  /// first proxy with a given id wins.
+  void IndexProxyElements(vtkPVXMLElement* root)
+  {
+    const unsigned int numElems = root->GetNumberOfNestedElements();
+    for (unsigned int i = 0; i < numElems; i++)
+    {
+      vtkPVXMLElement* currentElement = root->GetNestedElement(i);
+      vtkIdType currentId;
+      if (currentElement->GetName() && strcmp(currentElement->GetName(), "Proxy") == 0 &&
+        currentElement->GetScalarAttribute("id", &currentId))
+      {
+        this->ProxyElements.emplace(static_cast<vtkTypeUInt32>(currentId), currentElement);
+      }
+    }
+    for (unsigned int i = 0; i < numElems; i++)
+    {
+      this->IndexProxyElements(root->GetNestedElement(i));
+    }
+  }
+
   vtkSMStateLoaderInternals()
     : KeepOriginalId(false)
     , DeferProxyRegistration(false)
@@ -210,25 +239,34 @@ void vtkSMStateLoader::CreatedNewProxy(vtkTypeUInt32 id, vtkSMProxy* proxy)
 
   // Calling UpdateVTKObjects() will assign the proxy a GlobalId, if needed.
   proxy->UpdateVTKObjects();
-  if (proxy->IsA("vtkSMSourceProxy"))
-  {
-    vtkSMSourceProxy::SafeDownCast(proxy)->UpdatePipelineInformation();
-  }
-  else if (proxy->IsA("vtkSMImporterProxy"))
-  {
-    proxy->UpdatePipelineInformation();
-  }
   if (this->Internal->DeferProxyRegistration)
   {
+    // Pipeline information is updated just before registration, once all
+    // proxies are created, so that creating them does not need a round trip to
+    // the server for each source.
     this->Internal->ProxyCreationOrder.push_back(
       vtkSMStateLoaderInternals::ProxyCreationOrderItem(id, proxy));
   }
   else
   {
+    vtkSMStateLoader::UpdatePipelineInformation(proxy);
     this->RegisterProxy(id, proxy);
   }
 }
 
+//---------------------------------------------------------------------------
+void vtkSMStateLoader::UpdatePipelineInformation(vtkSMProxy* proxy)
+{
+  if (proxy->IsA("vtkSMSourceProxy"))
+  {
+    vtkSMSourceProxy::SafeDownCast(proxy)->UpdatePipelineInformation();
+  }
+  else if (proxy->IsA("vtkSMImporterProxy"))
+  {
+    proxy->UpdatePipelineInformation();
+  }
+}
+
 //---------------------------------------------------------------------------
 void vtkSMStateLoader::RegisterProxy(vtkTypeUInt32 id, vtkSMProxy* proxy)
 {
@@ -307,7 +345,20 @@ bool vtkSMStateLoader::UpdateRegistrationInfo(
 //---------------------------------------------------------------------------
 vtkPVXMLElement* vtkSMStateLoader::LocateProxyElement(vtkTypeUInt32 id)
 {
-  return this->LocateProxyElementInternal(this->ServerManagerStateElement, id);
+  vtkPVXMLElement* root = this->ServerManagerStateElement;
+  if (!root)
+  {
+    vtkErrorMacro("No root is defined. Cannot locate proxy element with id " << id);
+    return nullptr;
+  }
+  if (this->Internal->ProxyElementsRoot != root)
+  {
+    this->Internal->ProxyElements.clear();
+    this->Internal->IndexProxyElements(root);
+    this->Internal->ProxyElementsRoot = root;
+  }
+  const auto iter = this->Internal->ProxyElements.find(id);
+  return iter != this->Internal->ProxyElements.end() ? iter->second : nullptr;
 }
 
 //---------------------------------------------------------------------------
@@ -531,9 +582,16 @@ int vtkSMStateLoader::LoadState(vtkPVXMLElement* elem, bool keepOriginalId)
     return 0;
   }
 
-  this->ProxyLocator->SetDeserializer(this);
-  int ret = this->LoadStateInternal(elem);
-  this->ProxyLocator->SetDeserializer(nullptr);
+  vtkVLogScopeF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "load state");
+  int ret;
+  {
+    // Send the states of all the proxies created while loading as few messages
+    // as possible.
+    vtkSMPushBatchScope batch(this->GetSession());
+    this->ProxyLocator->SetDeserializer(this);
+    ret = this->LoadStateInternal(elem);
+    this->ProxyLocator->SetDeserializer(nullptr);
+  }
 
   // BUG #10650. When animation scene time ranges are read from the state, they
   // often override those that the timekeeper painstakingly computed. Here we
@@ -564,13 +622,16 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
     }
   }
 
-  vtkSMStateVersionController* converter = vtkSMStateVersionController::New();
-  if (!converter->Process(parent, this->GetSession()))
   {
-    vtkWarningMacro("State converter was not able to convert the state to current "
-                    "version successfully");
+    vtkVLogScopeF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "convert state version");
+    vtkSMStateVersionController* converter = vtkSMStateVersionController::New();
+    if (!converter->Process(parent, this->GetSession()))
+    {
+      vtkWarningMacro("State converter was not able to convert the state to current "
+                      "version successfully");
+    }
+    converter->Delete();
   }
-  converter->Delete();
 
   if (!this->VerifyXMLVersion(rootElement))
   {
@@ -578,6 +639,8 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   }
 
   this->ServerManagerStateElement = rootElement;
+  this->Internal->ProxyElements.clear();
+  this->Internal->ProxyElementsRoot = nullptr;
 
   unsigned int numElems = rootElement->GetNumberOfNestedElements();
   unsigned int i;
@@ -622,6 +685,7 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   // present and registered.
   std::vector<vtkSmartPointer<vtkPVXMLElement>> deferredCollections;
   this->Internal->DeferProxyRegistration = true;
+  vtkVLogStartScopeF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "create-proxies", "create proxies");
   for (i = 0; i < numElems; i++)
   {
     vtkPVXMLElement* currentElement = rootElement->GetNestedElement(i);
@@ -635,34 +699,49 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
       }
       else if (!this->HandleProxyCollection(currentElement))
       {
+        vtkLogEndScope("create-proxies");
         return 0;
       }
     }
   }
+  vtkLogEndScope("create-proxies");
 
   // Register proxies in order they were created (as that's a good dependency
   // order).
-  for (vtkSMStateLoaderInternals::ProxyCreationOrderType::const_iterator iter =
-         this->Internal->ProxyCreationOrder.begin();
-       iter != this->Internal->ProxyCreationOrder.end(); ++iter)
   {
-    this->RegisterProxy(iter->first, iter->second);
+    vtkVLogScopeF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "update information and register %d proxies",
+      static_cast<int>(this->Internal->ProxyCreationOrder.size()));
+    for (const auto& item : this->Internal->ProxyCreationOrder)
+    {
+      if (item.second)
+      {
+        vtkSMStateLoader::UpdatePipelineInformation(item.second);
+      }
+    }
+    for (const auto& item : this->Internal->ProxyCreationOrder)
+    {
+      this->RegisterProxy(item.first, item.second);
+    }
   }
   this->Internal->ProxyCreationOrder.clear();
 
   // Now handle animation and timekeeper collections. This time, we let the
   // proxies be registered as needed.
   this->Internal->DeferProxyRegistration = false;
-  for (size_t cc = 0; cc < deferredCollections.size(); ++cc)
   {
-    if (!this->HandleProxyCollection(deferredCollections[cc]))
+    vtkVLogScopeF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "create animation proxies");
+    for (size_t cc = 0; cc < deferredCollections.size(); ++cc)
     {
-      return 0;
+      if (!this->HandleProxyCollection(deferredCollections[cc]))
+      {
+        return 0;
+      }
     }
   }
   assert(this->Internal->ProxyCreationOrder.size() == 0);
 
   // Process link elements.
+  vtkVLogScopeF(PARAVIEW_LOG_APPLICATION_VERBOSITY(), "load links and settings");
   for (i = 0; i < numElems; i++)
   {
     vtkPVXMLElement* currentElement = rootElement->GetNestedElement(i);
@@ -719,6 +798,8 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   // Clear internal data structures.
   this->Internal->ProxyCreationOrder.clear();
   this->Internal->RegistrationInformation.clear();
+  this->Internal->ProxyElements.clear();
+  this->Internal->ProxyElementsRoot = nullptr;
   this->ServerManagerStateElement = nullptr;
   return 1;
 }
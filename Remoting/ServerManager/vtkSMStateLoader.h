@@ -139,6 +139,14 @@ protected:
    */
   vtkPVXMLElement* LocateProxyElementInternal(vtkPVXMLElement* root, vtkTypeUInt32 id);
 
+  /**
+   * Updates the pipeline information of a newly created source or importer
+   * proxy. While the proxies of the state are created, this is deferred until
+   * all of them exist so that creating them is not interleaved with requests
+   * to the server.
+   */
+  static void UpdatePipelineInformation(vtkSMProxy* proxy);
+
   /**
    * Checks the root element for version. If failed, return false.
    */
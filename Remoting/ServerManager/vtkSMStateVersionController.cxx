@@ -80,6 +80,10 @@ public:
   }
 };
 
+// Version the last pass of vtkSMStateVersionController::Process converts
+// states to. States saved by this version or a newer one are not converted.
+const vtkSMVersion LastConversionVersion(5, 13, 0);
+
 //===========================================================================
 // Helper functions
 //===========================================================================
@@ -2111,6 +2115,14 @@ bool vtkSMStateVersionController::Process(vtkPVXMLElement* parent, vtkSMSession*
     version = vtkSMVersion(4, 2, 0);
   }
 
+  // States saved by the version of the last conversion pass, or a newer one, do
+  // not need any conversion; skip the costly round trip of the whole state
+  // through pugixml.
+  if (!(version < LastConversionVersion))
+  {
+    return true;
+  }
+
   // A little hackish for now, convert vtkPVXMLElement to string.
   std::ostringstream stream;
   root->PrintXML(stream, vtkIndent());
@@ -2186,11 +2198,12 @@ bool vtkSMStateVersionController::Process(vtkPVXMLElement* parent, vtkSMSession*
     version = vtkSMVersion(5, 12, 0);
   }
 
-  if (status && (version < vtkSMVersion(5, 13, 0)))
+  // when adding a conversion pass, update LastConversionVersion.
+  if (status && (version < LastConversionVersion))
   {
     Process_5_12_to_5_13 converter;
     status = converter(document);
-    version = vtkSMVersion(5, 13, 0);
+    version = LastConversionVersion;
   }
 
   if (status)
@@ -11,6 +11,7 @@
 #include "vtkStringList.h"
 
 #include <cmath>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkSMStringListDomain);
@@ -18,6 +19,23 @@ vtkStandardNewMacro(vtkSMStringListDomain);
 struct vtkSMStringListDomainInternals
 {
   std::vector<std::string> Strings;
+
+  // Position of the first occurrence of each string, built on demand so that
+  // checking all the values of a large array selection is linear.
+  std::unordered_map<std::string, unsigned int> Index;
+
+  const std::unordered_map<std::string, unsigned int>& GetIndex()
+  {
+    if (this->Index.empty())
+    {
+      this->Index.reserve(this->Strings.size());
+      for (size_t cc = 0; cc < this->Strings.size(); ++cc)
+      {
+        this->Index.emplace(this->Strings[cc], static_cast<unsigned int>(cc));
+      }
+    }
+    return this->Index;
+  }
 };
 
 //---------------------------------------------------------------------------
@@ -40,6 +58,7 @@ void vtkSMStringListDomain::SetStrings(const std::vector<std::string>& strings)
   if (this->SLInternals->Strings != strings)
   {
     this->SLInternals->Strings = strings;
+    this->SLInternals->Index.clear();
     this->DomainModified();
   }
 }
@@ -100,14 +119,17 @@ int vtkSMStringListDomain::IsInDomain(const char* val, unsigned int& idx)
   {
     return 1;
   }
+  if (!val)
+  {
+    return 0;
+  }
 
-  for (unsigned int i = 0; i < numStrings; i++)
+  const auto& index = this->SLInternals->GetIndex();
+  const auto iter = index.find(val);
+  if (iter != index.end())
   {
-    if (strcmp(val, this->GetString(i)) == 0)
-    {
-      idx = i;
-      return 1;
-    }
+    idx = iter->second;
+    return 1;
   }
   return 0;
 }
@@ -9,17 +9,20 @@
 #include "vtkProcessModule.h"
 #include "vtkSMDeserializerProtobuf.h"
 #include "vtkSMMessage.h"
+#include "vtkSMPropertyModificationUndoElement.h"
 #include "vtkSMProxyLocator.h"
 #include "vtkSMProxyManager.h"
 #include "vtkSMRemoteObjectUpdateUndoElement.h"
 #include "vtkSMSession.h"
 #include "vtkSMStateLocator.h"
 #include "vtkSMUndoElement.h"
+#include "vtkSMUndoStateInternals.h"
 #include "vtkUndoSet.h"
 #include "vtkUndoStackInternal.h"
 
 #include "vtkNew.h"
 #include <set>
+#include <unordered_set>
 #include <vtksys/RegularExpression.hxx>
 
 //*****************************************************************************
@@ -51,14 +54,16 @@ public:
       if (elem)
       {
         elem->SetProxyLocator(this->UndoSetProxyLocator.GetPointer());
+        vtkSMMessage state;
         if (useBeforeState)
         {
-          this->UndoSetStateLocator->RegisterState(elem->BeforeState);
+          elem->GetBeforeState(&state);
         }
         else
         {
-          this->UndoSetStateLocator->RegisterState(elem->AfterState);
+          elem->GetAfterState(&state);
         }
+        this->UndoSetStateLocator->RegisterState(&state);
       }
     }
   }
@@ -117,6 +122,7 @@ vtkStandardNewMacro(vtkSMUndoStack);
 vtkSMUndoStack::vtkSMUndoStack()
 {
   this->Internal = new vtkInternal();
+  this->MemoryBudget = 256 * 1024;
 }
 
 //-----------------------------------------------------------------------------
@@ -131,6 +137,54 @@ void vtkSMUndoStack::Push(const char* label, vtkUndoSet* changeSet)
 {
   this->Superclass::Push(label, changeSet);
   this->InvokeEvent(PushUndoSetEvent, changeSet);
+  this->EnforceMemoryBudget();
+}
+
+//-----------------------------------------------------------------------------
+void vtkSMUndoStack::EnforceMemoryBudget()
+{
+  auto& undoStack = this->Superclass::Internal->UndoStack;
+  bool removed = false;
+  while (this->MemoryBudget > 0 && undoStack.size() > 1 &&
+    this->GetActualMemorySize() > this->MemoryBudget)
+  {
+    undoStack.erase(undoStack.begin());
+    this->InvokeEvent(vtkUndoStack::UndoSetRemovedEvent);
+    removed = true;
+  }
+  if (removed)
+  {
+    this->Modified();
+  }
+}
+
+//-----------------------------------------------------------------------------
+unsigned long vtkSMUndoStack::GetActualMemorySize()
+{
+  std::unordered_set<const void*> counted;
+  size_t size = 0;
+  for (const auto* stack : { &this->Superclass::Internal->UndoStack,
+         &this->Superclass::Internal->RedoStack })
+  {
+    for (const auto& item : *stack)
+    {
+      vtkUndoSet* undoSet = item.UndoSet;
+      for (int cc = 0, max = undoSet->GetNumberOfElements(); cc < max; ++cc)
+      {
+        vtkUndoElement* elem = undoSet->GetElement(cc);
+        if (auto* update = vtkSMRemoteObjectUpdateUndoElement::SafeDownCast(elem))
+        {
+          size += update->BeforeStateData->GetMemorySize(counted);
+          size += update->AfterStateData->GetMemorySize(counted);
+        }
+        else if (auto* modification = vtkSMPropertyModificationUndoElement::SafeDownCast(elem))
+        {
+          size += modification->PropertyState->GetMemorySize(counted);
+        }
+      }
+    }
+  }
+  return static_cast<unsigned long>((size + 1023) / 1024);
 }
 
 //-----------------------------------------------------------------------------
@@ -187,4 +241,5 @@ void vtkSMUndoStack::FillWithRemoteObjects(vtkUndoSet* undoSet, vtkCollection* c
 void vtkSMUndoStack::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "MemoryBudget: " << this->MemoryBudget << endl;
 }
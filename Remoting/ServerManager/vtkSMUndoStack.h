@@ -17,6 +17,10 @@
  * server. GUI can use this to push its own changes that is undoable across
  * connections.
  *
+ * Besides the stack depth, the memory used by the stack is bounded by
+ * MemoryBudget: when a push makes the stack use more than the budget, the
+ * oldest undo sets are removed, always keeping the most recent one.
+ *
  * @sa
  * vtkSMUndoStackBuilder
  */
@@ -63,6 +67,22 @@ public:
    */
   int Redo() override;
 
+  ///@{
+  /**
+   * Get/Set the maximum memory, in kibibytes, the states held by the undo and
+   * redo sets may use. When pushing a set makes the stack exceed it, the
+   * oldest undo sets are removed. 0 means no limit. Default is 256 MiB.
+   */
+  vtkSetMacro(MemoryBudget, unsigned long);
+  vtkGetMacro(MemoryBudget, unsigned long);
+  ///@}
+
+  /**
+   * Returns the memory, in kibibytes, used by the states held by the undo and
+   * redo sets. States shared by several sets are only counted once.
+   */
+  unsigned long GetActualMemorySize();
+
   enum EventIds
   {
     PushUndoSetEvent = 1987,
@@ -83,6 +103,11 @@ protected:
   // is supposed to happen.
   void FillWithRemoteObjects(vtkUndoSet* undoSet, vtkCollection* collection);
 
+  // Removes the oldest undo sets until the stack fits in MemoryBudget.
+  void EnforceMemoryBudget();
+
+  unsigned long MemoryBudget;
+
 private:
   vtkSMUndoStack(const vtkSMUndoStack&) = delete;
   void operator=(const vtkSMUndoStack&) = delete;
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkSMUndoStateInternals_h
+#define vtkSMUndoStateInternals_h
+
+#include "vtkSMMessage.h" // for vtkSMMessage
+
+#include <algorithm>     // for std::max
+#include <iterator>      // for std::next
+#include <map>           // for std::map
+#include <memory>        // for std::shared_ptr
+#include <string>        // for std::string
+#include <unordered_set> // for std::unordered_set
+#include <utility>       // for std::pair, std::move
+#include <vector>        // for std::vector
+
+/// Compact, copy-on-write storage of a state kept by an undo element.
+///
+/// The state is kept in its serialized (protobuf wire format) form, split in
+/// immutable chunks: one for the message without its properties and one per
+/// property. When a chunk is identical to the last one stored for the same
+/// remote object and property, the existing buffer is shared instead of
+/// copied. The before state of an edit is usually the after state of the
+/// previous one, so a sequence of edits of a proxy only stores the properties
+/// that changed, however large the others are.
+class vtkSMUndoStateInternals
+{
+public:
+  using Chunk = std::shared_ptr<const std::string>;
+
+  /// Stores `state`, the state of the remote object `globalId`.
+  void Set(vtkTypeUInt32 globalId, const vtkSMMessage& state)
+  {
+    using paraview_protobuf::ProxyState;
+
+    vtkSMMessage header(state);
+    header.ClearExtension(ProxyState::property);
+    std::string bytes = header.SerializePartialAsString();
+    this->Header = nullptr;
+    if (!bytes.empty())
+    {
+      this->Header = vtkSMUndoStateInternals::Share(globalId, std::string(), std::move(bytes));
+    }
+
+    const int count = state.ExtensionSize(ProxyState::property);
+    this->Properties.clear();
+    this->Properties.reserve(count);
+    for (int cc = 0; cc < count; ++cc)
+    {
+      const auto& prop = state.GetExtension(ProxyState::property, cc);
+      this->Properties.push_back(
+        vtkSMUndoStateInternals::Share(globalId, prop.name(), prop.SerializePartialAsString()));
+    }
+  }
+
+  /// Restores the stored state in `state`.
+  void Get(vtkSMMessage& state) const
+  {
+    state.Clear();
+    if (this->Header)
+    {
+      state.ParsePartialFromString(*this->Header);
+    }
+    for (const auto& chunk : this->Properties)
+    {
+      state.AddExtension(paraview_protobuf::ProxyState::property)->ParsePartialFromString(*chunk);
+    }
+  }
+
+  void Clear()
+  {
+    this->Header = nullptr;
+    this->Properties.clear();
+  }
+
+  /// Returns the number of bytes used by this state, not counting the chunks
+  /// already in `counted`, and adds its chunks to `counted`. Used to measure
+  /// the memory used by many states without counting shared chunks twice.
+  size_t GetMemorySize(std::unordered_set<const void*>& counted) const
+  {
+    size_t size = sizeof(*this) + this->Properties.capacity() * sizeof(Chunk);
+    if (this->Header && counted.insert(this->Header.get()).second)
+    {
+      size += sizeof(std::string) + this->Header->capacity();
+    }
+    for (const auto& chunk : this->Properties)
+    {
+      if (counted.insert(chunk.get()).second)
+      {
+        size += sizeof(std::string) + chunk->capacity();
+      }
+    }
+    return size;
+  }
+
+private:
+  /// Returns a chunk holding `bytes`, reusing the last one stored for the same
+  /// object and key when it holds the same bytes.
+  static Chunk Share(vtkTypeUInt32 globalId, const std::string& key, std::string bytes)
+  {
+    static std::map<std::pair<vtkTypeUInt32, std::string>, std::weak_ptr<const std::string>>
+      LastChunks;
+    static size_t NextCleanup = 1024;
+
+    auto& last = LastChunks[std::make_pair(globalId, key)];
+    Chunk chunk = last.lock();
+    if (!chunk || *chunk != bytes)
+    {
+      chunk = std::make_shared<const std::string>(std::move(bytes));
+      last = chunk;
+    }
+
+    // forget the chunks no state uses anymore.
+    if (LastChunks.size() > NextCleanup)
+    {
+      for (auto iter = LastChunks.begin(); iter != LastChunks.end();)
+      {
+        iter = iter->second.expired() ? LastChunks.erase(iter) : std::next(iter);
+      }
+      NextCleanup = std::max<size_t>(1024, 2 * LastChunks.size());
+    }
+    return chunk;
+  }
+
+  Chunk Header;
+  std::vector<Chunk> Properties;
+};
+
+#endif
+
+// VTK-HeaderTest-Exclude: vtkSMUndoStateInternals.h
@@ -6,6 +6,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkLegacy.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVPipelineScheduler.h"
 #include "vtkPVSession.h"
 #include "vtkProcessModule.h"
 #include "vtkSISourceProxy.h"
@@ -289,6 +290,18 @@ void vtkPVGeneralSettings::SetNumberOfSMPThreads(int n)
   }
 }
 
+//----------------------------------------------------------------------------
+bool vtkPVGeneralSettings::GetEnableConcurrentPipelineUpdates()
+{
+  return vtkPVPipelineScheduler::GetEnableConcurrentUpdates();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVGeneralSettings::SetEnableConcurrentPipelineUpdates(bool enable)
+{
+  vtkPVPipelineScheduler::SetEnableConcurrentUpdates(enable);
+}
+
 //----------------------------------------------------------------------------
 void vtkPVGeneralSettings::PrintSelf(ostream& os, vtkIndent indent)
 {
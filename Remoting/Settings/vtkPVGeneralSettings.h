@@ -359,6 +359,15 @@ public:
   static void SetNumberOfSMPThreads(int);
   ///@}
 
+  ///@{
+  /**
+   * Enable/disable the concurrent update of independent pipeline branches on
+   * the data server. Forwarded to vtkPVPipelineScheduler.
+   */
+  static bool GetEnableConcurrentPipelineUpdates();
+  static void SetEnableConcurrentPipelineUpdates(bool);
+  ///@}
+
 protected:
   vtkPVGeneralSettings() = default;
   ~vtkPVGeneralSettings() override = default;
@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Generates image and data extracts with a vtkSMExtractsController in
+ * asynchronous mode and checks that the files and the summary table match the
+ * ones generated synchronously.
+ */
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkProcessModule.h"
+#include "vtkSMExtractsController.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMRenderViewProxy.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkTestUtilities.h"
+
+#include <vtksys/SystemTools.hxx>
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+constexpr int NumberOfTimeSteps = 3;
+constexpr int NumberOfExtractors = 2;
+
+bool Check(bool condition, const std::string& message)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << message << std::endl;
+  }
+  return condition;
+}
+
+/**
+ * Extracts all timesteps in `directory` and returns the summary table.
+ */
+vtkSmartPointer<vtkTable> Extract(
+  vtkSMSessionProxyManager* pxm, vtkSMSourceProxy* sphere, const std::string& directory, bool async)
+{
+  vtkNew<vtkSMExtractsController> controller;
+  controller->SetExtractsOutputDirectory(directory.c_str());
+  controller->SetAsynchronous(async);
+  controller->SetMaximumNumberOfPendingExtracts(2);
+  if (async && !Check(controller->CanExtractAsynchronously(), "Cannot extract asynchronously."))
+  {
+    return nullptr;
+  }
+
+  bool success = true;
+  for (int cc = 0; cc < NumberOfTimeSteps; ++cc)
+  {
+    vtkSMPropertyHelper(sphere, "ThetaResolution").Set(8 + 4 * cc);
+    sphere->UpdateVTKObjects();
+    controller->SetTimeStep(cc);
+    controller->SetTime(0.5 * cc);
+    success &= Check(controller->Extract(pxm), "Failed to extract timestep.");
+  }
+
+  if (async)
+  {
+    // with at most 2 pending extracts, the last ones are only written and
+    // added to the summary when flushed.
+    const vtkIdType total = NumberOfTimeSteps * NumberOfExtractors;
+    auto table = controller->GetSummaryTable();
+    const vtkIdType rows = table ? table->GetNumberOfRows() : 0;
+    success &= Check(rows >= total - 2 && rows < total,
+      "Unexpected number of summary entries before flushing: " + std::to_string(rows));
+    success &= Check(controller->Flush(), "Failed to flush pending extracts.");
+  }
+
+  vtkSmartPointer<vtkTable> summary = controller->GetSummaryTable();
+  return success ? summary : nullptr;
+}
+
+bool CompareSummaries(vtkTable* summary, vtkTable* reference, const std::string& directory)
+{
+  bool success = Check(summary->GetNumberOfRows() == NumberOfTimeSteps * NumberOfExtractors &&
+      summary->GetNumberOfRows() == reference->GetNumberOfRows() &&
+      summary->GetNumberOfColumns() == reference->GetNumberOfColumns(),
+    "The summary tables differ in size.");
+  for (vtkIdType col = 0; success && col < reference->GetNumberOfColumns(); ++col)
+  {
+    auto expected = vtkStringArray::SafeDownCast(reference->GetColumn(col));
+    auto array = vtkStringArray::SafeDownCast(
+      summary->GetColumnByName(reference->GetColumnName(col)));
+    success &= Check(expected && array,
+      std::string("Missing summary column: ") + reference->GetColumnName(col));
+    for (vtkIdType row = 0; success && row < reference->GetNumberOfRows(); ++row)
+    {
+      success &= Check(array->GetValue(row) == expected->GetValue(row),
+        "Summary entry differs: " + array->GetValue(row) + " != " + expected->GetValue(row));
+      // filenames are relative to the extracts directory.
+      const std::string name = array->GetName();
+      if (success && name.compare(0, 4, "FILE") == 0 && !array->GetValue(row).empty())
+      {
+        const std::string fname = directory + "/" + array->GetValue(row);
+        success &= Check(vtksys::SystemTools::FileExists(fname, true) &&
+            vtksys::SystemTools::FileLength(fname) > 0,
+          "Missing extract: " + fname);
+      }
+    }
+  }
+  return success;
+}
+}
+
+int TestAsynchronousExtracts(int argc, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT);
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    std::cerr << "Could not determine temporary directory." << std::endl;
+    vtkInitializationHelper::Finalize();
+    return EXIT_FAILURE;
+  }
+  const std::string root = std::string(tempDir) + "/TestAsynchronousExtracts";
+  delete[] tempDir;
+  vtksys::SystemTools::RemoveADirectory(root);
+
+  bool success = true;
+  {
+    vtkNew<vtkSMSession> session;
+    vtkProcessModule::GetProcessModule()->RegisterSession(session);
+    vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+    controller->InitializeSession(session);
+    vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+    vtkSmartPointer<vtkSMRenderViewProxy> view;
+    view.TakeReference(vtkSMRenderViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+    controller->InitializeProxy(view);
+    controller->RegisterViewProxy(view);
+
+    vtkSmartPointer<vtkSMSourceProxy> sphere;
+    sphere.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "SphereSource")));
+    controller->InitializeProxy(sphere);
+    controller->RegisterPipelineProxy(sphere);
+    controller->Show(sphere, 0, view);
+    view->ResetCamera();
+
+    vtkNew<vtkSMExtractsController> extracts;
+    auto image = extracts->CreateExtractor(view, "PNG", "Image");
+    auto data = extracts->CreateExtractor(sphere->GetOutputPort(0u), "VTP", "Data");
+    success &= Check(image && data, "Failed to create the extractors.");
+    if (success)
+    {
+      vtkSMPropertyHelper(vtkSMPropertyHelper(image, "Writer").GetAsProxy(), "FileName")
+        .Set("image_{timestep:06d}.png");
+      vtkSMPropertyHelper(vtkSMPropertyHelper(data, "Writer").GetAsProxy(), "FileName")
+        .Set("data_{timestep:06d}.vtp");
+
+      auto reference = Extract(pxm, sphere, root + "/sync", false);
+      auto summary = Extract(pxm, sphere, root + "/async", true);
+      success &= Check(reference && summary, "Failed to generate extracts.");
+      success = success && CompareSummaries(summary, reference, root + "/async");
+    }
+
+    controller->UnRegisterProxy(sphere);
+    controller->UnRegisterProxy(view);
+    vtkProcessModule::GetProcessModule()->UnRegisterSession(session);
+  }
+
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -7,6 +7,7 @@
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderer.h"
+#include "vtkPVSharedMemoryChannel.h"
 #include "vtkSquirtCompressor.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
@@ -51,14 +52,15 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
     if (this->Compressor)
     {
       vtkUnsignedCharArray* data = vtkUnsignedCharArray::New();
-      this->ParallelController->Receive(data, 1, 0x023430);
+      vtkPVSharedMemoryChannel::Receive(this->ParallelController, data, 1, 0x023430);
       this->Compressor->SetImageResolution(header[1], header[2]);
       this->Decompress(data, rawImage.GetRawPtr());
       data->Delete();
     }
     else
     {
-      this->ParallelController->Receive(rawImage.GetRawPtr(), 1, 0x023430);
+      vtkPVSharedMemoryChannel::Receive(
+        this->ParallelController, rawImage.GetRawPtr(), 1, 0x023430);
     }
     rawImage.MarkValid();
   }
@@ -86,11 +88,12 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
     if (this->Compressor)
     {
       this->Compressor->SetImageResolution(header[1], header[2]);
-      this->ParallelController->Send(this->Compress(rawImage.GetRawPtr()), 1, 0x023430);
+      vtkPVSharedMemoryChannel::Send(
+        this->ParallelController, this->Compress(rawImage.GetRawPtr()), 1, 0x023430);
     }
     else
     {
-      this->ParallelController->Send(rawImage.GetRawPtr(), 1, 0x023430);
+      vtkPVSharedMemoryChannel::Send(this->ParallelController, rawImage.GetRawPtr(), 1, 0x023430);
     }
   }
 }
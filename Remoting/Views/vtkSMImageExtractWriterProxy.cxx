@@ -3,9 +3,13 @@
 #include "vtkSMImageExtractWriterProxy.h"
 
 #include "vtkCamera.h"
+#include "vtkErrorCode.h"
+#include "vtkImageData.h"
+#include "vtkImageWriter.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVSession.h"
 #include "vtkPVStringFormatter.h"
+#include "vtkRenderWindow.h"
 #include "vtkSMContextViewProxy.h"
 #include "vtkSMExtractsController.h"
 #include "vtkSMPropertyHelper.h"
@@ -289,6 +293,33 @@ bool vtkSMImageExtractWriterProxy::WriteImage(
   auto convertedName =
     this->GenerateExtractsFileName(fname, extractor->GetRealExtractsOutputDirectory());
 
+  if (extractor->CanExtractAsynchronously() &&
+    vtkSMPropertyHelper(writer, "StereoMode").GetAsInt() != VTK_STEREO_EMULATE)
+  {
+    // Render and capture on this thread, encode and write on a worker thread
+    // using a format proxy of its own.
+    auto format = writer->NewFormatProxy(convertedName);
+    auto imageWriter =
+      format ? vtkImageWriter::SafeDownCast(format->GetClientSideObject()) : nullptr;
+    if (imageWriter)
+    {
+      auto image = writer->CaptureImage();
+      if (!image)
+      {
+        return false;
+      }
+      imageWriter->SetInputData(image);
+      return extractor->EnqueueExtract(
+        this, convertedName,
+        [imageWriter]() {
+          imageWriter->Write();
+          return imageWriter->GetErrorCode() == vtkErrorCode::NoError;
+        },
+        // release the format proxy on this thread once written.
+        [format](bool) {}, cameraParams);
+    }
+  }
+
   const bool status = writer->WriteImage(convertedName.c_str(), vtkPVSession::DATA_SERVER_ROOT);
   if (status)
   {
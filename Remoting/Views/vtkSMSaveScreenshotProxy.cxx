@@ -32,6 +32,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <set>
 #include <sstream>
 #include <vtksys/SystemTools.hxx>
@@ -65,6 +66,19 @@ bool SymmetricReturnCode(const bool& ref)
   return SymmetricReturnCode<int>(val) != 0;
 }
 
+// embeds the paraview state as metadata, only supported for PNG files.
+static void EmbedState(vtkSMProxy* format, vtkPVXMLElement* stateXMLRoot)
+{
+  if (stateXMLRoot && strcmp(format->GetXMLName(), "PNG") == 0)
+  {
+    std::ostringstream stream;
+    stateXMLRoot->PrintXML(stream, vtkIndent());
+    vtkSMPropertyHelper metadata(format, "MetaData");
+    metadata.Set(0, "ParaViewState");
+    metadata.Set(1, stream.str().c_str());
+  }
+}
+
 //============================================================================
 /**
  * vtkSMSaveScreenshotProxy::vtkState helps save and then restore state for view
@@ -560,21 +574,7 @@ bool vtkSMSaveScreenshotProxy::WriteImage(
     return false;
   }
 
-  // Some experimental code to add the ability to capture floating point buffers
-  // instead of RGB(A) images.
-  if (this->UseFloatingPointBuffers)
-  {
-    if (view == nullptr)
-    {
-      vtkErrorMacro("UseFloatingPointBuffers is only supported when using a single view.");
-    }
-    else
-    {
-      auto state = dynamic_cast<vtkStateView*>(this->State);
-      assert(state != nullptr);
-      state->SetUseFloatingPointBuffers(true);
-    }
-  }
+  this->PrepareFloatingPointBuffers();
 
   auto image_pair = this->CapturePreppedImages();
   this->Cleanup();
@@ -599,15 +599,7 @@ bool vtkSMSaveScreenshotProxy::WriteImage(
   auto remoteWriterAlgorithm = vtkAlgorithm::SafeDownCast(remoteWriter->GetClientSideObject());
 
   // save paraview state as metadata
-  const bool embedState = stateXMLRoot && strcmp(format->GetXMLName(), "PNG") == 0;
-  if (embedState)
-  {
-    std::ostringstream stream;
-    stateXMLRoot->PrintXML(stream, vtkIndent());
-    vtkSMPropertyHelper metadata(format, "MetaData");
-    metadata.Set(0, "ParaViewState");
-    metadata.Set(1, stream.str().c_str());
-  }
+  EmbedState(format, stateXMLRoot);
 
   if (image_pair.second)
   {
@@ -658,12 +650,58 @@ vtkSmartPointer<vtkImageData> vtkSMSaveScreenshotProxy::CaptureImage()
   }
 
   assert(this->State != nullptr);
+  this->PrepareFloatingPointBuffers();
   vtkSmartPointer<vtkImageData> img = this->CapturePreppedImages().first;
 
   this->Cleanup();
   return img;
 }
 
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkSMProxy> vtkSMSaveScreenshotProxy::NewFormatProxy(
+  const std::string& filename, vtkPVXMLElement* stateXMLRoot)
+{
+  auto format = this->GetFormatProxy(filename);
+  if (!format)
+  {
+    vtkErrorMacro("Failed to determine format for '" << filename.c_str() << "'");
+    return nullptr;
+  }
+
+  auto pxm = this->GetSessionProxyManager();
+  auto proxy =
+    vtkSmartPointer<vtkSMProxy>::Take(pxm->NewProxy(format->GetXMLGroup(), format->GetXMLName()));
+  if (!proxy)
+  {
+    return nullptr;
+  }
+  proxy->Copy(format);
+  vtkSMPropertyHelper(proxy, "FileName").Set(filename.c_str());
+  EmbedState(proxy, stateXMLRoot);
+  proxy->UpdateVTKObjects();
+  return proxy;
+}
+
+//----------------------------------------------------------------------------
+void vtkSMSaveScreenshotProxy::PrepareFloatingPointBuffers()
+{
+  // Some experimental code to add the ability to capture floating point buffers
+  // instead of RGB(A) images.
+  if (this->UseFloatingPointBuffers)
+  {
+    if (this->GetView() == nullptr)
+    {
+      vtkErrorMacro("UseFloatingPointBuffers is only supported when using a single view.");
+    }
+    else
+    {
+      auto state = dynamic_cast<vtkStateView*>(this->State);
+      assert(state != nullptr);
+      state->SetUseFloatingPointBuffers(true);
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 std::pair<vtkSmartPointer<vtkImageData>, vtkSmartPointer<vtkImageData>>
 vtkSMSaveScreenshotProxy::CapturePreppedImages()
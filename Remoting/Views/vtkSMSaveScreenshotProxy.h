@@ -49,10 +49,23 @@ public:
     vtkPVXMLElement* stateXMLRoot = nullptr);
 
   /**
-   * Capture the rendered image but doesn't save it out to any file.
+   * Capture the rendered image but doesn't save it out to any file. As with
+   * `WriteImage`, the image holds floating point values when
+   * UseFloatingPointBuffers is set.
    */
   vtkSmartPointer<vtkImageData> CaptureImage();
 
+  /**
+   * Creates a new format proxy, with the same property values as the format
+   * proxy `WriteImage` would use for `filename`, set up to write to `filename`.
+   * Combined with `CaptureImage`, this makes it possible to write the image
+   * later, or on another thread, while this proxy is used for more images.
+   * As with `WriteImage`, `stateXMLRoot` is embedded in PNG files.
+   * Returns nullptr if the format cannot be determined.
+   */
+  vtkSmartPointer<vtkSMProxy> NewFormatProxy(
+    const std::string& filename, vtkPVXMLElement* stateXMLRoot = nullptr);
+
   /**
    * Updates default property values for saving the given file.
    */
@@ -160,6 +173,12 @@ private:
   class vtkStateLayout;
   vtkState* State;
   bool UseFloatingPointBuffers;
+
+  /**
+   * Sets the view state up to capture floating point buffers when
+   * UseFloatingPointBuffers is set. Must be called after `Prepare`.
+   */
+  void PrepareFloatingPointBuffers();
 };
 
 #endif
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVPipelineScheduler.h"
+
+#include "vtkCallbackCommand.h"
+#include "vtkCleanPolyData.h"
+#include "vtkCommand.h"
+#include "vtkConeSource.h"
+#include "vtkElevationFilter.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+/**
+ * Stands for a Python-backed algorithm: records the thread it executes on.
+ */
+class vtkPythonTestSource : public vtkSphereSource
+{
+public:
+  static vtkPythonTestSource* New();
+  vtkTypeMacro(vtkPythonTestSource, vtkSphereSource);
+
+  std::thread::id ExecutionThread;
+
+protected:
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override
+  {
+    this->ExecutionThread = std::this_thread::get_id();
+    return this->Superclass::RequestData(request, inputVector, outputVector);
+  }
+};
+vtkStandardNewMacro(vtkPythonTestSource);
+
+void CountExecution(vtkObject*, unsigned long, void* clientdata, void*)
+{
+  ++(*reinterpret_cast<std::atomic<int>*>(clientdata));
+}
+
+bool Test(bool concurrent)
+{
+  vtkPVPipelineScheduler::SetEnableConcurrentUpdates(concurrent);
+
+  // two independent sources, and a source shared by two filters.
+  vtkNew<vtkSphereSource> sphere1;
+  sphere1->SetThetaResolution(64);
+  vtkNew<vtkSphereSource> sphere2;
+  sphere2->SetPhiResolution(64);
+  vtkNew<vtkConeSource> cone;
+  cone->SetResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetInputConnection(cone->GetOutputPort());
+  vtkNew<vtkCleanPolyData> clean;
+  clean->SetInputConnection(cone->GetOutputPort());
+  vtkNew<vtkPythonTestSource> python;
+  vtkNew<vtkElevationFilter> pythonElevation;
+  pythonElevation->SetInputConnection(python->GetOutputPort());
+
+  std::atomic<int> coneExecutions{ 0 };
+  vtkNew<vtkCallbackCommand> observer;
+  observer->SetCallback(::CountExecution);
+  observer->SetClientData(&coneExecutions);
+  cone->AddObserver(vtkCommand::EndEvent, observer);
+
+  vtkNew<vtkPVPipelineScheduler> scheduler;
+  scheduler->AddOutputPort(sphere1->GetOutputPort());
+  scheduler->AddOutputPort(elevation->GetOutputPort());
+  scheduler->AddOutputPort(sphere2->GetOutputPort());
+  scheduler->AddOutputPort(clean->GetOutputPort());
+  scheduler->AddOutputPort(pythonElevation->GetOutputPort());
+  scheduler->AddOutputPort(nullptr);
+  vtkLogIf(ERROR, scheduler->GetNumberOfOutputPorts() != 5, "Wrong number of output ports.");
+
+  if (!scheduler->Update())
+  {
+    vtkLog(ERROR, "Update failed.");
+    return false;
+  }
+  if (scheduler->GetNumberOfBranches() != 4)
+  {
+    vtkLog(ERROR, "Expected 4 branches, got " << scheduler->GetNumberOfBranches() << ".");
+    return false;
+  }
+  if (python->ExecutionThread != std::this_thread::get_id())
+  {
+    vtkLog(ERROR, "Python-backed source did not execute on the calling thread.");
+    return false;
+  }
+  if (coneExecutions != 1)
+  {
+    vtkLog(ERROR, "Shared source executed " << coneExecutions << " times instead of once.");
+    return false;
+  }
+  if (sphere1->GetOutput()->GetNumberOfPoints() == 0 ||
+    sphere2->GetOutput()->GetNumberOfPoints() == 0 ||
+    vtkPolyData::SafeDownCast(elevation->GetOutputDataObject(0))->GetNumberOfPoints() == 0 ||
+    clean->GetOutput()->GetNumberOfPoints() == 0)
+  {
+    vtkLog(ERROR, "Empty outputs.");
+    return false;
+  }
+
+  // nothing changed: nothing should execute again.
+  scheduler->Update();
+  if (coneExecutions != 1)
+  {
+    vtkLog(ERROR, "Shared source executed again.");
+    return false;
+  }
+
+  scheduler->RemoveAllOutputPorts();
+  vtkLogIf(ERROR, scheduler->GetNumberOfOutputPorts() != 0, "Output ports were not removed.");
+  return true;
+}
+}
+
+int TestPipelineScheduler(int, char*[])
+{
+  const bool success = ::Test(false) && ::Test(true);
+  vtkPVPipelineScheduler::SetEnableConcurrentUpdates(false);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
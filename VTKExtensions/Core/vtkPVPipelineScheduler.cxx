@@ -0,0 +1,272 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkPVPipelineScheduler.h"
+
+#include "vtkAlgorithm.h"
+#include "vtkAlgorithmOutput.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVLogger.h"
+#include "vtkProgressObserver.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <numeric>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+std::atomic<bool> EnableConcurrentUpdates{ false };
+
+// Adds `algorithm` and all the algorithms upstream of it to `upstream`.
+void CollectUpstream(vtkAlgorithm* algorithm, std::set<vtkAlgorithm*>& upstream)
+{
+  std::vector<vtkAlgorithm*> stack{ algorithm };
+  while (!stack.empty())
+  {
+    vtkAlgorithm* current = stack.back();
+    stack.pop_back();
+    if (!current || !upstream.insert(current).second)
+    {
+      continue;
+    }
+    for (int port = 0; port < current->GetNumberOfInputPorts(); ++port)
+    {
+      for (int cc = 0; cc < current->GetNumberOfInputConnections(port); ++cc)
+      {
+        vtkAlgorithmOutput* input = current->GetInputConnection(port, cc);
+        stack.push_back(input ? input->GetProducer() : nullptr);
+      }
+    }
+  }
+}
+
+// Python-backed algorithms (vtkPythonAlgorithm, vtkPythonProgrammableFilter,
+// vtkPythonCalculator, ...) need the Python global interpreter lock, which the
+// calling thread may hold, e.g. in pvpython with a builtin session.
+bool IsBoundToCallingThread(vtkAlgorithm* algorithm)
+{
+  return strncmp(algorithm->GetClassName(), "vtkPython", 9) == 0 ||
+    algorithm->IsA("vtkPythonAlgorithm");
+}
+
+bool UpdateOutputPort(vtkAlgorithmOutput* port)
+{
+  vtkAlgorithm* algorithm = port->GetProducer();
+  if (auto sddp = vtkStreamingDemandDrivenPipeline::SafeDownCast(algorithm->GetExecutive()))
+  {
+    return sddp->Update(port->GetIndex()) != 0;
+  }
+  algorithm->Update(port->GetIndex());
+  return true;
+}
+}
+
+class vtkPVPipelineScheduler::vtkInternals
+{
+public:
+  std::vector<vtkSmartPointer<vtkAlgorithmOutput>> OutputPorts;
+
+  // A branch: output ports sharing upstream algorithms, and these algorithms.
+  struct Branch
+  {
+    std::vector<vtkAlgorithmOutput*> OutputPorts;
+    std::set<vtkAlgorithm*> Algorithms;
+    // whether the branch must be updated on the calling thread.
+    bool CallingThread = false;
+  };
+
+  std::vector<Branch> BuildBranches() const
+  {
+    const size_t count = this->OutputPorts.size();
+    std::vector<std::set<vtkAlgorithm*>> upstream(count);
+    std::vector<size_t> parent(count);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto find = [&parent](size_t idx) {
+      while (parent[idx] != idx)
+      {
+        idx = parent[idx] = parent[parent[idx]];
+      }
+      return idx;
+    };
+
+    // output ports sharing an algorithm are in the same branch.
+    std::map<vtkAlgorithm*, size_t> owners;
+    for (size_t cc = 0; cc < count; ++cc)
+    {
+      ::CollectUpstream(this->OutputPorts[cc]->GetProducer(), upstream[cc]);
+      for (vtkAlgorithm* algorithm : upstream[cc])
+      {
+        auto iter = owners.emplace(algorithm, cc).first;
+        parent[find(cc)] = find(iter->second);
+      }
+    }
+
+    std::vector<Branch> branches;
+    std::map<size_t, size_t> branchIndex;
+    for (size_t cc = 0; cc < count; ++cc)
+    {
+      auto iter = branchIndex.emplace(find(cc), branches.size()).first;
+      if (iter->second == branches.size())
+      {
+        branches.emplace_back();
+      }
+      Branch& branch = branches[iter->second];
+      branch.OutputPorts.push_back(this->OutputPorts[cc]);
+      branch.Algorithms.insert(upstream[cc].begin(), upstream[cc].end());
+    }
+    for (auto& branch : branches)
+    {
+      branch.CallingThread = std::any_of(
+        branch.Algorithms.begin(), branch.Algorithms.end(), ::IsBoundToCallingThread);
+    }
+    return branches;
+  }
+};
+
+vtkStandardNewMacro(vtkPVPipelineScheduler);
+//----------------------------------------------------------------------------
+vtkPVPipelineScheduler::vtkPVPipelineScheduler()
+  : Internals(new vtkPVPipelineScheduler::vtkInternals())
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVPipelineScheduler::~vtkPVPipelineScheduler() = default;
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineScheduler::SetEnableConcurrentUpdates(bool enable)
+{
+  ::EnableConcurrentUpdates = enable;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineScheduler::GetEnableConcurrentUpdates()
+{
+  return ::EnableConcurrentUpdates;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineScheduler::AddOutputPort(vtkAlgorithmOutput* port)
+{
+  if (port && port->GetProducer())
+  {
+    this->Internals->OutputPorts.emplace_back(port);
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineScheduler::RemoveAllOutputPorts()
+{
+  if (!this->Internals->OutputPorts.empty())
+  {
+    this->Internals->OutputPorts.clear();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkPVPipelineScheduler::GetNumberOfOutputPorts() const
+{
+  return static_cast<int>(this->Internals->OutputPorts.size());
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVPipelineScheduler::Update()
+{
+  const auto branches = this->Internals->BuildBranches();
+  this->NumberOfBranches = static_cast<int>(branches.size());
+
+  auto controller = vtkMultiProcessController::GetGlobalController();
+  const bool concurrent = ::EnableConcurrentUpdates && branches.size() > 1 &&
+    (!controller || controller->GetNumberOfProcesses() <= 1);
+
+  vtkVLogScopeF(PARAVIEW_LOG_PIPELINE_VERBOSITY(), "update %d output ports in %d branches%s",
+    this->GetNumberOfOutputPorts(), this->NumberOfBranches, (concurrent ? " concurrently" : ""));
+
+  std::vector<char> status(branches.size(), 1);
+  auto updateBranch = [&](size_t cc) {
+    for (vtkAlgorithmOutput* port : branches[cc].OutputPorts)
+    {
+      status[cc] = ::UpdateOutputPort(port) && status[cc];
+    }
+  };
+
+  if (!concurrent)
+  {
+    for (size_t cc = 0; cc < branches.size(); ++cc)
+    {
+      updateBranch(cc);
+    }
+  }
+  else
+  {
+    // branches bound to the calling thread are updated on it, the others
+    // concurrently.
+    std::vector<size_t> concurrentBranches;
+    for (size_t cc = 0; cc < branches.size(); ++cc)
+    {
+      if (!branches[cc].CallingThread)
+      {
+        concurrentBranches.push_back(cc);
+      }
+    }
+
+    // progress events would be fired from the worker threads: redirect them
+    // to an observer per branch, which nobody observes.
+    std::vector<std::pair<vtkAlgorithm*, vtkSmartPointer<vtkProgressObserver>>> observers;
+    for (size_t cc : concurrentBranches)
+    {
+      vtkNew<vtkProgressObserver> observer;
+      for (vtkAlgorithm* algorithm : branches[cc].Algorithms)
+      {
+        observers.emplace_back(algorithm, algorithm->GetProgressObserver());
+        algorithm->SetProgressObserver(observer);
+      }
+    }
+
+    vtkSMPTools::Config config;
+    config.NestedParallelism = true;
+    vtkSMPTools::LocalScope(config, [&]() {
+      vtkSMPTools::For(0, static_cast<vtkIdType>(concurrentBranches.size()), 1,
+        [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType cc = begin; cc < end; ++cc)
+          {
+            updateBranch(concurrentBranches[cc]);
+          }
+        });
+    });
+
+    for (const auto& item : observers)
+    {
+      item.first->SetProgressObserver(item.second);
+    }
+
+    for (size_t cc = 0; cc < branches.size(); ++cc)
+    {
+      if (branches[cc].CallingThread)
+      {
+        updateBranch(cc);
+      }
+    }
+  }
+
+  return std::find(status.begin(), status.end(), 0) == status.end();
+}
+
+//----------------------------------------------------------------------------
+void vtkPVPipelineScheduler::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfOutputPorts: " << this->GetNumberOfOutputPorts() << endl;
+  os << indent << "NumberOfBranches: " << this->NumberOfBranches << endl;
+}
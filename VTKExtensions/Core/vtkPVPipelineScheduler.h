@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkPVPipelineScheduler
+ * @brief   updates several pipeline outputs, running independent branches
+ * concurrently.
+ *
+ * vtkPVPipelineScheduler updates a set of output ports, for example all the
+ * sinks of a pipeline. The output ports are grouped in branches: two output
+ * ports belong to the same branch when they share an upstream algorithm.
+ * Output ports of a branch are updated one after the other, so the outputs of
+ * the upstream algorithms they share are computed once and the executives of
+ * these algorithms are never used by two threads at a time. When concurrent
+ * updates are enabled, branches are updated concurrently using vtkSMPTools;
+ * nested parallelism is enabled, so that the vtkSMPTools loops of the filters
+ * share the same threads instead of oversubscribing the cores.
+ *
+ * Concurrent updates are only used when the process is not part of a
+ * parallel job: filters may use collective communication, which must be
+ * issued in the same order on all the ranks. While a branch is updated
+ * concurrently, the progress of its algorithms is not reported. Branches with
+ * Python-backed algorithms (vtkPythonAlgorithm and the classes whose name
+ * starts with vtkPython) are always updated on the calling thread, which may
+ * hold the Python global interpreter lock.
+ *
+ * The update request (piece, time, etc.) of each output port must be set on
+ * its output information before calling Update().
+ */
+
+#ifndef vtkPVPipelineScheduler_h
+#define vtkPVPipelineScheduler_h
+
+#include "vtkObject.h"
+#include "vtkPVVTKExtensionsCoreModule.h" // needed for export macro
+
+#include <memory> // for std::unique_ptr
+
+class vtkAlgorithmOutput;
+
+class VTKPVVTKEXTENSIONSCORE_EXPORT vtkPVPipelineScheduler : public vtkObject
+{
+public:
+  static vtkPVPipelineScheduler* New();
+  vtkTypeMacro(vtkPVPipelineScheduler, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Add/remove the output ports to update.
+   */
+  void AddOutputPort(vtkAlgorithmOutput* port);
+  void RemoveAllOutputPorts();
+  int GetNumberOfOutputPorts() const;
+  ///@}
+
+  /**
+   * Updates all the output ports. Returns true if all the updates succeeded.
+   */
+  bool Update();
+
+  /**
+   * Returns the number of independent branches the output ports were grouped
+   * in during the last call to Update().
+   */
+  vtkGetMacro(NumberOfBranches, int);
+
+  ///@{
+  /**
+   * Enable/disable the concurrent update of independent branches in this
+   * process. Disabled by default.
+   */
+  static void SetEnableConcurrentUpdates(bool enable);
+  static bool GetEnableConcurrentUpdates();
+  ///@}
+
+protected:
+  vtkPVPipelineScheduler();
+  ~vtkPVPipelineScheduler() override;
+
+  int NumberOfBranches = 0;
+
+private:
+  vtkPVPipelineScheduler(const vtkPVPipelineScheduler&) = delete;
+  void operator=(const vtkPVPipelineScheduler&) = delete;
+
+  class vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+#endif
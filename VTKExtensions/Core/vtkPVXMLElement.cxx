@@ -9,8 +9,11 @@
 vtkStandardNewMacro(vtkPVXMLElement);
 
 #include <cctype>
+#include <cstddef>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 #if defined(_WIN32) && !defined(__CYGWIN__)
 #define SNPRINTF _snprintf
@@ -27,6 +30,59 @@ struct vtkPVXMLElementInternals
   std::string CharacterData;
 };
 
+namespace
+{
+// null strings are stored with this length.
+constexpr vtkTypeUInt32 vtkNullStringLength = 0xffffffff;
+
+void vtkAppendUInt32(std::string& buffer, vtkTypeUInt32 value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void vtkAppendString(std::string& buffer, const char* str, size_t length)
+{
+  vtkAppendUInt32(buffer, str ? static_cast<vtkTypeUInt32>(length) : vtkNullStringLength);
+  if (str)
+  {
+    buffer.append(str, length);
+  }
+}
+
+bool vtkReadUInt32(const char*& data, const char* end, vtkTypeUInt32& value)
+{
+  if (end - data < static_cast<std::ptrdiff_t>(sizeof(value)))
+  {
+    return false;
+  }
+  std::memcpy(&value, data, sizeof(value));
+  data += sizeof(value);
+  return true;
+}
+
+bool vtkReadString(const char*& data, const char* end, std::string& str, bool& isNull)
+{
+  vtkTypeUInt32 length;
+  if (!vtkReadUInt32(data, end, length))
+  {
+    return false;
+  }
+  isNull = (length == vtkNullStringLength);
+  if (isNull)
+  {
+    str.clear();
+    return true;
+  }
+  if (end - data < static_cast<std::ptrdiff_t>(length))
+  {
+    return false;
+  }
+  str.assign(data, length);
+  data += length;
+  return true;
+}
+}
+
 // Function to check if a string is full of whitespace characters.
 static bool vtkIsSpace(const std::string& str)
 {
@@ -254,6 +310,28 @@ const char* vtkPVXMLElement::GetAttributeOrDefault(const char* name, const char*
   }
   return notFound;
 }
+//----------------------------------------------------------------------------
+unsigned int vtkPVXMLElement::GetNumberOfAttributes()
+{
+  return static_cast<unsigned int>(this->Internal->AttributeNames.size());
+}
+
+//----------------------------------------------------------------------------
+const char* vtkPVXMLElement::GetAttributeName(unsigned int index)
+{
+  return index < this->Internal->AttributeNames.size()
+    ? this->Internal->AttributeNames[index].c_str()
+    : nullptr;
+}
+
+//----------------------------------------------------------------------------
+const char* vtkPVXMLElement::GetAttributeValue(unsigned int index)
+{
+  return index < this->Internal->AttributeValues.size()
+    ? this->Internal->AttributeValues[index].c_str()
+    : nullptr;
+}
+
 //----------------------------------------------------------------------------
 const char* vtkPVXMLElement::GetCharacterData()
 {
@@ -774,3 +852,85 @@ void vtkPVXMLElement::RemoveAttribute(const char* name)
 }
 
 //----------------------------------------------------------------------------
+void vtkPVXMLElement::SerializeBinary(std::string& buffer)
+{
+  vtkAppendString(buffer, this->Name, this->Name ? strlen(this->Name) : 0);
+  vtkAppendString(buffer, this->Id, this->Id ? strlen(this->Id) : 0);
+
+  const auto& names = this->Internal->AttributeNames;
+  const auto& values = this->Internal->AttributeValues;
+  vtkAppendUInt32(buffer, static_cast<vtkTypeUInt32>(names.size()));
+  for (size_t cc = 0; cc < names.size(); ++cc)
+  {
+    vtkAppendString(buffer, names[cc].c_str(), names[cc].size());
+    vtkAppendString(buffer, values[cc].c_str(), values[cc].size());
+  }
+
+  const std::string& characterData = this->Internal->CharacterData;
+  vtkAppendString(buffer, characterData.c_str(), characterData.size());
+
+  vtkAppendUInt32(buffer, static_cast<vtkTypeUInt32>(this->Internal->NestedElements.size()));
+  for (auto& nested : this->Internal->NestedElements)
+  {
+    nested->SerializeBinary(buffer);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkPVXMLElement* vtkPVXMLElement::NewFromBinary(const char*& data, const char* end)
+{
+  std::string str;
+  bool isNull;
+  vtkSmartPointer<vtkPVXMLElement> element = vtkSmartPointer<vtkPVXMLElement>::New();
+
+  if (!vtkReadString(data, end, str, isNull))
+  {
+    return nullptr;
+  }
+  element->SetName(isNull ? nullptr : str.c_str());
+  if (!vtkReadString(data, end, str, isNull))
+  {
+    return nullptr;
+  }
+  element->SetId(isNull ? nullptr : str.c_str());
+
+  vtkTypeUInt32 count;
+  if (!vtkReadUInt32(data, end, count))
+  {
+    return nullptr;
+  }
+  for (vtkTypeUInt32 cc = 0; cc < count; ++cc)
+  {
+    std::string value;
+    if (!vtkReadString(data, end, str, isNull) || isNull ||
+      !vtkReadString(data, end, value, isNull) || isNull)
+    {
+      return nullptr;
+    }
+    element->Internal->AttributeNames.push_back(std::move(str));
+    element->Internal->AttributeValues.push_back(std::move(value));
+  }
+
+  if (!vtkReadString(data, end, element->Internal->CharacterData, isNull) || isNull)
+  {
+    return nullptr;
+  }
+
+  if (!vtkReadUInt32(data, end, count))
+  {
+    return nullptr;
+  }
+  for (vtkTypeUInt32 cc = 0; cc < count; ++cc)
+  {
+    vtkSmartPointer<vtkPVXMLElement> nested;
+    nested.TakeReference(vtkPVXMLElement::NewFromBinary(data, end));
+    if (!nested)
+    {
+      return nullptr;
+    }
+    element->AddNestedElement(nested);
+  }
+
+  element->Register(nullptr);
+  return element;
+}
@@ -65,6 +65,16 @@ public:
    */
   const char* GetAttributeOrDefault(const char* name, const char* notFound);
 
+  ///@{
+  /**
+   * Get the number of attributes of the element, and the name and value of the
+   * attribute at the given index. Returns nullptr for an invalid index.
+   */
+  unsigned int GetNumberOfAttributes();
+  const char* GetAttributeName(unsigned int index);
+  const char* GetAttributeValue(unsigned int index);
+  ///@}
+
   /**
    * Get the character data for the element.
    */
@@ -251,6 +261,20 @@ public:
    */
   void CopyAttributesTo(vtkPVXMLElement* other);
 
+  ///@{
+  /**
+   * Compact binary form of the element and all its nested elements, used to
+   * cache parsed XML (see vtkSIProxyDefinitionManager) and for binary states
+   * (see vtkSMBinaryStateUtilities). The form uses the native byte order.
+   * `SerializeBinary` appends to `buffer`. `NewFromBinary` reads the element
+   * starting at `data` and moves `data` past it. It returns nullptr if the
+   * buffer is truncated or corrupted. The caller must Delete() the returned
+   * element.
+   */
+  void SerializeBinary(std::string& buffer);
+  static vtkPVXMLElement* NewFromBinary(const char*& data, const char* end);
+  ///@}
+
 protected:
   vtkPVXMLElement();
   ~vtkPVXMLElement() override;
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * Connects two vtkTCPNetworkAccessManager in the same process and checks the
+ * shared-memory channel negotiated on the connection: data objects moved by
+ * vtkClientServerMoveData and images sent as vtkPVClientServerSynchronizedRenderers
+ * does must arrive intact, with the channel and, once it is disabled, with the
+ * socket alone.
+ */
+
+#include "vtkCellArray.h"
+#include "vtkClientServerMoveData.h"
+#include "vtkFloatArray.h"
+#include "vtkMultiProcessController.h"
+#include "vtkNew.h"
+#include "vtkPVSharedMemoryChannel.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTCPNetworkAccessManager.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <vtksys/SystemInformation.hxx>
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+constexpr vtkIdType NumberOfPoints = 500000;
+// tag used by vtkPVClientServerSynchronizedRenderers for images.
+constexpr int ImageTag = 0x023430;
+
+vtkSmartPointer<vtkPolyData> NewPolyData()
+{
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(NumberOfPoints);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(NumberOfPoints);
+  vtkNew<vtkCellArray> vertices;
+  for (vtkIdType cc = 0; cc < NumberOfPoints; ++cc)
+  {
+    points->SetPoint(cc, cc, 2.0 * cc, 3.0 * cc);
+    scalars->SetValue(cc, static_cast<float>(cc % 1000));
+    vertices->InsertNextCell(1, &cc);
+  }
+  auto polyData = vtkSmartPointer<vtkPolyData>::New();
+  polyData->SetPoints(points);
+  polyData->SetVerts(vertices);
+  polyData->GetPointData()->SetScalars(scalars);
+  return polyData;
+}
+
+vtkSmartPointer<vtkUnsignedCharArray> NewImage()
+{
+  auto image = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  image->SetNumberOfComponents(4);
+  image->SetNumberOfTuples(1920 * 1080);
+  for (vtkIdType cc = 0, max = image->GetNumberOfValues(); cc < max; ++cc)
+  {
+    image->SetValue(cc, static_cast<unsigned char>(cc % 251));
+  }
+  return image;
+}
+
+bool Check(bool condition, const char* message)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << message << std::endl;
+  }
+  return condition;
+}
+
+/**
+ * Moves a data object and an image from the accepting end of a new
+ * connection, as a server does, to the connecting end, run on another thread
+ * as a client would.
+ */
+bool TestConnection(int port, bool enabled)
+{
+  vtkPVSharedMemoryChannel::SetEnabled(enabled);
+  const bool expectChannel = enabled && vtkPVSharedMemoryChannel::IsSupported();
+
+  auto polyData = NewPolyData();
+  auto image = NewImage();
+
+  vtkNew<vtkTCPNetworkAccessManager> serverManager;
+  serverManager->DisableFurtherConnections(port, false);
+
+  bool clientAttached = false;
+  vtkNew<vtkPolyData> receivedPolyData;
+  vtkNew<vtkUnsignedCharArray> receivedImage;
+  bool clientReceived = false;
+  std::thread clientThread([&]() {
+    vtkNew<vtkTCPNetworkAccessManager> clientManager;
+    std::ostringstream url;
+    url << "tcp://localhost:" << port << "?timeout=10";
+    vtkSmartPointer<vtkMultiProcessController> client;
+    client.TakeReference(clientManager->NewConnection(url.str().c_str()));
+    if (!client)
+    {
+      return;
+    }
+    clientAttached = vtkPVSharedMemoryChannel::GetChannel(client) != nullptr;
+
+    vtkNew<vtkClientServerMoveData> moveData;
+    moveData->SetProcessType(vtkClientServerMoveData::CLIENT);
+    moveData->SetOutputDataType(VTK_POLY_DATA);
+    moveData->SetController(client);
+    moveData->Update();
+    receivedPolyData->ShallowCopy(moveData->GetOutputDataObject(0));
+
+    receivedImage->SetNumberOfComponents(4);
+    clientReceived = vtkPVSharedMemoryChannel::Receive(client, receivedImage, 1, ImageTag) != 0;
+  });
+
+  std::ostringstream url;
+  url << "tcp://localhost:" << port << "?listen=true";
+  vtkSmartPointer<vtkMultiProcessController> server;
+  server.TakeReference(serverManager->NewConnection(url.str().c_str()));
+  bool success = Check(server != nullptr, "Failed to accept the connection.");
+  if (server)
+  {
+    success &= Check((vtkPVSharedMemoryChannel::GetChannel(server) != nullptr) == expectChannel,
+      "Unexpected shared-memory channel on the accepting end.");
+
+    vtkNew<vtkClientServerMoveData> moveData;
+    moveData->SetProcessType(vtkClientServerMoveData::SERVER);
+    moveData->SetInputData(polyData);
+    moveData->SetController(server);
+    moveData->Update();
+    success &= Check(vtkPVSharedMemoryChannel::Send(server, image, 1, ImageTag) != 0,
+      "Failed to send the image.");
+  }
+  clientThread.join();
+
+  success &= Check(clientAttached == expectChannel,
+    "Unexpected shared-memory channel on the connecting end.");
+  success &= Check(receivedPolyData->GetNumberOfPoints() == NumberOfPoints &&
+      receivedPolyData->GetNumberOfVerts() == NumberOfPoints,
+    "The data object was not moved.");
+  if (receivedPolyData->GetNumberOfPoints() == NumberOfPoints)
+  {
+    auto scalars = vtkFloatArray::SafeDownCast(receivedPolyData->GetPointData()->GetScalars());
+    double point[3];
+    receivedPolyData->GetPoint(NumberOfPoints - 1, point);
+    success &= Check(scalars && scalars->GetValue(NumberOfPoints - 1) ==
+          static_cast<float>((NumberOfPoints - 1) % 1000) &&
+        point[2] == 3.0 * (NumberOfPoints - 1),
+      "The moved data object differs from the original one.");
+  }
+
+  bool sameImage = clientReceived &&
+    receivedImage->GetNumberOfValues() == image->GetNumberOfValues();
+  for (vtkIdType cc = 0, max = image->GetNumberOfValues(); sameImage && cc < max; ++cc)
+  {
+    sameImage = receivedImage->GetValue(cc) == image->GetValue(cc);
+  }
+  success &= Check(sameImage, "The received image differs from the sent one.");
+  return success;
+}
+}
+
+int TestClientServerMoveDataSharedMemory(int, char*[])
+{
+  const bool enabled = vtkPVSharedMemoryChannel::GetEnabled();
+  const int port = 23456 + 2 * static_cast<int>(vtksys::SystemInformation::GetProcessId() % 500);
+
+  bool success = TestConnection(port, true);
+  // the connection falls back to the socket when the channel is disabled.
+  success &= TestConnection(port + 1, false);
+
+  vtkPVSharedMemoryChannel::SetEnabled(enabled);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -14,6 +14,7 @@
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVSession.h"
+#include "vtkPVSharedMemoryChannel.h"
 #include "vtkPolyData.h"
 #include "vtkProcessModule.h"
 #include "vtkSelection.h"
@@ -227,7 +228,8 @@ int vtkClientServerMoveData::SendData(vtkDataObject* input, vtkMultiProcessContr
     }
   }
 
-  return controller->Send(input, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+  return vtkPVSharedMemoryChannel::Send(
+    controller, input, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
 }
 
 //-----------------------------------------------------------------------------
@@ -256,7 +258,14 @@ vtkDataObject* vtkClientServerMoveData::ReceiveData(vtkMultiProcessController* c
   }
   else
   {
-    data = controller->ReceiveDataObject(1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    auto received = vtkPVSharedMemoryChannel::ReceiveDataObject(
+      controller, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    data = received;
+    if (data)
+    {
+      // the caller releases the returned data object.
+      data->Register(nullptr);
+    }
   }
   return data;
 }
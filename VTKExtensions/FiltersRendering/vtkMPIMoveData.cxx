@@ -21,6 +21,7 @@
 #include "vtkOutlineFilter.h"
 #include "vtkPVLogger.h"
 #include "vtkPVSession.h"
+#include "vtkPVSharedMemoryChannel.h"
 #include "vtkPointData.h"
 #include "vtkProcessModule.h"
 #include "vtkSmartPointer.h"
@@ -819,7 +820,8 @@ void vtkMPIMoveData::DataServerSendToClient(vtkDataObject* output)
     this->ClientDataServerSocketController->Send(&(this->NumberOfBuffers), 1, 1, 23490);
     this->ClientDataServerSocketController->Send(
       this->BufferLengths, this->NumberOfBuffers, 1, 23491);
-    this->ClientDataServerSocketController->Send(this->Buffers, this->BufferTotalLength, 1, 23492);
+    vtkPVSharedMemoryChannel::Send(this->ClientDataServerSocketController, this->Buffers,
+      this->BufferTotalLength, 1, 23492);
     this->ClearBuffer();
     vtkTimerLog::MarkEndEvent("Dataserver sending to client");
   }
@@ -851,7 +853,8 @@ void vtkMPIMoveData::ClientReceiveFromDataServer(vtkDataObject* output)
     this->BufferTotalLength += this->BufferLengths[idx];
   }
   this->Buffers = new char[this->BufferTotalLength];
-  com->Receive(this->Buffers, this->BufferTotalLength, 1, 23492);
+  vtkPVSharedMemoryChannel::Receive(
+    this->ClientDataServerSocketController, this->Buffers, this->BufferTotalLength, 1, 23492);
   this->ReconstructDataFromBuffer(output);
   this->ClearBuffer();
 }
@@ -1112,6 +1112,7 @@ void vtkCGNSWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FileName " << (this->FileName ? this->FileName : "(none)") << endl;
   os << indent << "UseHDF5 " << (this->UseHDF5 ? "On" : "Off") << endl;
   os << indent << "WriteAllTimeSteps " << (this->WriteAllTimeSteps ? "On" : "Off") << endl;
+  os << indent << "UseParallelIO " << (this->UseParallelIO ? "On" : "Off") << endl;
   os << indent << "NumberOfTimeSteps " << this->NumberOfTimeSteps << endl;
   os << indent << "CurrentTimeIndex " << this->CurrentTimeIndex << endl;
   os << indent << "TimeValues " << (this->TimeValues ? this->TimeValues->GetName() : "(none)")
@@ -1277,6 +1278,50 @@ static bool SuffixValidation(char* fileNameSuffix)
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkCGNSWriter::GetCurrentFileName(std::string& fileName, double& timeStep)
+{
+  fileName = this->FileName ? this->FileName : "";
+  timeStep = 0.0;
+  if (!this->TimeValues || this->CurrentTimeIndex >= this->TimeValues->GetNumberOfValues())
+  {
+    return true;
+  }
+
+  if (this->WriteAllTimeSteps && this->TimeValues->GetNumberOfValues() > 1)
+  {
+    if (!this->FileNameSuffix || !SuffixValidation(this->FileNameSuffix))
+    {
+      vtkErrorMacro("Invalid file suffix:"
+        << (this->FileNameSuffix ? this->FileNameSuffix : "null")
+        << ". Expected valid % format specifiers!");
+      return false;
+    }
+
+    const std::string fileNamePath = vtksys::SystemTools::GetFilenamePath(fileName);
+    const std::string filenameNoExt =
+      vtksys::SystemTools::GetFilenameWithoutLastExtension(fileName);
+    const std::string extension = vtksys::SystemTools::GetFilenameLastExtension(fileName);
+
+    char suffix[100];
+    snprintf(suffix, 100, this->FileNameSuffix, this->CurrentTimeIndex);
+    std::stringstream fileNameWithTimeStep;
+    if (!fileNamePath.empty())
+    {
+      fileNameWithTimeStep << fileNamePath << "/";
+    }
+    fileNameWithTimeStep << filenameNoExt << suffix << extension;
+    fileName = fileNameWithTimeStep.str();
+    timeStep = this->TimeValues->GetValue(this->CurrentTimeIndex);
+  }
+  else if (this->OriginalInput &&
+    this->OriginalInput->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP()))
+  {
+    timeStep = this->OriginalInput->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP());
+  }
+  return true;
+}
+
 //------------------------------------------------------------------------------
 void vtkCGNSWriter::WriteData()
 {
@@ -1287,59 +1332,16 @@ void vtkCGNSWriter::WriteData()
   }
 
   write_info info;
-  std::stringstream fileNameWithTimeStep;
 
   // formattedFileName string must be on outer context
   // such that the c_str() pointer is kept alive
   // while writing with it stored in info.FileName
   std::string formattedFileName;
-  if (this->TimeValues && this->CurrentTimeIndex < this->TimeValues->GetNumberOfValues())
+  if (!this->GetCurrentFileName(formattedFileName, info.TimeStep))
   {
-    if (this->WriteAllTimeSteps && this->TimeValues->GetNumberOfValues() > 1)
-    {
-      const std::string fileNamePath = vtksys::SystemTools::GetFilenamePath(this->FileName);
-      const std::string filenameNoExt =
-        vtksys::SystemTools::GetFilenameWithoutLastExtension(this->FileName);
-      const std::string extension = vtksys::SystemTools::GetFilenameLastExtension(this->FileName);
-      if (this->FileNameSuffix && SuffixValidation(this->FileNameSuffix))
-      {
-        char suffix[100];
-        snprintf(suffix, 100, this->FileNameSuffix, this->CurrentTimeIndex);
-        if (!fileNamePath.empty())
-        {
-          fileNameWithTimeStep << fileNamePath << "/";
-        }
-        fileNameWithTimeStep << filenameNoExt << suffix << extension;
-        formattedFileName = fileNameWithTimeStep.str();
-        info.FileName = formattedFileName.c_str();
-        info.TimeStep = this->TimeValues->GetValue(this->CurrentTimeIndex);
-      }
-      else
-      {
-        vtkErrorMacro(
-          "Invalid file suffix:" << (this->FileNameSuffix ? this->FileNameSuffix : "null")
-                                 << ". Expected valid % format specifiers!");
-        return;
-      }
-    }
-    else
-    {
-      if (this->OriginalInput->GetInformation()->Has(vtkDataObject::DATA_TIME_STEP()))
-      {
-        info.TimeStep = this->OriginalInput->GetInformation()->Get(vtkDataObject::DATA_TIME_STEP());
-      }
-      else
-      {
-        info.TimeStep = 0.0;
-      }
-      info.FileName = this->FileName;
-    }
-  }
-  else
-  {
-    info.FileName = this->FileName;
-    info.TimeStep = 0.0;
+    return;
   }
+  info.FileName = formattedFileName.c_str();
 
   std::string error;
   if (this->OriginalInput->IsA("vtkCompositeDataSet"))
@@ -22,6 +22,8 @@
 #include "vtkPVVTKExtensionsIOCGNSWriterModule.h" // for export macro
 #include "vtkWriter.h"
 
+#include <string> // for std::string
+
 class vtkDoubleArray;
 
 class VTKPVVTKEXTENSIONSIOCGNSWRITER_EXPORT vtkCGNSWriter : public vtkWriter
@@ -76,6 +78,20 @@ public:
   vtkGetMacro(GhostLevel, int);
   ///@}
 
+  ///@{
+  /**
+   * When UseParallelIO is turned ON, the parallel writer (vtkPCGNSWriter)
+   * writes unstructured grids and polydata with collective CGNS/HDF5 I/O
+   * instead of gathering all pieces on the first process. The serial writer
+   * ignores this option, it is present to ensure compatibility with ParaView.
+   *
+   * The Default is OFF.
+   */
+  vtkSetMacro(UseParallelIO, bool);
+  vtkGetMacro(UseParallelIO, bool);
+  vtkBooleanMacro(UseParallelIO, bool);
+  ///@}
+
   ///@{
   /**
    * Provides an option to pad the time step when writing out time series data.
@@ -108,9 +124,16 @@ protected:
 
   void WriteData() override; // pure virtual override from vtkWriter
 
+  /**
+   * Determine the name of the file to write for the current time index and the
+   * time value to store in it. Returns false when the file name suffix is invalid.
+   */
+  bool GetCurrentFileName(std::string& fileName, double& timeStep);
+
   char* FileName = nullptr;
   bool UseHDF5 = true;
   bool WriteAllTimeSteps = false;
+  bool UseParallelIO = false;
   char* FileNameSuffix = nullptr;
 
   int GhostLevel = 0;
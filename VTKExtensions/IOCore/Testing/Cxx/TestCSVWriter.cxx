@@ -19,7 +19,14 @@ namespace
 
 // ensure that the writer works when the columns are not in the same order on all ranks.
 // also ensures partial arrays don't mess things up.
-bool WriteCSV(const std::string& fname, int rank)
+// when `shortest` is true, values are written with the shortest round-trip
+// representation and must be read back exactly.
+double Column1Value(vtkIdType row, bool shortest)
+{
+  return shortest ? (row + 1.5) / 3.0 : row + 1.5;
+}
+
+bool WriteCSV(const std::string& fname, int rank, bool shortest)
 {
   vtkNew<vtkTable> table;
   vtkNew<vtkDoubleArray> col1;
@@ -43,7 +50,7 @@ bool WriteCSV(const std::string& fname, int rank)
   for (int cc = 0; cc < 10; ++cc)
   {
     const auto row = cc + rank * 10;
-    col1->SetValue(cc, row + 1.5);
+    col1->SetValue(cc, Column1Value(row, shortest));
     col2->SetValue(cc, row * 100);
     col3->SetValue(cc, 20);
   }
@@ -65,6 +72,7 @@ bool WriteCSV(const std::string& fname, int rank)
   vtkNew<vtkCSVWriter> writer;
   writer->SetFileName(fname.c_str());
   writer->SetInputDataObject(table);
+  writer->SetUseShortestRoundTrip(shortest);
   writer->Update();
   return true;
 }
@@ -77,7 +85,7 @@ bool WriteCSV(const std::string& fname, int rank)
     return false;                                                                                  \
   }
 
-bool ReadAndVerifyCSV(const std::string& fname, int rank, int numRanks)
+bool ReadAndVerifyCSV(const std::string& fname, int rank, int numRanks, bool shortest)
 {
   if (rank != 0)
   {
@@ -102,7 +110,7 @@ bool ReadAndVerifyCSV(const std::string& fname, int rank, int numRanks)
       auto value1 = table->GetValueByName(row, "Column1");
       auto value2 = table->GetValueByName(row, "Column2");
       auto value3 = table->GetValueByName(row, "Column4-implicit");
-      VERITFY_EQ(value1.ToDouble(), row + 1.5,
+      VERITFY_EQ(value1.ToDouble(), Column1Value(row, shortest),
         std::string("incorrect column1  values at row ") + std::to_string(row));
       VERITFY_EQ(value2.ToInt(), row * 100,
         std::string("incorrect column2  values at row ") + std::to_string(row));
@@ -135,8 +143,10 @@ int TestCSVWriter(int argc, char* argv[])
   }
 
   std::string tname{ testing->GetTempDirectory() };
-  int success = WriteCSV(tname + "/TestCSVWriter.csv", myRank) &&
-      ReadAndVerifyCSV(tname + "/TestCSVWriter.csv", myRank, numRanks)
+  int success = WriteCSV(tname + "/TestCSVWriter.csv", myRank, false) &&
+      ReadAndVerifyCSV(tname + "/TestCSVWriter.csv", myRank, numRanks, false) &&
+      WriteCSV(tname + "/TestCSVWriterShortest.csv", myRank, true) &&
+      ReadAndVerifyCSV(tname + "/TestCSVWriterShortest.csv", myRank, numRanks, true)
     ? 1
     : 0;
 
@@ -9,6 +9,7 @@
 #include "vtkAttributeDataToTableFilter.h"
 #include "vtkCellData.h"
 #include "vtkCharArray.h"
+#include "vtkCommunicator.h"
 #include "vtkDataArray.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDoubleArray.h"
@@ -16,11 +17,13 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMultiProcessController.h"
+#include "vtkMultiProcessStream.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVMergeTables.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
@@ -30,9 +33,17 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
+#include <iterator>
 #include <sstream>
+#include <type_traits>
 #include <vector>
 
+// clang-format off
+#include <vtk_fmt.h> // needed for `fmt`
+#include VTK_FMT(fmt/format.h)
+// clang-format on
+
 //-----------------------------------------------------------------------------
 vtkStandardNewMacro(vtkCSVWriter);
 
@@ -53,6 +64,7 @@ vtkCSVWriter::vtkCSVWriter()
   this->FileNameSuffix = nullptr;
   this->Precision = 5;
   this->UseScientificNotation = true;
+  this->UseShortestRoundTrip = false;
   this->FieldAssociation = 0;
   this->AddMetaData = false;
   this->AddTimeStep = false;
@@ -192,9 +204,58 @@ int vtkCSVWriter::ProcessRequest(
 
 namespace
 {
+/**
+ * Options used to format numeric values, captured once per write.
+ */
+struct NumberFormat
+{
+  int Precision;
+  bool Scientific;
+  bool ShortestRoundTrip;
+};
+
+/**
+ * Integral values are always written in full.
+ */
+template <typename T>
+void FormatNumber(std::string& out, T value, const NumberFormat&, std::false_type)
+{
+  fmt::format_to(std::back_inserter(out), "{}", value);
+}
+
+/**
+ * Floating point values are written either with the shortest representation
+ * that reads back to the same value, or like `std::ostream` with the writer's
+ * precision and notation (`%.Ne` / `%.Ng`).
+ */
+template <typename T>
+void FormatNumber(std::string& out, T value, const NumberFormat& format, std::true_type)
+{
+  if (format.ShortestRoundTrip)
+  {
+    fmt::format_to(std::back_inserter(out), "{}", value);
+  }
+  else if (format.Scientific)
+  {
+    fmt::format_to(std::back_inserter(out), "{:.{}e}", value, format.Precision);
+  }
+  else
+  {
+    fmt::format_to(std::back_inserter(out), "{:.{}g}", value, format.Precision);
+  }
+}
+
+template <typename T>
+void FormatNumber(std::string& out, T value, const NumberFormat& format)
+{
+  ::FormatNumber(out, value, format, std::is_floating_point<T>());
+}
+
 /**
  * Worker interface, so we can store pointers of concrete subclasses in a generic container.
- * The operator() should write the array value at given index into the stream.
+ * The operator() should append the array value at given index to the buffer.
+ * Workers only read the array, so they can be shared by threads formatting
+ * different rows.
  */
 struct AbstractStreamWorker
 {
@@ -203,7 +264,8 @@ struct AbstractStreamWorker
   {
   }
 
-  virtual void operator()(ostream& stream, vtkCSVWriter* writer, vtkIdType index) = 0;
+  virtual void operator()(
+    std::string& out, vtkCSVWriter* writer, const NumberFormat& format, vtkIdType index) = 0;
   vtkIdType NumberOfComponents;
 };
 
@@ -219,14 +281,16 @@ struct DataToStreamWorker : public AbstractStreamWorker
     this->Range = vtk::DataArrayValueRange(array);
   }
 
-  void operator()(ostream& stream, vtkCSVWriter* vtkNotUsed(writer), vtkIdType index) override
+  void operator()(std::string& out, vtkCSVWriter* vtkNotUsed(writer), const NumberFormat& format,
+    vtkIdType index) override
   {
-    stream << this->Range[index];
+    ::FormatNumber(out, static_cast<ValueType>(this->Range[index]), format);
   }
 
 private:
   using RangeType =
     typename vtk::detail::SelectValueRange<ArrayT, vtk::detail::DynamicTupleSize>::type;
+  using ValueType = typename RangeType::ValueType;
   RangeType Range;
 };
 
@@ -242,9 +306,10 @@ struct DataToStreamWorker<vtkStringArray> : public AbstractStreamWorker
   {
   }
 
-  void operator()(ostream& stream, vtkCSVWriter* writer, vtkIdType index) override
+  void operator()(std::string& out, vtkCSVWriter* writer, const NumberFormat& vtkNotUsed(format),
+    vtkIdType index) override
   {
-    stream << writer->GetString(this->Array->GetValue(index));
+    out += writer->GetString(this->Array->GetValue(index));
   }
 
   vtkStringArray* Array;
@@ -262,9 +327,10 @@ struct DataToStreamWorker<vtkCharArray> : public AbstractStreamWorker
     this->Range = vtk::DataArrayValueRange(array);
   }
 
-  void operator()(ostream& stream, vtkCSVWriter* vtkNotUsed(writer), vtkIdType index) override
+  void operator()(std::string& out, vtkCSVWriter* vtkNotUsed(writer), const NumberFormat& format,
+    vtkIdType index) override
   {
-    stream << static_cast<int>(this->Range[index]);
+    ::FormatNumber(out, static_cast<int>(this->Range[index]), format);
   }
 
 private:
@@ -285,9 +351,10 @@ struct DataToStreamWorker<vtkUnsignedCharArray> : public AbstractStreamWorker
     this->Range = vtk::DataArrayValueRange(array);
   }
 
-  void operator()(ostream& stream, vtkCSVWriter* vtkNotUsed(writer), vtkIdType index) override
+  void operator()(std::string& out, vtkCSVWriter* vtkNotUsed(writer), const NumberFormat& format,
+    vtkIdType index) override
   {
-    stream << static_cast<int>(this->Range[index]);
+    ::FormatNumber(out, static_cast<int>(this->Range[index]), format);
   }
 
 private:
@@ -421,14 +488,22 @@ public:
         this->ColumnInfo.push_back(std::make_pair(std::string(array->GetName()), num_comps));
       }
     }
-    // push the floating point precision/notation type.
-    if (self->GetUseScientificNotation())
-    {
-      this->Stream << std::scientific;
-    }
-    this->Stream << std::setprecision(self->GetPrecision());
   }
 
+  void Close() { this->Stream.close(); }
+
+  ///@{
+  /**
+   * Order of arrays written out in header, as pairs of name and number of
+   * components. Used to share the columns chosen by the root with other ranks.
+   */
+  const std::vector<std::pair<std::string, int>>& GetColumnInfo() const { return this->ColumnInfo; }
+  void SetColumnInfo(const std::vector<std::pair<std::string, int>>& info)
+  {
+    this->ColumnInfo = info;
+  }
+  ///@}
+
   void InitializeStreamWorkers(vtkDataSetAttributes* dsa, vtkCSVWriter* self)
   {
     this->ColumnsWorkers.clear();
@@ -476,23 +551,76 @@ public:
 
   void WriteData(vtkDataSetAttributes* dsa, vtkCSVWriter* self)
   {
-    const auto numTuples = dsa->GetNumberOfTuples();
-    for (vtkIdType tupleIndex = 0; tupleIndex < numTuples; ++tupleIndex)
+    this->FormatData(dsa, self, [this](const std::string& text) {
+      this->Stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+    });
+  }
+
+  /**
+   * Format all rows of the table and hand the text over to `consumer` in row
+   * order. Rows are split into chunks formatted in parallel with vtkSMPTools,
+   * one buffer per chunk. Chunks are processed in batches so that the text
+   * kept in memory stays bounded; buffers are reused from one batch to the next.
+   */
+  template <typename ConsumerT>
+  void FormatData(vtkTable* table, vtkCSVWriter* self, ConsumerT&& consumer)
+  {
+    this->InitializeStreamWorkers(table->GetRowData(), self);
+    this->FormatData(table->GetRowData(), self, consumer);
+  }
+
+  template <typename ConsumerT>
+  void FormatData(vtkDataSetAttributes* dsa, vtkCSVWriter* self, ConsumerT&& consumer)
+  {
+    const NumberFormat format{ self->GetPrecision(), self->GetUseScientificNotation(),
+      self->GetUseShortestRoundTrip() };
+
+    const vtkIdType rowsPerChunk = 4096;
+    const vtkIdType chunksPerBatch = 256;
+    const vtkIdType numTuples = dsa->GetNumberOfTuples();
+    std::vector<std::string> chunks(chunksPerBatch);
+    for (vtkIdType batchBegin = 0; batchBegin < numTuples;
+         batchBegin += rowsPerChunk * chunksPerBatch)
+    {
+      const vtkIdType batchEnd = std::min(numTuples, batchBegin + rowsPerChunk * chunksPerBatch);
+      const vtkIdType numChunks = (batchEnd - batchBegin + rowsPerChunk - 1) / rowsPerChunk;
+      vtkSMPTools::For(0, numChunks, [&](vtkIdType first, vtkIdType last) {
+        for (vtkIdType chunk = first; chunk < last; ++chunk)
+        {
+          const vtkIdType begin = batchBegin + chunk * rowsPerChunk;
+          const vtkIdType end = std::min(batchEnd, begin + rowsPerChunk);
+          chunks[chunk].clear();
+          this->FormatRows(begin, end, numTuples, self, format, chunks[chunk]);
+        }
+      });
+      for (vtkIdType chunk = 0; chunk < numChunks; ++chunk)
+      {
+        consumer(chunks[chunk]);
+      }
+    }
+  }
+
+private:
+  void FormatRows(vtkIdType begin, vtkIdType end, vtkIdType numTuples, vtkCSVWriter* self,
+    const NumberFormat& format, std::string& out)
+  {
+    const char* fieldDelimiter = self->GetFieldDelimiter();
+    for (vtkIdType tupleIndex = begin; tupleIndex < end; ++tupleIndex)
     {
       bool firstColumn = true;
       if (this->TimeStep >= 0)
       {
-        this->Stream << this->TimeStep;
+        ::FormatNumber(out, this->TimeStep, format);
         firstColumn = false;
       }
       if (!vtkMath::IsNan(this->Time))
       {
         if (!firstColumn)
         {
-          this->Stream << self->GetFieldDelimiter();
+          out += fieldDelimiter;
         }
         // add a time column.
-        this->Stream << this->Time;
+        ::FormatNumber(out, this->Time, format);
         firstColumn = false;
       }
 
@@ -504,20 +632,19 @@ public:
         {
           if (!firstColumn)
           {
-            this->Stream << self->GetFieldDelimiter();
+            out += fieldDelimiter;
           }
           firstColumn = false;
           if ((index + component) < numComps * numTuples)
           {
-            (*columnWorker)(this->Stream, self, index + component);
+            (*columnWorker)(out, self, format, index + component);
           }
         }
       }
-      this->Stream << "\n";
+      out += "\n";
     }
   }
 
-private:
   CSVFile(const CSVFile&) = delete;
   void operator=(const CSVFile&) = delete;
 };
@@ -672,18 +799,34 @@ void vtkCSVWriter::WriteData()
 
   const int myRank = controller->GetLocalProcessId();
   const int numRanks = controller->GetNumberOfProcesses();
-  if (myRank > 0)
+  vtkCSVWriter::CSVFile file(timeStep, time);
+  CSVFile::OpenMode openMode =
+    this->WriteAllTimeSteps && !this->WriteAllTimeStepsSeparately && this->CurrentTimeIndex > 0
+    ? CSVFile::OpenMode::Append
+    : CSVFile::OpenMode::Write;
+
+  int error_code{ vtkErrorCode::NoError };
+  if (myRank == 0)
   {
-    int error_code{ vtkErrorCode::NoError };
-    controller->Broadcast(&error_code, 1, 0);
-    if (error_code != vtkErrorCode::NoError)
-    {
-      this->SetErrorCode(error_code);
-      return;
-    }
+    error_code = file.Open(filename.str().c_str(), openMode);
+  }
+  controller->Broadcast(&error_code, 1, 0);
+  if (error_code != vtkErrorCode::NoError)
+  {
+    this->SetErrorCode(error_code);
+    return;
+  }
 
-    vtkIdType row_count = table->GetNumberOfRows();
-    controller->Gather(&row_count, nullptr, 1, 0);
+  const vtkIdType row_count = table->GetNumberOfRows();
+  std::vector<vtkIdType> global_row_counts(numRanks, 0);
+  controller->Gather(&row_count, global_row_counts.data(), 1, 0);
+
+  // The root determines which columns to write and writes the header. The
+  // columns and the size of the file after the header are then shared with all
+  // ranks, which write their own rows directly at their offset in the file.
+  vtkMultiProcessStream columnsStream;
+  if (myRank > 0)
+  {
     if (row_count > 0)
     {
       vtkNew<vtkTable> clone;
@@ -696,36 +839,9 @@ void vtkCSVWriter::WriteData()
       // output file consistently.
       controller->Send(clone, 0, 88020);
     }
-
-    // BARRIER
-    controller->Barrier();
-
-    if (row_count > 0)
-    {
-      controller->Send(table, 0, 88021);
-    }
-    controller->Broadcast(&error_code, 1, 0);
-    this->SetErrorCode(error_code);
   }
   else
   {
-    vtkCSVWriter::CSVFile file(timeStep, time);
-    CSVFile::OpenMode openMode =
-      this->WriteAllTimeSteps && !this->WriteAllTimeStepsSeparately && this->CurrentTimeIndex > 0
-      ? CSVFile::OpenMode::Append
-      : CSVFile::OpenMode::Write;
-    int error_code = file.Open(filename.str().c_str(), openMode);
-    controller->Broadcast(&error_code, 1, 0);
-    if (error_code != vtkErrorCode::NoError)
-    {
-      this->SetErrorCode(error_code);
-      return;
-    }
-
-    const vtkIdType row_count = table->GetNumberOfRows();
-    std::vector<vtkIdType> global_row_counts(numRanks, 0);
-    controller->Gather(&row_count, global_row_counts.data(), 1, 0);
-
     // build field list to determine which columns to write.
     vtkDataSetAttributes::FieldList columns;
     for (int rank = 0; rank < numRanks; ++rank)
@@ -745,40 +861,75 @@ void vtkCSVWriter::WriteData()
       }
     }
 
-    // BARRIER
-    controller->Barrier();
-
-    // now write the real data.
     vtkNew<vtkDataSetAttributes> tmp;
     tmp->CopyAllOn();
     columns.CopyAllocate(tmp, vtkDataSetAttributes::PASSDATA, /*sz=*/1, 0);
 
     // first write headers.
     file.WriteHeader(tmp, this, openMode);
+    file.Close();
 
-    for (int rank = 0; rank < numRanks; ++rank)
+    const auto& columnInfo = file.GetColumnInfo();
+    columnsStream << static_cast<int>(columnInfo.size());
+    for (const auto& cinfo : columnInfo)
     {
-      if (global_row_counts[rank] > 0)
+      columnsStream << cinfo.first << cinfo.second;
+    }
+    columnsStream << static_cast<vtkTypeUInt64>(
+      vtksys::SystemTools::FileLength(filename.str()));
+  }
+  controller->Broadcast(columnsStream, 0);
+
+  int numColumns = 0;
+  columnsStream >> numColumns;
+  std::vector<std::pair<std::string, int>> columnInfo(numColumns);
+  for (auto& cinfo : columnInfo)
+  {
+    columnsStream >> cinfo.first >> cinfo.second;
+  }
+  vtkTypeUInt64 headerSize = 0;
+  columnsStream >> headerSize;
+  file.SetColumnInfo(columnInfo);
+
+  // format the local rows, in parallel chunks.
+  std::string text;
+  if (row_count > 0)
+  {
+    file.FormatData(table, this, [&text](const std::string& chunk) { text += chunk; });
+  }
+
+  // exclusive scan of the formatted sizes gives the offset of each rank.
+  const vtkIdType localSize = static_cast<vtkIdType>(text.size());
+  std::vector<vtkIdType> sizes(numRanks, 0);
+  controller->AllGather(&localSize, sizes.data(), 1);
+  vtkTypeUInt64 offset = headerSize;
+  for (int rank = 0; rank < myRank; ++rank)
+  {
+    offset += static_cast<vtkTypeUInt64>(sizes[rank]);
+  }
+
+  if (!text.empty())
+  {
+    vtksys::ofstream stream(filename.str().c_str(), ios::in | ios::out | ios::binary);
+    if (stream.fail())
+    {
+      error_code = vtkErrorCode::CannotOpenFileError;
+    }
+    else
+    {
+      stream.seekp(static_cast<std::streamoff>(offset));
+      stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+      if (stream.fail())
       {
-        if (rank == 0)
-        {
-          file.WriteData(table, this);
-        }
-        else
-        {
-          vtkNew<vtkTable> remote_table;
-          controller->Receive(remote_table.Get(), rank, 88021);
-          assert(remote_table->GetNumberOfRows() > 0);
-          file.WriteData(remote_table, this);
-        }
+        error_code = vtkErrorCode::OutOfDiskSpaceError;
       }
     }
-
-    error_code = vtkErrorCode::NoError;
-    controller->Broadcast(&error_code, 1, 0);
-    this->SetErrorCode(error_code);
   }
 
+  int global_error_code{ vtkErrorCode::NoError };
+  controller->AllReduce(&error_code, &global_error_code, 1, vtkCommunicator::MAX_OP);
+  this->SetErrorCode(global_error_code);
+
   // the writer can be used for multiple timesteps
   // and the array is re-created at each use.
   // except when writing multiple timesteps
@@ -806,6 +957,7 @@ void vtkCSVWriter::PrintSelf(ostream& os, vtkIndent indent)
      << endl;
   os << indent << "UseScientificNotation: " << this->UseScientificNotation << endl;
   os << indent << "Precision: " << this->Precision << endl;
+  os << indent << "UseShortestRoundTrip: " << this->UseShortestRoundTrip << endl;
   os << indent << "FieldAssociation: " << this->FieldAssociation << endl;
   os << indent << "AddMetaData: " << (this->AddMetaData ? "Yes" : "No") << endl;
   os << indent << "AddTimeStep: " << (this->AddTimeStep ? "Yes" : "No") << endl;
@@ -126,6 +126,18 @@ public:
   vtkBooleanMacro(UseScientificNotation, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true, floating point values are written with the shortest
+   * representation that reads back to the exact same value, and `Precision`
+   * and `UseScientificNotation` are ignored. This is also the fastest way to
+   * format floating point values. Default is false.
+   */
+  vtkSetMacro(UseShortestRoundTrip, bool);
+  vtkGetMacro(UseShortestRoundTrip, bool);
+  vtkBooleanMacro(UseShortestRoundTrip, bool);
+  ///@}
+
   ///@{
   /**
    * Get/set the attribute data to write if the input is either
@@ -207,6 +219,7 @@ protected:
   bool UseStringDelimiter;
   int Precision;
   bool UseScientificNotation;
+  bool UseShortestRoundTrip;
   int FieldAssociation;
   bool AddMetaData;
   bool AddTimeStep;
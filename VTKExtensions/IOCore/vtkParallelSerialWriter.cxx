@@ -4,7 +4,9 @@
 
 #include "vtkClientServerInterpreter.h"
 #include "vtkClientServerInterpreterInitializer.h"
+#include "vtkCharArray.h"
 #include "vtkClientServerStream.h"
+#include "vtkCommunicator.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkConvertToPartitionedDataSetCollection.h"
@@ -16,11 +18,17 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
+#include "vtkPVLogger.h"
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkReductionFilter.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+#include "vtkMPICommunicator.h"
+#include "vtkMPIController.h"
+#endif
+
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -34,6 +42,8 @@
 
 namespace
 {
+constexpr int STREAM_PIECE_TAG = 982134;
+
 bool vtkIsEmpty(vtkDataObject* dobj)
 {
   for (int cc = 0; (dobj != nullptr) && (cc < vtkDataObject::NUMBER_OF_ASSOCIATIONS); ++cc)
@@ -56,6 +66,7 @@ vtkCxxSetObjectMacro(vtkParallelSerialWriter, Controller, vtkMultiProcessControl
 vtkParallelSerialWriter::vtkParallelSerialWriter()
   : NumberOfIORanks(1)
   , RankAssignmentMode(vtkParallelSerialWriter::ASSIGNMENT_MODE_CONTIGUOUS)
+  , AggregationMode(vtkParallelSerialWriter::AGGREGATION_MODE_GATHER)
   , Controller(nullptr)
   , SubController(nullptr)
 {
@@ -287,6 +298,7 @@ void vtkParallelSerialWriter::WriteATimestep(const std::string& fname, vtkPartit
 
   if (this->PreGatherHelper)
   {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "pre-gather");
     this->PreGatherHelper->SetInputDataObject(inputDO);
     this->PreGatherHelper->Update();
     inputDO = this->PreGatherHelper->GetOutputDataObject(0);
@@ -295,7 +307,16 @@ void vtkParallelSerialWriter::WriteATimestep(const std::string& fname, vtkPartit
 
   // gather data to "root"; note this can be the root of the subcontroller.
   std::vector<vtkSmartPointer<vtkDataObject>> gatheredDataSets;
-  controller->Gather(inputDO, gatheredDataSets, 0);
+  if (this->AggregationMode == AGGREGATION_MODE_STREAMED)
+  {
+    this->StreamToRoot(controller, inputDO, gatheredDataSets);
+  }
+  else
+  {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "gather to IO rank (group of %d)",
+      controller->GetNumberOfProcesses());
+    controller->Gather(inputDO, gatheredDataSets, 0);
+  }
   if (controller->GetLocalProcessId() != 0)
   {
     // done.
@@ -323,6 +344,8 @@ void vtkParallelSerialWriter::WriteATimestep(const std::string& fname, vtkPartit
 
   if (this->PostGatherHelper)
   {
+    vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "post-gather (%d pieces)",
+      static_cast<int>(allDataSets.size()));
     for (auto piece : allDataSets)
     {
       this->PostGatherHelper->AddInputDataObject(piece);
@@ -344,9 +367,100 @@ void vtkParallelSerialWriter::WriteATimestep(const std::string& fname, vtkPartit
 
   // release memory.
   allDataSets.clear();
+  vtkVLogScopeF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "write '%s'", fname.c_str());
   this->WriteAFile(fname, inputDO);
 }
 
+//----------------------------------------------------------------------------
+void vtkParallelSerialWriter::StreamToRoot(vtkMultiProcessController* controller,
+  vtkDataObject* input, std::vector<vtkSmartPointer<vtkDataObject>>& gatheredDataSets)
+{
+  const int myid = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+  vtkVLogScopeF(
+    PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "stream to IO rank (group of %d)", numProcs);
+
+  // the IO rank needs the size of every piece up front to size its buffers.
+  vtkNew<vtkCharArray> localBuffer;
+  if (myid != 0)
+  {
+    vtkCommunicator::MarshalDataObject(input, localBuffer);
+  }
+  const vtkIdType localSize = localBuffer->GetNumberOfValues();
+  std::vector<vtkIdType> sizes(numProcs, 0);
+  controller->Gather(&localSize, sizes.data(), 1, 0);
+
+  if (myid != 0)
+  {
+    if (localSize > 0)
+    {
+      controller->Send(localBuffer->GetPointer(0), localSize, 0, STREAM_PIECE_TAG);
+    }
+    return;
+  }
+
+  gatheredDataSets.emplace_back(input);
+
+  std::vector<int> sources;
+  vtkIdType totalSize = 0;
+  for (int cc = 1; cc < numProcs; ++cc)
+  {
+    if (sizes[cc] > 0)
+    {
+      sources.push_back(cc);
+      totalSize += sizes[cc];
+    }
+  }
+
+  // Two receive buffers: while one piece is decoded, the next one is already
+  // being received. Without MPI, or for pieces too large for a single MPI
+  // message, the receive is blocking.
+  vtkNew<vtkCharArray> buffers[2];
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+  bool pending[2] = { false, false };
+  auto mpiController = vtkMPIController::SafeDownCast(controller);
+  vtkMPICommunicator::Request requests[2];
+#endif
+  auto postReceive = [&](size_t idx) {
+    const int source = sources[idx];
+    vtkCharArray* buffer = buffers[idx % 2];
+    buffer->SetNumberOfValues(sizes[source]);
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+    if (mpiController && sizes[source] <= VTK_INT_MAX)
+    {
+      mpiController->NoBlockReceive(buffer->GetPointer(0), static_cast<int>(sizes[source]),
+        source, STREAM_PIECE_TAG, requests[idx % 2]);
+      pending[idx % 2] = true;
+      return;
+    }
+#endif
+    controller->Receive(buffer->GetPointer(0), sizes[source], source, STREAM_PIECE_TAG);
+  };
+
+  if (!sources.empty())
+  {
+    postReceive(0);
+  }
+  for (size_t cc = 0; cc < sources.size(); ++cc)
+  {
+#if VTK_MODULE_ENABLE_VTK_ParallelMPI
+    if (pending[cc % 2])
+    {
+      requests[cc % 2].Wait();
+      pending[cc % 2] = false;
+    }
+#endif
+    if (cc + 1 < sources.size())
+    {
+      postReceive(cc + 1);
+    }
+    gatheredDataSets.emplace_back(vtkCommunicator::UnMarshalDataObject(buffers[cc % 2]));
+  }
+
+  vtkVLogF(PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY(), "received %d pieces (%lld bytes)",
+    static_cast<int>(sources.size()), static_cast<long long>(totalSize));
+}
+
 //----------------------------------------------------------------------------
 void vtkParallelSerialWriter::WriteAFile(const std::string& filename_arg, vtkDataObject* input)
 {
@@ -435,4 +549,7 @@ void vtkParallelSerialWriter::SetWriterFileName(const char* fname)
 void vtkParallelSerialWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfIORanks: " << this->NumberOfIORanks << endl;
+  os << indent << "RankAssignmentMode: " << this->RankAssignmentMode << endl;
+  os << indent << "AggregationMode: " << this->AggregationMode << endl;
 }
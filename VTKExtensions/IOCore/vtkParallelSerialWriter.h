@@ -22,6 +22,7 @@
 #include "vtkPVVTKExtensionsIOCoreModule.h" //needed for exports
 #include "vtkSmartPointer.h"                // needed for vtkSmartPointer
 #include <string>                           // for std::string
+#include <vector>                           // for std::vector
 
 class vtkClientServerInterpreter;
 class vtkMultiProcessController;
@@ -180,6 +181,31 @@ public:
   vtkGetMacro(RankAssignmentMode, int);
   ///@}
 
+  enum
+  {
+    AGGREGATION_MODE_GATHER,
+    AGGREGATION_MODE_STREAMED
+  };
+
+  ///@{
+  /**
+   * Controls how the data of each group of ranks reaches the rank that writes it.
+   *
+   * In AGGREGATION_MODE_GATHER (default), all pieces are collected with a single
+   * gather, which holds every serialized piece in memory on the IO rank at once.
+   *
+   * In AGGREGATION_MODE_STREAMED, each rank sends its serialized piece to the IO
+   * rank with a point-to-point message. The IO rank decodes one piece while the
+   * next one is still being received (double-buffering, when running with MPI),
+   * so at most two serialized pieces are held at any time.
+   *
+   * Timings for the pre-gather, aggregation, post-gather and write phases are
+   * reported under `PARAVIEW_LOG_DATA_MOVEMENT_VERBOSITY()` in both modes.
+   */
+  vtkSetClampMacro(AggregationMode, int, AGGREGATION_MODE_GATHER, AGGREGATION_MODE_STREAMED);
+  vtkGetMacro(AggregationMode, int);
+  ///@}
+
   ///@{
   /**
    * Get/Set the controller to use. By default initialized to
@@ -205,6 +231,8 @@ private:
   void operator=(const vtkParallelSerialWriter&) = delete;
 
   void WriteATimestep(const std::string& fname, vtkPartitionedDataSet* input);
+  void StreamToRoot(vtkMultiProcessController* controller, vtkDataObject* input,
+    std::vector<vtkSmartPointer<vtkDataObject>>& gatheredDataSets);
   void WriteAFile(const std::string& fname, vtkDataObject* input);
 
   void SetWriterFileName(const char* fname);
@@ -233,6 +261,7 @@ private:
 
   int NumberOfIORanks;
   int RankAssignmentMode;
+  int AggregationMode;
 
   vtkMultiProcessController* Controller;
   vtkSmartPointer<vtkMultiProcessController> SubController;
@@ -9,6 +9,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiPieceDataSet.h"
+#include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVXMLElement.h"
 #include "vtkPVXMLParser.h"
@@ -20,8 +21,12 @@
 
 #include <vtksys/SystemTools.hxx>
 
+#include <algorithm>
 #include <map>
+#include <numeric>
 #include <sstream>
+#include <string>
+#include <vector>
 
 struct vtkPPhastaReaderInternal
 {
@@ -43,6 +48,90 @@ struct vtkPPhastaReaderInternal
   TimeStepInfoMapType TimeStepInfoMap;
   typedef std::map<int, vtkSmartPointer<vtkUnstructuredGrid>> CachedGridsMapType;
   CachedGridsMapType CachedGrids;
+
+  // Pieces assigned to this process by size, computed once per meta-file and
+  // number of requested pieces so that each process keeps loading the same
+  // pieces (and hits CachedGrids) from one time step to the next.
+  std::vector<int> AssignedPieces;
+  std::string AssignedFileName;
+  int AssignedNumberOfProcPieces = 0;
+  int AssignedPiece = -1;
+
+  struct FileNamePattern
+  {
+    const char* Pattern = nullptr;
+    int HasPiece = 0;
+    int HasTime = 0;
+  };
+
+  /**
+   * Build the name of the file of `piece` at the time index `timeIndex`,
+   * relative to the directory of the meta-file `metaFileName`.
+   */
+  static std::string GetFileName(
+    const FileNamePattern& pattern, int timeIndex, int piece, const char* metaFileName)
+  {
+    size_t name_sz = strlen(pattern.Pattern) + 60;
+    std::vector<char> name(name_sz);
+    if (pattern.HasTime && pattern.HasPiece)
+    {
+      snprintf(name.data(), name_sz, pattern.Pattern, timeIndex, piece + 1);
+    }
+    else if (pattern.HasPiece)
+    {
+      snprintf(name.data(), name_sz, pattern.Pattern, piece + 1);
+    }
+    else if (pattern.HasTime)
+    {
+      snprintf(name.data(), name_sz, pattern.Pattern, timeIndex);
+    }
+    else
+    {
+      strncpy(name.data(), pattern.Pattern, name_sz);
+      name[name_sz - 1] = '\0';
+    }
+
+    std::ostringstream fname;
+    std::string npath = vtksys::SystemTools::GetFilenamePath(name.data());
+    if (npath.empty() || !vtksys::SystemTools::FileIsFullPath(npath.c_str()))
+    {
+      std::string path = vtksys::SystemTools::GetFilenamePath(metaFileName);
+      if (!path.empty())
+      {
+        fname << path.c_str() << "/";
+      }
+    }
+    fname << name.data();
+    return fname.str();
+  }
+
+  /**
+   * Assign pieces to processes so that the total size on disk of the pieces
+   * assigned to each process is balanced: pieces are handed out from the
+   * largest to the smallest to the least loaded process.
+   */
+  static std::vector<int> AssignPiecesBySize(
+    const std::vector<unsigned long>& sizes, int numProcPieces, int procPiece)
+  {
+    std::vector<int> order(sizes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(
+      order.begin(), order.end(), [&](int a, int b) { return sizes[a] > sizes[b]; });
+
+    std::vector<unsigned long> loads(numProcPieces, 0);
+    std::vector<int> assigned;
+    for (int piece : order)
+    {
+      auto least = std::min_element(loads.begin(), loads.end());
+      *least += sizes[piece];
+      if (static_cast<int>(least - loads.begin()) == procPiece)
+      {
+        assigned.push_back(piece);
+      }
+    }
+    std::sort(assigned.begin(), assigned.end());
+    return assigned;
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -66,6 +155,8 @@ vtkPPhastaReader::vtkPPhastaReader()
 
   this->TimeStepRange[0] = 0;
   this->TimeStepRange[1] = 0;
+
+  this->BalancePiecesBySize = true;
 }
 
 //----------------------------------------------------------------------------
@@ -145,12 +236,8 @@ int vtkPPhastaReader::RequestData(
   output->SetBlock(0, MultiPieceDataSet);
   MultiPieceDataSet->Delete();
 
-  const char* geometryPattern = nullptr;
-  int geomHasPiece = 0;
-  int geomHasTime = 0;
-  const char* fieldPattern = nullptr;
-  int fieldHasPiece = 0;
-  int fieldHasTime = 0;
+  vtkPPhastaReaderInternal::FileNamePattern geometryPattern;
+  vtkPPhastaReaderInternal::FileNamePattern fieldPattern;
 
   unsigned int numElements = rootElement->GetNumberOfNestedElements();
   for (unsigned int i = 0; i < numElements; i++)
@@ -159,116 +246,98 @@ int vtkPPhastaReader::RequestData(
 
     if (strcmp("GeometryFileNamePattern", nested->GetName()) == 0)
     {
-      geometryPattern = nested->GetAttribute("pattern");
-      if (!nested->GetScalarAttribute("has_piece_entry", &geomHasPiece))
+      geometryPattern.Pattern = nested->GetAttribute("pattern");
+      if (!nested->GetScalarAttribute("has_piece_entry", &geometryPattern.HasPiece))
       {
-        geomHasPiece = 0;
+        geometryPattern.HasPiece = 0;
       }
-      if (!nested->GetScalarAttribute("has_time_entry", &geomHasTime))
+      if (!nested->GetScalarAttribute("has_time_entry", &geometryPattern.HasTime))
       {
-        geomHasTime = 0;
+        geometryPattern.HasTime = 0;
       }
     }
 
     if (strcmp("FieldFileNamePattern", nested->GetName()) == 0)
     {
-      fieldPattern = nested->GetAttribute("pattern");
-      if (!nested->GetScalarAttribute("has_piece_entry", &fieldHasPiece))
+      fieldPattern.Pattern = nested->GetAttribute("pattern");
+      if (!nested->GetScalarAttribute("has_piece_entry", &fieldPattern.HasPiece))
       {
-        fieldHasPiece = 0;
+        fieldPattern.HasPiece = 0;
       }
-      if (!nested->GetScalarAttribute("has_time_entry", &fieldHasTime))
+      if (!nested->GetScalarAttribute("has_time_entry", &fieldPattern.HasTime))
       {
-        fieldHasTime = 0;
+        fieldPattern.HasTime = 0;
       }
     }
   }
 
-  if (!geometryPattern)
+  if (!geometryPattern.Pattern)
   {
     vtkErrorMacro("No geometry pattern was specified. Cannot load file");
     return 0;
   }
 
-  if (!fieldPattern)
+  if (!fieldPattern.Pattern)
   {
     vtkErrorMacro("No field pattern was specified. Cannot load file");
     return 0;
   }
 
-  size_t geom_name_sz = strlen(geometryPattern) + 60;
-  char* geom_name = new char[geom_name_sz];
-  size_t field_name_sz = strlen(fieldPattern) + 60;
-  char* field_name = new char[field_name_sz];
+  const vtkPPhastaReaderInternal::TimeStepInfo& stepInfo =
+    this->Internal->TimeStepInfoMap[this->ActualTimeStep];
 
-  // now loop over all of the files that I should load
-  for (int loadingPiece = piece; loadingPiece < numPieces; loadingPiece += numProcPieces)
+  // Decide which pieces this process loads.
+  std::vector<int> loadingPieces;
+  if (this->BalancePiecesBySize && numPieces != numProcPieces && numProcPieces > 1)
   {
-    if (geomHasTime && geomHasPiece)
-    {
-      snprintf(geom_name, geom_name_sz, geometryPattern,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].GeomIndex, loadingPiece + 1);
-    }
-    else if (geomHasPiece)
-    {
-      snprintf(geom_name, geom_name_sz, geometryPattern, loadingPiece + 1);
-    }
-    else if (geomHasTime)
-    {
-      snprintf(geom_name, geom_name_sz, geometryPattern,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].GeomIndex);
-    }
-    else
-    {
-      strncpy(geom_name, geometryPattern, geom_name_sz);
-      geom_name[geom_name_sz - 1] = '\0';
-    }
-
-    if (fieldHasTime && fieldHasPiece)
-    {
-      snprintf(field_name, field_name_sz, fieldPattern,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].FieldIndex, loadingPiece + 1);
-    }
-    else if (fieldHasPiece)
-    {
-      snprintf(field_name, field_name_sz, fieldPattern, loadingPiece + 1);
-    }
-    else if (fieldHasTime)
-    {
-      snprintf(field_name, field_name_sz, fieldPattern,
-        this->Internal->TimeStepInfoMap[this->ActualTimeStep].FieldIndex);
-    }
-    else
-    {
-      strncpy(field_name, fieldPattern, field_name_sz);
-      field_name[field_name_sz - 1] = '\0';
-    }
-
-    std::ostringstream geomFName;
-    std::string gpath = vtksys::SystemTools::GetFilenamePath(geom_name);
-    if (gpath.empty() || !vtksys::SystemTools::FileIsFullPath(gpath.c_str()))
+    vtkPPhastaReaderInternal& internal = *this->Internal;
+    if (internal.AssignedFileName != this->FileName ||
+      internal.AssignedNumberOfProcPieces != numProcPieces || internal.AssignedPiece != piece)
     {
-      std::string path = vtksys::SystemTools::GetFilenamePath(this->FileName);
-      if (!path.empty())
+      // Only the geometry files are considered: their sizes do not change
+      // from one time step to the next. When all processes are reading,
+      // the first one looks at the files and tells the others.
+      vtkMultiProcessController* controller = vtkMultiProcessController::GetGlobalController();
+      const bool collective = controller && controller->GetNumberOfProcesses() == numProcPieces;
+      std::vector<unsigned long> sizes(numPieces, 0);
+      if (!collective || controller->GetLocalProcessId() == 0)
       {
-        geomFName << path.c_str() << "/";
+        for (int cc = 0; cc < numPieces; cc++)
+        {
+          sizes[cc] = vtksys::SystemTools::FileLength(vtkPPhastaReaderInternal::GetFileName(
+            geometryPattern, stepInfo.GeomIndex, cc, this->FileName));
+        }
       }
-    }
-    geomFName << geom_name << ends;
-    this->Reader->SetGeometryFileName(geomFName.str().c_str());
-
-    std::ostringstream fieldFName;
-    std::string fpath = vtksys::SystemTools::GetFilenamePath(field_name);
-    if (fpath.empty() || !vtksys::SystemTools::FileIsFullPath(fpath.c_str()))
-    {
-      std::string path = vtksys::SystemTools::GetFilenamePath(this->FileName);
-      if (!path.empty())
+      if (collective)
       {
-        fieldFName << path.c_str() << "/";
+        controller->Broadcast(sizes.data(), numPieces, 0);
       }
+      internal.AssignedPieces =
+        vtkPPhastaReaderInternal::AssignPiecesBySize(sizes, numProcPieces, piece);
+      internal.AssignedFileName = this->FileName;
+      internal.AssignedNumberOfProcPieces = numProcPieces;
+      internal.AssignedPiece = piece;
     }
-    fieldFName << field_name << ends;
-    this->Reader->SetFieldFileName(fieldFName.str().c_str());
+    loadingPieces = internal.AssignedPieces;
+  }
+  else
+  {
+    for (int loadingPiece = piece; loadingPiece < numPieces; loadingPiece += numProcPieces)
+    {
+      loadingPieces.push_back(loadingPiece);
+    }
+  }
+
+  // now loop over all of the files that I should load
+  for (int loadingPiece : loadingPieces)
+  {
+    const std::string geomFName = vtkPPhastaReaderInternal::GetFileName(
+      geometryPattern, stepInfo.GeomIndex, loadingPiece, this->FileName);
+    this->Reader->SetGeometryFileName(geomFName.c_str());
+
+    const std::string fieldFName = vtkPPhastaReaderInternal::GetFileName(
+      fieldPattern, stepInfo.FieldIndex, loadingPiece, this->FileName);
+    this->Reader->SetFieldFileName(fieldFName.c_str());
 
     vtkPPhastaReaderInternal::CachedGridsMapType::iterator CachedCopy =
       this->Internal->CachedGrids.find(loadingPiece);
@@ -295,9 +364,6 @@ int vtkPPhastaReader::RequestData(
     MultiPieceDataSet->SetPiece(loadingPiece, copy);
   }
 
-  delete[] geom_name;
-  delete[] field_name;
-
   if (steps)
   {
     output->GetInformation()->Set(vtkDataObject::DATA_TIME_STEP(), steps[this->ActualTimeStep]);
@@ -587,4 +653,5 @@ void vtkPPhastaReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "TimeStepIndex: " << this->TimeStepIndex << endl;
   os << indent << "TimeStepRange: " << this->TimeStepRange[0] << " " << this->TimeStepRange[1]
      << endl;
+  os << indent << "BalancePiecesBySize: " << this->BalancePiecesBySize << endl;
 }
@@ -146,6 +146,21 @@ public:
   vtkGetVector2Macro(TimeStepRange, int);
   ///@}
 
+  ///@{
+  /**
+   * When the number of pieces in the data set differs from the number of
+   * requested pieces, assign pieces to processes so that each process reads
+   * about the same amount of data, based on the size of the geometry file of
+   * each piece. The assignment is computed once per meta-file, by the first
+   * process when all processes read, so that each process keeps the same
+   * pieces across time steps. Otherwise, pieces are dealt in a round-robin
+   * fashion. Default is true.
+   */
+  vtkSetMacro(BalancePiecesBySize, bool);
+  vtkGetMacro(BalancePiecesBySize, bool);
+  vtkBooleanMacro(BalancePiecesBySize, bool);
+  ///@}
+
   static int CanReadFile(const char* filename);
 
 protected:
@@ -171,6 +186,8 @@ protected:
 
   int ActualTimeStep;
 
+  bool BalancePiecesBySize;
+
 private:
   vtkPPhastaReaderInternal* Internal;
 
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkPhastaReader.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkByteSwap.h"
 #include "vtkCellData.h"
 #include "vtkCellType.h" //added for constants such as VTK_TETRA etc...
@@ -12,9 +13,11 @@
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkIntArray.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkUnstructuredGrid.h"
 
@@ -50,6 +53,29 @@ struct vtkPhastaReaderInternal
   FieldInfoMapType FieldInfoMap;
 };
 
+namespace
+{
+// Phasta stores multi-component fields component by component, i.e.
+// data[var * numTuples + tuple]. Transpose the components
+// [index, index + numComps) into the AOS layout of `array`, in parallel.
+template <typename ValueT>
+void DecodeField(const ValueT* data, int index, int numComps, vtkIdType numTuples,
+  vtkAOSDataArrayTemplate<ValueT>* array)
+{
+  ValueT* out = array->GetPointer(0);
+  const ValueT* in = data + static_cast<vtkIdType>(index) * numTuples;
+  vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      for (int c = 0; c < numComps; ++c)
+      {
+        out[i * numComps + c] = in[c * numTuples + i];
+      }
+    }
+  });
+}
+}
+
 // Begin of copy from phastaIO
 
 std::map<int, char*> LastHeaderKey;
@@ -592,7 +618,6 @@ void vtkPhastaReader::ReadGeomFile(
 
   /* variables for vtk */
   vtkUnstructuredGrid* output = this->GetOutput();
-  double* coordinates;
   vtkIdType* nodes;
   int cell_type;
 
@@ -658,48 +683,45 @@ void vtkPhastaReader::ReadGeomFile(
   }
   dim = array[1];
 
-  /* read the coordinates */
-
-  coordinates = new double[dim];
-  if (coordinates == nullptr)
+  if (dim < 1 || dim > 3)
   {
-    vtkErrorMacro(<< "Unable to allocate memory for nodal info");
+    vtkErrorMacro(<< "Unrecognized dimension in " << geomFileName);
     return;
   }
 
+  /* read the coordinates */
+
   pos = new double[num_nodes * dim];
   if (pos == nullptr)
   {
     vtkErrorMacro(<< "Unable to allocate memory for nodal info");
-    delete[] coordinates;
     return;
   }
 
   item = num_nodes * dim;
   readdatablock(&geomfile, "co-ordinates", pos, &item, "double", "binary");
 
-  for (i = 0; i < num_nodes; i++)
-  {
-    for (j = 0; j < dim; j++)
-    {
-      coordinates[j] = pos[j * num_nodes + i];
-    }
-    switch (dim)
+  // Coordinates are stored component by component, transpose them in
+  // parallel directly into the points array.
+  vtkNew<vtkDoubleArray> pointsArray;
+  pointsArray->SetNumberOfComponents(3);
+  pointsArray->SetNumberOfTuples(firstVertexNo + num_nodes);
+  double* outCoords = pointsArray->GetPointer(3 * static_cast<vtkIdType>(firstVertexNo));
+  const vtkIdType numNodes = num_nodes;
+  vtkSMPTools::For(0, numNodes, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType node = begin; node < end; ++node)
     {
-      case 1:
-        points->InsertPoint(i + firstVertexNo, coordinates[0], 0, 0);
-        break;
-      case 2:
-        points->InsertPoint(i + firstVertexNo, coordinates[0], coordinates[1], 0);
-        break;
-      case 3:
-        points->InsertNextPoint(coordinates);
-        break;
-      default:
-        vtkErrorMacro(<< "Unrecognized dimension in " << geomFileName);
-        return;
+      for (int comp = 0; comp < 3; ++comp)
+      {
+        outCoords[3 * node + comp] = comp < dim ? pos[comp * numNodes + node] : 0.0;
+      }
     }
+  });
+  if (firstVertexNo > 0 && points->GetNumberOfPoints() > 0)
+  {
+    pointsArray->InsertTuples(0, firstVertexNo, 0, points->GetData());
   }
+  points->SetData(pointsArray);
 
   /* read the connectivity information */
   expect = 7;
@@ -769,7 +791,6 @@ void vtkPhastaReader::ReadGeomFile(
 
   // clean up
   closefile(&geomfile, "read");
-  delete[] coordinates;
   delete[] pos;
   delete[] connectivity;
 }
@@ -835,15 +856,12 @@ void vtkPhastaReader::ReadFieldFile(
   pressure->SetNumberOfTuples(noOfNodes);
   velocity->SetNumberOfTuples(noOfNodes);
   temperature->SetNumberOfTuples(noOfNodes);
-  for (i = 0; i < noOfNodes; i++)
+  DecodeField(data, 0, 1, noOfNodes, pressure);
+  DecodeField(data, 1, 3, noOfNodes, velocity);
+  DecodeField(data, 4, 1, noOfNodes, temperature);
+  for (j = 5; j < this->NumberOfVariables; j++)
   {
-    pressure->SetTuple1(i, data[i]);
-    velocity->SetTuple3(i, data[noOfNodes + i], data[2 * noOfNodes + i], data[3 * noOfNodes + i]);
-    temperature->SetTuple1(i, data[4 * noOfNodes + i]);
-    for (j = 5; j < this->NumberOfVariables; j++)
-    {
-      sArrays[j - 5]->SetTuple1(i, data[j * noOfNodes + i]);
-    }
+    DecodeField(data, j, 1, noOfNodes, sArrays[j - 5]);
   }
 
   field->AddArray(pressure);
@@ -872,7 +890,7 @@ void vtkPhastaReader::ReadFieldFile(
   char* fieldFileName, int, vtkUnstructuredGrid* output, int& noOfDatas)
 {
 
-  int i, j, numOfVars;
+  int numOfVars;
   int item;
   int fieldfile;
 
@@ -956,6 +974,14 @@ void vtkPhastaReader::ReadFieldFile(
       continue;
     }
 
+    if (numOfComps != 1 && numOfComps != 3 && numOfComps != 9)
+    {
+      vtkErrorMacro("number of components [" << numOfComps << "] NOT supported");
+
+      dataArray->Delete();
+      continue;
+    }
+
     item = numOfVars * noOfDatas;
     if (dtype == 0)
     { // data is type double
@@ -972,69 +998,12 @@ void vtkPhastaReader::ReadFieldFile(
       }
 
       readdatablock(&fieldfile, phastaFieldTag, data, &item, dataType, "binary");
-
-      switch (numOfComps)
-      {
-        case 1:
-        {
-          int offset = index * noOfDatas;
-
-          if (!activeScalars)
-            field->SetActiveScalars(paraviewFieldTag);
-          else
-            activeScalars = 1;
-          for (i = 0; i < noOfDatas; i++)
-          {
-            dataArray->SetTuple1(i, data[offset + i]);
-          }
-        }
-        break;
-        case 3:
-        {
-          int offset[3];
-          for (j = 0; j < 3; j++)
-            offset[j] = (index + j) * noOfDatas;
-
-          if (!activeScalars)
-            field->SetActiveVectors(paraviewFieldTag);
-          else
-            activeScalars = 1;
-          for (i = 0; i < noOfDatas; i++)
-          {
-            dataArray->SetTuple3(i, data[offset[0] + i], data[offset[1] + i], data[offset[2] + i]);
-          }
-        }
-        break;
-        case 9:
-        {
-          int offset[9];
-          for (j = 0; j < 9; j++)
-            offset[j] = (index + j) * noOfDatas;
-
-          if (!activeTensors)
-            field->SetActiveTensors(paraviewFieldTag);
-          else
-            activeTensors = 1;
-          for (i = 0; i < noOfDatas; i++)
-          {
-            dataArray->SetTuple9(i, data[offset[0] + i], data[offset[1] + i], data[offset[2] + i],
-              data[offset[3] + i], data[offset[4] + i], data[offset[5] + i], data[offset[6] + i],
-              data[offset[7] + i], data[offset[8] + i]);
-          }
-        }
-        break;
-        default:
-          vtkErrorMacro("number of components [" << numOfComps << "] NOT supported");
-
-          dataArray->Delete();
-          delete[] data;
-          continue;
-      }
+      DecodeField(data, index, numOfComps, noOfDatas, vtkDoubleArray::SafeDownCast(dataArray));
 
       // clean up
       delete[] data;
     }
-    else if (dtype == 1)
+    else
     { // data is type float
 
       float* data;
@@ -1049,92 +1018,32 @@ void vtkPhastaReader::ReadFieldFile(
       }
 
       readdatablock(&fieldfile, phastaFieldTag, data, &item, dataType, "binary");
-
-      switch (numOfComps)
-      {
-        case 1:
-        {
-          int offset = index * noOfDatas;
-
-          if (!activeScalars)
-            field->SetActiveScalars(paraviewFieldTag);
-          else
-            activeScalars = 1;
-          for (i = 0; i < noOfDatas; i++)
-          {
-            // double tmpval = (double) data[offset+i];
-            // dataArray->SetTuple1(i, tmpval);
-            dataArray->SetTuple1(i, data[offset + i]);
-          }
-        }
-        break;
-        case 3:
-        {
-          int offset[3];
-          for (j = 0; j < 3; j++)
-            offset[j] = (index + j) * noOfDatas;
-
-          if (!activeScalars)
-            field->SetActiveVectors(paraviewFieldTag);
-          else
-            activeScalars = 1;
-          for (i = 0; i < noOfDatas; i++)
-          {
-            // double tmpval[3];
-            // for(j=0;j<3;j++)
-            //   tmpval[j] = (double) data[offset[j]+i];
-            // dataArray->SetTuple3(i,
-            //                    tmpval[0], tmpval[1], tmpval[3]);
-            dataArray->SetTuple3(i, data[offset[0] + i], data[offset[1] + i], data[offset[2] + i]);
-          }
-        }
-        break;
-        case 9:
-        {
-          int offset[9];
-          for (j = 0; j < 9; j++)
-            offset[j] = (index + j) * noOfDatas;
-
-          if (!activeTensors)
-            field->SetActiveTensors(paraviewFieldTag);
-          else
-            activeTensors = 1;
-          for (i = 0; i < noOfDatas; i++)
-          {
-            // double tmpval[9];
-            // for(j=0;j<9;j++)
-            //   tmpval[j] = (double) data[offset[j]+i];
-            // dataArray->SetTuple9(i,
-            //                     tmpval[0],
-            //                     tmpval[1],
-            //                     tmpval[2],
-            //                     tmpval[3],
-            //                     tmpval[4],
-            //                     tmpval[5],
-            //                     tmpval[6],
-            //                     tmpval[7],
-            //                     tmpval[8]);
-            dataArray->SetTuple9(i, data[offset[0] + i], data[offset[1] + i], data[offset[2] + i],
-              data[offset[3] + i], data[offset[4] + i], data[offset[5] + i], data[offset[6] + i],
-              data[offset[7] + i], data[offset[8] + i]);
-          }
-        }
-        break;
-        default:
-          vtkErrorMacro("number of components [" << numOfComps << "] NOT supported");
-
-          dataArray->Delete();
-          delete[] data;
-          continue;
-      }
+      DecodeField(data, index, numOfComps, noOfDatas, vtkFloatArray::SafeDownCast(dataArray));
 
       // clean up
       delete[] data;
     }
-    else
+
+    switch (numOfComps)
     {
-      vtkErrorMacro("Data type [" << dataType << "] NOT supported");
-      continue;
+      case 1:
+        if (!activeScalars)
+          field->SetActiveScalars(paraviewFieldTag);
+        else
+          activeScalars = 1;
+        break;
+      case 3:
+        if (!activeScalars)
+          field->SetActiveVectors(paraviewFieldTag);
+        else
+          activeScalars = 1;
+        break;
+      default:
+        if (!activeTensors)
+          field->SetActiveTensors(paraviewFieldTag);
+        else
+          activeTensors = 1;
+        break;
     }
 
     field->AddArray(dataArray);
@@ -6,25 +6,43 @@
 #include "vtkPCGNSWriter.h"
 
 #include "vtkAppendDataSets.h"
+#include "vtkCellData.h"
 #include "vtkDataObject.h"
 #include "vtkDataObjectTreeIterator.h"
 #include "vtkDoubleArray.h"
+#include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkLogger.h"
+#include "vtkMPI.h"
+#include "vtkMPICommunicator.h"
 #include "vtkMPIController.h"
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiPieceDataSet.h"
 #include "vtkMultiProcessController.h"
+#include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPartitionedDataSet.h"
 #include "vtkPartitionedDataSetCollection.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkUnstructuredGrid.h"
+
+#ifdef CGNS_HAS_PARALLEL
+// clang-format off
+#include "vtk_cgns.h"
+#include VTK_CGNS(cgnslib.h)
+#include VTK_CGNS(pcgnslib.h)
+// clang-format on
+#endif
 
 #include <map>
 #include <sstream>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -177,6 +195,438 @@ void Flatten(const vtkSmartPointer<vtkPartitionedDataSetCollection>& mergedPCD,
   }
 }
 
+#ifdef CGNS_HAS_PARALLEL
+// macro to check a CGNS operation that can return CG_OK or CG_ERROR
+// the macro will set the 'error' (string) variable to the CGNS error
+// and return false.
+#define cg_check_operation(op)                                                                     \
+  if (CG_OK != (op))                                                                               \
+  {                                                                                                \
+    error = std::string(__FUNCTION__) + ":" + std::to_string(__LINE__) + "> " + cg_get_error();    \
+    return false;                                                                                  \
+  }
+
+// CGNS starts counting at 1
+#define CGNS_COUNTING_OFFSET 1
+
+//------------------------------------------------------------------------------
+// Element sections that can be written with the collective API. Only element
+// types with a fixed number of nodes are supported by cgp_elements_write_data,
+// polygons and polyhedra are written by gathering on the first process.
+struct ParallelSection
+{
+  unsigned char CellType;
+  CGNS_ENUMT(ElementType_t) ElementType;
+  const char* Name;
+};
+
+const ParallelSection ParallelSections[] = {
+  { VTK_TRIANGLE, CGNS_ENUMV(TRI_3), "Elem_Triangles" },
+  { VTK_QUAD, CGNS_ENUMV(QUAD_4), "Elem_Quads" },
+  { VTK_TETRA, CGNS_ENUMV(TETRA_4), "Elem_Tetras" },
+  { VTK_HEXAHEDRON, CGNS_ENUMV(HEXA_8), "Elem_Hexas" },
+  { VTK_WEDGE, CGNS_ENUMV(PENTA_6), "Elem_Wedges" },
+  { VTK_PYRAMID, CGNS_ENUMV(PYRA_5), "Elem_Pyramids" },
+};
+
+constexpr int NumberOfParallelSections =
+  static_cast<int>(sizeof(ParallelSections) / sizeof(ParallelSections[0]));
+
+//------------------------------------------------------------------------------
+int GetParallelSection(unsigned char cellType)
+{
+  for (int s = 0; s < NumberOfParallelSections; ++s)
+  {
+    if (ParallelSections[s].CellType == cellType)
+    {
+      return s;
+    }
+  }
+  return -1;
+}
+
+// name and number of components of the arrays written to a flow solution
+using FieldList = std::vector<std::pair<std::string, int>>;
+
+//------------------------------------------------------------------------------
+FieldList GetFieldList(vtkDataSetAttributes* dsa)
+{
+  FieldList fields;
+  for (int i = 0; i < dsa->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* da = dsa->GetArray(i);
+    if (da && da->GetName() &&
+      (da->GetNumberOfComponents() == 1 || da->GetNumberOfComponents() == 3))
+    {
+      fields.emplace_back(da->GetName(), da->GetNumberOfComponents());
+    }
+  }
+  return fields;
+}
+
+//------------------------------------------------------------------------------
+// Collective check whether the piece on every process can be written with the
+// collective CGNS API. All processes must issue the same sequence of collective
+// calls, so the arrays to write are taken from the first non-empty piece and
+// broadcast; non-empty pieces with other arrays make the whole write fall back
+// to gathering on the first process.
+bool CanWriteInParallel(
+  vtkMPIController* controller, vtkPointSet* grid, FieldList& cellFields, FieldList& pointFields)
+{
+  if (!grid || !(grid->IsA("vtkUnstructuredGrid") || grid->IsA("vtkPolyData")))
+  {
+    return false;
+  }
+
+  int supported = 1;
+  for (vtkIdType i = 0; i < grid->GetNumberOfCells() && supported; ++i)
+  {
+    supported = GetParallelSection(static_cast<unsigned char>(grid->GetCellType(i))) >= 0;
+  }
+
+  const int nRanks = controller->GetNumberOfProcesses();
+  const vtkIdType localSize = grid->GetNumberOfPoints() + grid->GetNumberOfCells();
+  std::vector<vtkIdType> sizes(nRanks, 0);
+  controller->AllGather(&localSize, sizes.data(), 1);
+
+  int reference = 0;
+  while (reference < nRanks && sizes[reference] == 0)
+  {
+    ++reference;
+  }
+  if (reference == nRanks)
+  {
+    // nothing to write anywhere
+    return false;
+  }
+
+  cellFields = GetFieldList(grid->GetCellData());
+  pointFields = GetFieldList(grid->GetPointData());
+
+  vtkMultiProcessStream stream;
+  if (controller->GetLocalProcessId() == reference)
+  {
+    for (const FieldList* fields : { &cellFields, &pointFields })
+    {
+      stream << static_cast<int>(fields->size());
+      for (const auto& field : *fields)
+      {
+        stream << field.first << field.second;
+      }
+    }
+  }
+  controller->Broadcast(stream, reference);
+
+  FieldList referenceFields[2];
+  for (FieldList& fields : referenceFields)
+  {
+    int nFields = 0;
+    stream >> nFields;
+    fields.resize(nFields);
+    for (auto& field : fields)
+    {
+      stream >> field.first >> field.second;
+    }
+  }
+
+  if (localSize > 0 && (cellFields != referenceFields[0] || pointFields != referenceFields[1]))
+  {
+    supported = 0;
+  }
+  cellFields = referenceFields[0];
+  pointFields = referenceFields[1];
+
+  int allSupported = 0;
+  controller->AllReduce(&supported, &allSupported, 1, vtkCommunicator::MIN_OP);
+  return allSupported == 1;
+}
+
+// Range of a flow solution owned by this process. Ids lists the local
+// tuples in file order, a null list means tuples 0..Count-1.
+struct SolutionRange
+{
+  cgsize_t Min;
+  cgsize_t Max;
+  cgsize_t Count;
+  const std::vector<vtkIdType>* Ids;
+};
+
+//------------------------------------------------------------------------------
+bool WriteParallelFields(int F, int B, int Z, const char* solutionName,
+  CGNS_ENUMT(GridLocation_t) location, vtkDataSetAttributes* dsa, const FieldList& fields,
+  const std::vector<SolutionRange>& ranges, std::map<std::string, int>& solutionNames,
+  std::string& error)
+{
+  if (fields.empty())
+  {
+    return true;
+  }
+
+  int S(0);
+  cg_check_operation(cg_sol_write(F, B, Z, solutionName, location, &S));
+  solutionNames.emplace(solutionName, S);
+
+  const char* const components[3] = { "X", "Y", "Z" };
+  std::vector<double> temp;
+  for (const auto& field : fields)
+  {
+    vtkDataArray* da = dsa->GetArray(field.first.c_str());
+    for (int idx = 0; idx < field.second; ++idx)
+    {
+      const std::string fieldName =
+        field.second == 1 ? field.first : field.first + components[idx];
+
+      int fieldIndex(0);
+      cg_check_operation(
+        cgp_field_write(F, B, Z, S, CGNS_ENUMV(RealDouble), fieldName.c_str(), &fieldIndex));
+
+      // force to double precision, same as the serial writer
+      for (const auto& range : ranges)
+      {
+        temp.resize(range.Count);
+        for (cgsize_t t = 0; da && t < range.Count; ++t)
+        {
+          const vtkIdType tupleId = range.Ids ? (*range.Ids)[t] : t;
+          temp[t] = da->GetComponent(tupleId, idx);
+        }
+        cg_check_operation(cgp_field_write_data(F, B, Z, S, fieldIndex, &range.Min, &range.Max,
+          range.Count > 0 && da ? temp.data() : nullptr));
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool WriteParallelTimeInformation(
+  int F, int B, int Z, double timeStep, const std::map<std::string, int>& solutionNames,
+  std::string& error)
+{
+  double time[1] = { timeStep };
+  cg_check_operation(cg_biter_write(F, B, "TimeIterValues", 1));
+  cg_check_operation(cg_goto(F, B, "BaseIterativeData_t", 1, "end"));
+  cgsize_t dimTimeValues[1] = { 1 };
+  cg_check_operation(cg_array_write("TimeValues", CGNS_ENUMV(RealDouble), 1, dimTimeValues, time));
+  cg_check_operation(cg_simulation_type_write(F, B, CGNS_ENUMV(TimeAccurate)));
+
+  if (solutionNames.empty())
+  {
+    return true;
+  }
+
+  cgsize_t dim[2] = { 32, 1 };
+  cg_check_operation(cg_ziter_write(F, B, Z, "ZoneIterativeData_t"));
+  cg_check_operation(cg_goto(F, B, "Zone_t", Z, "ZoneIterativeData_t", 1, "end"));
+
+  auto at = solutionNames.find("CellData");
+  if (at != solutionNames.end())
+  {
+    int sol[1] = { at->second };
+    const char* timeStepNames = "CellData\0                       ";
+    cg_check_operation(
+      cg_array_write("FlowSolutionCellPointers", CGNS_ENUMV(Character), 2, dim, timeStepNames));
+    cg_check_operation(cg_array_write("CellCenterIndices", CGNS_ENUMV(Integer), 1, &dim[1], sol));
+    cg_check_operation(cg_descriptor_write("CellCenterPrefix", "CellCenter"));
+  }
+
+  at = solutionNames.find("PointData");
+  if (at != solutionNames.end())
+  {
+    int sol[1] = { at->second };
+    const char* timeStepNames = "PointData\0                      ";
+    cg_check_operation(
+      cg_array_write("FlowSolutionVertexPointers", CGNS_ENUMV(Character), 2, dim, timeStepNames));
+    cg_check_operation(
+      cg_array_write("VertexSolutionIndices", CGNS_ENUMV(Integer), 1, &dim[1], sol));
+    cg_check_operation(cg_descriptor_write("VertexPrefix", "Vertex"));
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Write the pieces of all processes to a single unstructured zone of the open
+// file `F` with the collective CGNS API. Every process writes its own range of
+// the coordinates, of each element section and of each flow solution. The
+// ranges follow from an exclusive scan of the local point and cell counts.
+// Points on partition boundaries are not merged.
+bool WriteParallelZone(vtkMPIController* controller, int F, vtkPointSet* grid, double timeStep,
+  const FieldList& cellFields, const FieldList& pointFields, std::string& error)
+{
+  const int nRanks = controller->GetNumberOfProcesses();
+  const int rank = controller->GetLocalProcessId();
+
+  // group the local cells per section, in the same section order on every process
+  std::vector<std::vector<vtkIdType>> sectionCells(NumberOfParallelSections);
+  int cellDim = grid->IsA("vtkPolyData") ? 2 : 1;
+  for (vtkIdType i = 0; i < grid->GetNumberOfCells(); ++i)
+  {
+    const unsigned char cellType = static_cast<unsigned char>(grid->GetCellType(i));
+    sectionCells[GetParallelSection(cellType)].push_back(i);
+    if (cellType != VTK_TRIANGLE && cellType != VTK_QUAD)
+    {
+      cellDim = 3;
+    }
+    else if (cellDim < 2)
+    {
+      cellDim = 2;
+    }
+  }
+  int globalCellDim = cellDim;
+  controller->AllReduce(&cellDim, &globalCellDim, 1, vtkCommunicator::MAX_OP);
+
+  // exclusive scan of [points, cells of section 0, ..., cells of section N-1]
+  const int nCounts = 1 + NumberOfParallelSections;
+  std::vector<vtkIdType> localCounts(nCounts);
+  localCounts[0] = grid->GetNumberOfPoints();
+  for (int s = 0; s < NumberOfParallelSections; ++s)
+  {
+    localCounts[1 + s] = static_cast<vtkIdType>(sectionCells[s].size());
+  }
+  std::vector<vtkIdType> allCounts(nCounts * nRanks);
+  controller->AllGather(localCounts.data(), allCounts.data(), nCounts);
+
+  std::vector<vtkIdType> offsets(nCounts, 0);
+  std::vector<vtkIdType> totals(nCounts, 0);
+  for (int r = 0; r < nRanks; ++r)
+  {
+    for (int c = 0; c < nCounts; ++c)
+    {
+      if (r < rank)
+      {
+        offsets[c] += allCounts[r * nCounts + c];
+      }
+      totals[c] += allCounts[r * nCounts + c];
+    }
+  }
+  vtkIdType totalCells = 0;
+  for (int s = 0; s < NumberOfParallelSections; ++s)
+  {
+    totalCells += totals[1 + s];
+  }
+
+  int B(0), Z(0);
+  cg_check_operation(cg_base_write(F, "Base", globalCellDim, 3, &B));
+
+  cgsize_t dim[3] = { static_cast<cgsize_t>(totals[0]), static_cast<cgsize_t>(totalCells), 0 };
+  cg_check_operation(cg_zone_write(F, B, "Zone 1", dim, CGNS_ENUMV(Unstructured), &Z));
+
+  // coordinates
+  const cgsize_t nPts = static_cast<cgsize_t>(localCounts[0]);
+  const cgsize_t pointMin = static_cast<cgsize_t>(offsets[0] + CGNS_COUNTING_OFFSET);
+  const cgsize_t pointMax = pointMin + nPts - 1;
+  const char* names[3] = { "CoordinateX", "CoordinateY", "CoordinateZ" };
+  std::vector<double> temp(nPts);
+  for (int idx = 0; idx < 3; ++idx)
+  {
+    for (cgsize_t i = 0; i < nPts; ++i)
+    {
+      temp[i] = grid->GetPoint(i)[idx];
+    }
+    int C(0);
+    cg_check_operation(cgp_coord_write(F, B, Z, CGNS_ENUMV(RealDouble), names[idx], &C));
+    cg_check_operation(cgp_coord_write_data(
+      F, B, Z, C, &pointMin, &pointMax, nPts > 0 ? temp.data() : nullptr));
+  }
+
+  // element sections, connectivity is offset by the global index of the first local point
+  std::vector<SolutionRange> cellRanges;
+  vtkNew<vtkIdList> ptIds;
+  std::vector<cgsize_t> connectivity;
+  cgsize_t sectionStart(CGNS_COUNTING_OFFSET);
+  for (int s = 0; s < NumberOfParallelSections; ++s)
+  {
+    const cgsize_t sectionSize = static_cast<cgsize_t>(totals[1 + s]);
+    if (sectionSize == 0)
+    {
+      continue;
+    }
+
+    int S(0);
+    cg_check_operation(cgp_section_write(F, B, Z, ParallelSections[s].Name,
+      ParallelSections[s].ElementType, sectionStart, sectionStart + sectionSize - 1, 0, &S));
+
+    connectivity.clear();
+    for (vtkIdType cellId : sectionCells[s])
+    {
+      grid->GetCellPoints(cellId, ptIds);
+      for (vtkIdType j = 0; j < ptIds->GetNumberOfIds(); ++j)
+      {
+        connectivity.push_back(
+          static_cast<cgsize_t>(ptIds->GetId(j) + offsets[0] + CGNS_COUNTING_OFFSET));
+      }
+    }
+
+    const cgsize_t nCells = static_cast<cgsize_t>(sectionCells[s].size());
+    const cgsize_t cellMin = sectionStart + static_cast<cgsize_t>(offsets[1 + s]);
+    const cgsize_t cellMax = cellMin + nCells - 1;
+    cg_check_operation(cgp_elements_write_data(
+      F, B, Z, S, cellMin, cellMax, nCells > 0 ? connectivity.data() : nullptr));
+
+    cellRanges.push_back({ cellMin, cellMax, nCells, &sectionCells[s] });
+    sectionStart += sectionSize;
+  }
+
+  std::map<std::string, int> solutionNames;
+  const std::vector<SolutionRange> pointRanges = { { pointMin, pointMax, nPts, nullptr } };
+  return WriteParallelFields(F, B, Z, "CellData", CGNS_ENUMV(CellCenter), grid->GetCellData(),
+           cellFields, cellRanges, solutionNames, error) &&
+    WriteParallelFields(F, B, Z, "PointData", CGNS_ENUMV(Vertex), grid->GetPointData(),
+      pointFields, pointRanges, solutionNames, error) &&
+    WriteParallelTimeInformation(F, B, Z, timeStep, solutionNames, error);
+}
+
+//------------------------------------------------------------------------------
+// Returns true on all processes if `success` is true on all of them. When it
+// is true locally but not on another process, `error` says so.
+bool AllSucceeded(vtkMPIController* controller, bool success, std::string& error)
+{
+  int local = success ? 1 : 0;
+  int global = 0;
+  controller->AllReduce(&local, &global, 1, vtkCommunicator::MIN_OP);
+  if (success && !global)
+  {
+    error = "writing failed on another process.";
+  }
+  return global != 0;
+}
+
+//------------------------------------------------------------------------------
+// Write the pieces of all processes to a single unstructured zone with the
+// collective CGNS API, see WriteParallelZone(). The file is closed on all
+// processes whatever happened, and the result is the same on all processes,
+// so that none of them is left waiting in a collective call.
+bool WriteParallelPointSet(vtkMPIController* controller, vtkPointSet* grid,
+  const char* fileName, double timeStep, const FieldList& cellFields,
+  const FieldList& pointFields, std::string& error)
+{
+  vtkMPICommunicator* communicator =
+    vtkMPICommunicator::SafeDownCast(controller->GetCommunicator());
+  int F(0);
+  bool opened = CG_OK == cgp_mpi_comm(*communicator->GetMPIComm()->GetHandle()) &&
+    CG_OK == cgp_open(fileName, CG_MODE_WRITE, &F);
+  if (!opened)
+  {
+    error = std::string(__FUNCTION__) + ":" + std::to_string(__LINE__) + "> " + cg_get_error();
+  }
+  if (!::AllSucceeded(controller, opened, error))
+  {
+    if (opened)
+    {
+      cgp_close(F);
+    }
+    return false;
+  }
+
+  bool success = ::WriteParallelZone(controller, F, grid, timeStep, cellFields, pointFields, error);
+  if (CG_OK != cgp_close(F) && success)
+  {
+    error = std::string(__FUNCTION__) + ":" + std::to_string(__LINE__) + "> " + cg_get_error();
+    success = false;
+  }
+  return ::AllSucceeded(controller, success, error);
+}
+#endif
+
 } // anonymous namespace
 
 //------------------------------------------------------------------------------
@@ -217,12 +667,28 @@ vtkMultiProcessController* vtkPCGNSWriter::GetController()
   return this->Controller;
 };
 
+//------------------------------------------------------------------------------
+bool vtkPCGNSWriter::IsParallelIOAvailable()
+{
+#ifdef CGNS_HAS_PARALLEL
+  return true;
+#else
+  return false;
+#endif
+}
+
 //------------------------------------------------------------------------------
 void vtkPCGNSWriter::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
   os << indent << "Number of pieces " << this->NumberOfPieces << endl;
   os << indent << "Request piece " << this->RequestPiece << endl;
+  os << indent << "Used parallel I/O: " << (this->UsedParallelIO ? "yes" : "no") << endl;
+#ifdef CGNS_HAS_PARALLEL
+  os << indent << "Parallel I/O available: yes" << endl;
+#else
+  os << indent << "Parallel I/O available: no" << endl;
+#endif
   os << indent << "Controller ";
   if (this->Controller)
   {
@@ -292,7 +758,46 @@ void vtkPCGNSWriter::WriteData()
   }
 
   this->WasWritingSuccessful = false;
+  this->UsedParallelIO = false;
+
+  if (this->UseParallelIO)
+  {
+#ifdef CGNS_HAS_PARALLEL
+    // collective I/O requires HDF5 and is limited to point sets with
+    // fixed-size element types, other inputs are gathered below.
+    FieldList cellFields;
+    FieldList pointFields;
+    vtkPointSet* grid = vtkPointSet::SafeDownCast(this->OriginalInput);
+    if (this->UseHDF5 && ::CanWriteInParallel(mpicontroller, grid, cellFields, pointFields))
+    {
+      vtkLogF(TRACE, "writing with collective I/O");
+      this->UsedParallelIO = true;
+      std::string fileName;
+      double timeStep(0.0);
+      if (this->GetCurrentFileName(fileName, timeStep))
+      {
+        std::string error;
+        this->WasWritingSuccessful = ::WriteParallelPointSet(
+          mpicontroller, grid, fileName.c_str(), timeStep, cellFields, pointFields, error);
+        if (!this->WasWritingSuccessful)
+        {
+          vtkErrorMacro(<< " Writing failed: " << error);
+        }
+      }
+
+      if (!this->WriteAllTimeSteps && this->TimeValues)
+      {
+        this->TimeValues->Delete();
+        this->TimeValues = nullptr;
+      }
+      return;
+    }
+#else
+    vtkDebugMacro(<< "CGNS was built without parallel I/O support, gathering on process 0.");
+#endif
+  }
 
+  vtkLogF(TRACE, "gathering on process 0 to write with serial I/O");
   std::vector<vtkSmartPointer<vtkDataObject>> collected;
   // what happens in the Gather step is that each part is
   // serialized on its processor using vtkUnstructuredGridWriter
@@ -24,6 +24,15 @@
  * is not implemented for all cell types (notably not for
  * VTK_POLYGON or for VTK_POLYHEDRON).
  *
+ * When UseParallelIO is ON and the CGNS library is built with parallel
+ * support, unstructured grids and polydata that only contain fixed-size
+ * element types are written with collective CGNS/HDF5 I/O instead. Each
+ * process then writes its own range of coordinates, elements and fields
+ * directly, with offsets computed by an exclusive scan of the local counts.
+ * Points shared between processes are not merged in that mode. Other inputs
+ * fall back to the serial I/O approach. GetUsedParallelIO() tells which of
+ * the two approaches the last write used.
+ *
  */
 
 #ifndef vtkPCGNSWriter_h
@@ -50,6 +59,18 @@ public:
   virtual vtkMultiProcessController* GetController();
   ///@}
 
+  /**
+   * Returns true if the CGNS library was built with parallel I/O support,
+   * i.e. if UseParallelIO can have any effect.
+   */
+  static bool IsParallelIOAvailable();
+
+  /**
+   * Returns true if the last write used collective I/O, false if it gathered
+   * the data and wrote it with serial I/O.
+   */
+  vtkGetMacro(UsedParallelIO, bool);
+
 protected:
   vtkPCGNSWriter();
   ~vtkPCGNSWriter() override = default;
@@ -67,6 +88,7 @@ protected:
 
   int NumberOfPieces = 0;
   int RequestPiece = -1;
+  bool UsedParallelIO = false;
 
   vtkSmartPointer<vtkMultiProcessController> Controller;
 
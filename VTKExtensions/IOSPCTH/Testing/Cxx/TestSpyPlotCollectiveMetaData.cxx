@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompositeDataSet.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkSpyPlotReader.h"
+#include "vtkSpyPlotUniReader.h"
+#include "vtkTestUtilities.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+// The deck is made of spcth_a.0 to spcth_a.3.
+constexpr int NumberOfFiles = 4;
+
+void Read(const std::string& fname, vtkMultiProcessController* controller, bool collective,
+  vtkIdType& numberOfCells, double bounds[6])
+{
+  vtkNew<vtkSpyPlotReader> reader;
+  reader->SetGlobalController(controller);
+  reader->SetCollectiveMetaData(collective ? 1 : 0);
+  reader->SetFileName(fname.c_str());
+  reader->Update();
+
+  numberOfCells = 0;
+  if (auto output = vtkCompositeDataSet::SafeDownCast(reader->GetOutputDataObject(0)))
+  {
+    numberOfCells = output->GetNumberOfCells();
+    output->GetBounds(bounds);
+  }
+}
+}
+
+int TestSpyPlotCollectiveMetaData(int argc, char* argv[])
+{
+  vtkNew<vtkMPIController> controller;
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+  const int rank = controller->GetLocalProcessId();
+  const int numProcs = controller->GetNumberOfProcesses();
+
+  char* data = vtkTestUtilities::ExpandDataFileName(
+    argc, argv, "Testing/Data/SPCTH/Dave_Karelitz_Small/spcth_a.0");
+  const std::string fname = data;
+  delete[] data;
+
+  int success = 1;
+
+  // with an empty cache, each rank parses its share of the files only; the
+  // meta-data of the others is received from the ranks that parsed them.
+  vtkSpyPlotUniReader::ClearInformationCache();
+  vtkIdType collectiveCells;
+  double collectiveBounds[6] = { 0, 0, 0, 0, 0, 0 };
+  ::Read(fname, controller, true, collectiveCells, collectiveBounds);
+  const int share = NumberOfFiles * (rank + 1) / numProcs - NumberOfFiles * rank / numProcs;
+  if (vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries() != share)
+  {
+    std::cerr << "Rank " << rank << " parsed "
+              << vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries()
+              << " files instead of " << share << "." << std::endl;
+    success = 0;
+  }
+
+  vtkSpyPlotUniReader::ClearInformationCache();
+  vtkIdType cells;
+  double bounds[6] = { 0, 0, 0, 0, 0, 0 };
+  ::Read(fname, controller, false, cells, bounds);
+  if (cells == 0 || cells != collectiveCells)
+  {
+    std::cerr << "Rank " << rank << " read " << collectiveCells
+              << " cells with collective meta-data instead of " << cells << "." << std::endl;
+    success = 0;
+  }
+  for (int cc = 0; cc < 6; ++cc)
+  {
+    if (bounds[cc] != collectiveBounds[cc])
+    {
+      std::cerr << "Rank " << rank << " bounds differ with collective meta-data." << std::endl;
+      success = 0;
+      break;
+    }
+  }
+  vtkSpyPlotUniReader::ClearInformationCache();
+
+  int allSuccess = 0;
+  controller->AllReduce(&success, &allSuccess, 1, vtkCommunicator::MIN_OP);
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  return allSuccess ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompositeDataSet.h"
+#include "vtkDummyController.h"
+#include "vtkNew.h"
+#include "vtkSpyPlotReader.h"
+#include "vtkSpyPlotUniReader.h"
+#include "vtkTestUtilities.h"
+
+#include <iostream>
+#include <string>
+
+namespace
+{
+// The deck is made of spcth_a.0 to spcth_a.3.
+constexpr int NumberOfFiles = 4;
+
+struct Summary
+{
+  vtkIdType NumberOfCells = 0;
+  double Bounds[6] = { 0, 0, 0, 0, 0, 0 };
+
+  bool operator==(const Summary& other) const
+  {
+    for (int cc = 0; cc < 6; ++cc)
+    {
+      if (this->Bounds[cc] != other.Bounds[cc])
+      {
+        return false;
+      }
+    }
+    return this->NumberOfCells == other.NumberOfCells;
+  }
+};
+
+Summary Read(const std::string& fname, vtkMultiProcessController* controller, bool cache)
+{
+  vtkNew<vtkSpyPlotReader> reader;
+  reader->SetGlobalController(controller);
+  reader->SetCacheMetaData(cache ? 1 : 0);
+  reader->SetFileName(fname.c_str());
+  reader->Update();
+
+  Summary summary;
+  if (auto output = vtkCompositeDataSet::SafeDownCast(reader->GetOutputDataObject(0)))
+  {
+    summary.NumberOfCells = output->GetNumberOfCells();
+    output->GetBounds(summary.Bounds);
+  }
+  return summary;
+}
+
+bool Check(bool condition, const char* message)
+{
+  if (!condition)
+  {
+    std::cerr << "ERROR: " << message << " (" << vtkSpyPlotUniReader::GetInformationCacheSize()
+              << " bytes in " << vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries()
+              << " entries)" << std::endl;
+  }
+  return condition;
+}
+}
+
+int TestSpyPlotMetaDataCache(int argc, char* argv[])
+{
+  char* data = vtkTestUtilities::ExpandDataFileName(
+    argc, argv, "Testing/Data/SPCTH/Dave_Karelitz_Small/spcth_a.0");
+  const std::string fname = data;
+  delete[] data;
+
+  vtkNew<vtkDummyController> controller;
+  vtkMultiProcessController::SetGlobalController(controller);
+  vtkSpyPlotUniReader::ClearInformationCache();
+
+  const Summary uncached = ::Read(fname, controller, false);
+  bool success = Check(uncached.NumberOfCells > 0, "Nothing was read.");
+  success &= Check(vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries() == 0,
+    "Meta-data was cached with CacheMetaData off.");
+
+  // first read fills the cache, second read uses it.
+  success &= Check(::Read(fname, controller, true) == uncached, "Output differs with the cache.");
+  success &= Check(vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries() == NumberOfFiles,
+    "Meta-data of all files should be cached.");
+  const size_t size = vtkSpyPlotUniReader::GetInformationCacheSize();
+  success &= Check(::Read(fname, controller, true) == uncached,
+    "Output differs when reading from the cache.");
+  success &= Check(vtkSpyPlotUniReader::GetInformationCacheSize() == size,
+    "Cache grew when reading cached meta-data.");
+
+  // the cache is bounded: least recently used entries are discarded.
+  const size_t limit = vtkSpyPlotUniReader::GetInformationCacheLimit();
+  vtkSpyPlotUniReader::SetInformationCacheLimit(size / 2);
+  success &= Check(vtkSpyPlotUniReader::GetInformationCacheSize() <= size / 2 &&
+      vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries() < NumberOfFiles,
+    "Cache exceeds its limit.");
+  success &= Check(::Read(fname, controller, true) == uncached,
+    "Output differs with a partially filled cache.");
+  success &= Check(vtkSpyPlotUniReader::GetInformationCacheSize() <= size / 2,
+    "Cache exceeds its limit after a read.");
+
+  vtkSpyPlotUniReader::SetInformationCacheLimit(0);
+  success &= Check(
+    vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries() == 0, "Cache should be empty.");
+  vtkSpyPlotUniReader::SetInformationCacheLimit(limit);
+
+  ::Read(fname, controller, true);
+  vtkSpyPlotUniReader::ClearInformationCache();
+  success &= Check(vtkSpyPlotUniReader::GetInformationCacheSize() == 0 &&
+      vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries() == 0,
+    "Cache should be empty after ClearInformationCache().");
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
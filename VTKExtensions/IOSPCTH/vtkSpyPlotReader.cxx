@@ -95,6 +95,8 @@ vtkSpyPlotReader::vtkSpyPlotReader()
   this->SetGlobalController(vtkMultiProcessController::GetGlobalController());
 
   this->DistributeFiles = 0;          // by default, distribute blocks, not files.
+  this->CacheMetaData = 1;            // by default, cache parsed meta-data.
+  this->CollectiveMetaData = 0;       // by default, each process parses headers.
   this->GenerateLevelArray = 0;       // by default, do not generate level array.
   this->GenerateBlockIdArray = 0;     // by default, do not generate block id array.
   this->GenerateActiveBlockArray = 0; // by default do not generate active array
@@ -321,6 +323,12 @@ int vtkSpyPlotReader::UpdateFile(vtkInformation* request, vtkInformationVector*
     {
       this->Map->Load(stream);
     }
+    // When distributing blocks, every process needs the meta-data of every
+    // file. Share the parsing work instead of opening all files everywhere.
+    if (this->CollectiveMetaData && !this->DistributeFiles && !this->Map->Files.empty())
+    {
+      this->Map->ExchangeInformation(this->GlobalController, this);
+    }
   }
 
   return this->Map->Files.empty() ? 0 : this->UpdateMetaData(request, outputVector);
@@ -1403,6 +1411,9 @@ void vtkSpyPlotReader::PrintSelf(ostream& os, vtkIndent indent)
     os << "false" << endl;
   }
 
+  os << "CacheMetaData: " << (this->CacheMetaData ? "true" : "false") << endl;
+  os << "CollectiveMetaData: " << (this->CollectiveMetaData ? "true" : "false") << endl;
+
   os << "DownConvertVolumeFraction: ";
   if (this->DownConvertVolumeFraction)
   {
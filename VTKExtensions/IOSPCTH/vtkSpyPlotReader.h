@@ -99,6 +99,32 @@ public:
   vtkBooleanMacro(DistributeFiles, int);
   ///@}
 
+  ///@{
+  /**
+   * If true, the meta-data parsed from each file (headers, block tables and
+   * variable offsets) is kept in a process-wide cache, so that it is not
+   * parsed again when the time step changes, when the file name is set again
+   * or when another reader opens the same files. Cache entries are
+   * invalidated when a file is modified. True by default.
+   */
+  vtkSetMacro(CacheMetaData, int);
+  vtkGetMacro(CacheMetaData, int);
+  vtkBooleanMacro(CacheMetaData, int);
+  ///@}
+
+  ///@{
+  /**
+   * If true and blocks are distributed (see DistributeFiles), the files'
+   * meta-data is parsed collectively: each process reads the headers of a
+   * share of the files and the results are exchanged with a single
+   * all-gather instead of every process opening every file.
+   * False by default.
+   */
+  vtkSetMacro(CollectiveMetaData, int);
+  vtkGetMacro(CollectiveMetaData, int);
+  vtkBooleanMacro(CollectiveMetaData, int);
+  ///@}
+
   ///@{
   /**
    * If true, the reader generate a cell array in each block that
@@ -362,6 +388,8 @@ protected:
   vtkSpyPlotReaderMap* Map;
 
   int DistributeFiles;
+  int CacheMetaData;
+  int CollectiveMetaData;
 
   vtkBoundingBox* Bounds;    // bounds of the hierarchy without the bad ghostcells.
   int BoxSize[3];            // size of boxes if they are all the same, else -1,-1,-1
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Kitware Inc.
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkSpyPlotReaderMap.h"
+#include "vtkMultiProcessController.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkSpyPlotReader.h"
 #include "vtkSpyPlotUniReader.h"
@@ -9,6 +10,9 @@
 #include "vtksys/SystemTools.hxx"
 
 #include <cassert>
+#include <iterator>
+#include <numeric>
+#include <utility>
 
 namespace
 {
@@ -127,6 +131,7 @@ vtkSpyPlotUniReader* vtkSpyPlotReaderMap::GetReader(
   {
     it->second = vtkSpyPlotUniReader::New();
     it->second->SetCellArraySelection(parent->GetCellDataArraySelection());
+    it->second->SetUseInformationCache(parent->GetCacheMetaData() != 0);
     it->second->SetFileName(it->first.c_str());
     // cout << parent->GetController()->GetLocalProcessId()
     // << "Create reader: " << it->second << endl;
@@ -145,6 +150,92 @@ void vtkSpyPlotReaderMap::TellReadersToCheck(vtkSpyPlotReader* parent)
   }
 }
 
+//-----------------------------------------------------------------------------
+bool vtkSpyPlotReaderMap::ExchangeInformation(
+  vtkMultiProcessController* controller, vtkSpyPlotReader* parent)
+{
+  const int numProcs = controller->GetNumberOfProcesses();
+  const int procId = controller->GetLocalProcessId();
+  const size_t numFiles = this->Files.size();
+
+  // Parse the meta-data of our share of the files.
+  const size_t first = numFiles * procId / numProcs;
+  const size_t last = numFiles * (procId + 1) / numProcs;
+  std::vector<std::pair<std::string, std::vector<unsigned char>>> parsed;
+  MapOfStringToSPCTH::iterator it = this->Files.begin();
+  std::advance(it, first);
+  for (size_t cc = first; cc < last; ++cc, ++it)
+  {
+    vtkSpyPlotUniReader* reader = this->GetReader(it, parent);
+    vtkMultiProcessStream readerStream;
+    if (reader->ReadInformation() && reader->SaveInformation(readerStream))
+    {
+      parsed.emplace_back(it->first, std::vector<unsigned char>());
+      readerStream.GetRawData(parsed.back().second);
+    }
+  }
+
+  vtkMultiProcessStream stream;
+  stream << static_cast<int>(parsed.size());
+  for (auto& item : parsed)
+  {
+    stream << item.first;
+    stream.Push(item.second.data(), static_cast<unsigned int>(item.second.size()));
+  }
+  std::vector<unsigned char> sendBuffer;
+  stream.GetRawData(sendBuffer);
+
+  vtkIdType sendLength = static_cast<vtkIdType>(sendBuffer.size());
+  std::vector<vtkIdType> recvLengths(numProcs, 0);
+  std::vector<vtkIdType> offsets(numProcs, 0);
+  if (!controller->AllGather(&sendLength, recvLengths.data(), 1))
+  {
+    return false;
+  }
+  std::partial_sum(recvLengths.begin(), recvLengths.end() - 1, offsets.begin() + 1);
+  std::vector<unsigned char> recvBuffer(offsets.back() + recvLengths.back());
+  if (!controller->AllGatherV(sendBuffer.data(), recvBuffer.data(), sendLength,
+        recvLengths.data(), offsets.data()))
+  {
+    return false;
+  }
+
+  for (int rank = 0; rank < numProcs; ++rank)
+  {
+    if (rank == procId)
+    {
+      continue;
+    }
+    vtkMultiProcessStream rankStream;
+    rankStream.SetRawData(
+      recvBuffer.data() + offsets[rank], static_cast<unsigned int>(recvLengths[rank]));
+    int count;
+    rankStream >> count;
+    for (int cc = 0; cc < count; ++cc)
+    {
+      std::string fname;
+      unsigned char* data = nullptr;
+      unsigned int size = 0;
+      rankStream >> fname;
+      rankStream.Pop(data, size);
+
+      MapOfStringToSPCTH::iterator fileIter = this->Files.find(fname);
+      if (fileIter != this->Files.end())
+      {
+        vtkSpyPlotUniReader* reader = this->GetReader(fileIter, parent);
+        if (!reader->GetHaveInformation())
+        {
+          vtkMultiProcessStream readerStream;
+          readerStream.SetRawData(data, size);
+          reader->LoadInformation(readerStream);
+        }
+      }
+      delete[] data;
+    }
+  }
+  return true;
+}
+
 //-----------------------------------------------------------------------------
 bool vtkSpyPlotReaderMap::InitializeFromSpyFile(const char* filename)
 {
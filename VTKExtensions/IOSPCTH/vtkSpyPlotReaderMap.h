@@ -19,6 +19,7 @@
 #include <string> // for std::string
 #include <vector> // for std::vector
 
+class vtkMultiProcessController;
 class vtkMultiProcessStream;
 class vtkSpyPlotReader;
 class vtkSpyPlotUniReader;
@@ -43,6 +44,15 @@ public:
   bool Save(vtkMultiProcessStream& stream);
   bool Load(vtkMultiProcessStream& stream);
 
+  /**
+   * Collectively reads the meta-data (headers, block tables and variable
+   * offsets) of all files. Each process parses a contiguous share of the
+   * files and the results are exchanged in a single all-gather, so that every
+   * process ends up with readers that have their information without opening
+   * the other files. Must be called on all processes of the controller.
+   */
+  bool ExchangeInformation(vtkMultiProcessController* controller, vtkSpyPlotReader* parent);
+
 private:
   /**
    * This does the updating of the meta data of the case file. Similar to
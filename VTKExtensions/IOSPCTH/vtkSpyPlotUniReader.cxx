@@ -6,6 +6,7 @@
 #include "vtkDataArraySelection.h"
 #include "vtkFloatArray.h"
 #include "vtkIntArray.h"
+#include "vtkMultiProcessStream.h"
 #include "vtkObjectFactory.h"
 #include "vtkSpyPlotBlock.h"
 #include "vtkSpyPlotIStream.h"
@@ -13,8 +14,13 @@
 
 #include "vtksys/FStream.hxx"
 #include "vtksys/RegularExpression.hxx"
+#include "vtksys/SystemTools.hxx"
 
+#include <list>
+#include <map>
+#include <mutex>
 #include <sstream>
+#include <string>
 #include <vector>
 
 //=============================================================================
@@ -43,6 +49,54 @@ inline ostream& operator<<(ostream& os, const vtkSpyPlotWriteString& c)
   return os;
 }
 
+namespace
+{
+// Magic number tagging serialized meta-data, bump when the layout changes.
+constexpr int VTK_SPY_PLOT_INFORMATION_MAGIC = 57401;
+
+// Meta-data cache shared by all vtkSpyPlotUniReader instances of the process.
+// Entries are the raw bytes produced by vtkSpyPlotUniReader::SaveInformation().
+struct vtkSpyPlotInformationCacheEntry
+{
+  long ModifiedTime = 0;
+  unsigned long FileSize = 0;
+  std::vector<unsigned char> RawData;
+  std::list<std::string>::iterator UsePosition;
+};
+
+struct vtkSpyPlotInformationCache
+{
+  std::mutex Mutex;
+  std::map<std::string, vtkSpyPlotInformationCacheEntry> Entries;
+  // File names, most recently used first.
+  std::list<std::string> UseOrder;
+  size_t Size = 0;
+  size_t Limit = 64 * 1024 * 1024;
+
+  void Erase(std::map<std::string, vtkSpyPlotInformationCacheEntry>::iterator iter)
+  {
+    this->Size -= iter->second.RawData.size();
+    this->UseOrder.erase(iter->second.UsePosition);
+    this->Entries.erase(iter);
+  }
+
+  // Drops the least recently used entries until the cache fits its limit.
+  void Trim()
+  {
+    while (this->Size > this->Limit && !this->UseOrder.empty())
+    {
+      this->Erase(this->Entries.find(this->UseOrder.back()));
+    }
+  }
+};
+
+vtkSpyPlotInformationCache& GetInformationCache()
+{
+  static vtkSpyPlotInformationCache cache;
+  return cache;
+}
+}
+
 //-----------------------------------------------------------------------------
 vtkSpyPlotUniReader::vtkSpyPlotUniReader()
 {
@@ -86,6 +140,7 @@ vtkSpyPlotUniReader::vtkSpyPlotUniReader()
   this->DataTypeChanged = 0;
   this->GeomTimeStep = -1; // Indicate that geometry will have to be loaded
   this->NeedToCheck = 1;   // Indicates non-geometric data needs to be checked
+  this->UseInformationCache = true;
   if (!this->HaveInformation)
   {
     vtkDebugMacro(<< __LINE__ << " " << this << " Read: " << this->HaveInformation);
@@ -1159,16 +1214,7 @@ int vtkSpyPlotUniReader::ReadMarkerHeader(vtkSpyPlotIStream* spis)
         return 0;
       }
       this->Markers[n].NumVars = numVars;
-      this->MarkersDumps[n].XLoc = vtkFloatArray::New();
-      this->MarkersDumps[n].ILoc = vtkIntArray::New();
-      this->MarkersDumps[n].YLoc = vtkFloatArray::New();
-      this->MarkersDumps[n].JLoc = vtkIntArray::New();
-      this->MarkersDumps[n].ZLoc = vtkFloatArray::New();
-      this->MarkersDumps[n].KLoc = vtkIntArray::New();
-      this->MarkersDumps[n].Block = vtkIntArray::New();
-
-      this->Markers[n].Variables = new MarkerMaterialField[this->Markers[n].NumVars];
-      this->MarkersDumps[n].Variables = new vtkFloatArray*[this->Markers[n].NumVars];
+      this->AllocateMarkerArrays(n);
 
       for (int v = 0; v < numVars; v++)
       {
@@ -1187,13 +1233,31 @@ int vtkSpyPlotUniReader::ReadMarkerHeader(vtkSpyPlotIStream* spis)
 
         strncpy(this->Markers[n].Variables[v].Name, name, 30);
         strncpy(this->Markers[n].Variables[v].Label, label, 256);
-        this->MarkersDumps[n].Variables[v] = vtkFloatArray::New();
       }
     }
   }
   return 1;
 }
 
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::AllocateMarkerArrays(int n)
+{
+  this->MarkersDumps[n].XLoc = vtkFloatArray::New();
+  this->MarkersDumps[n].ILoc = vtkIntArray::New();
+  this->MarkersDumps[n].YLoc = vtkFloatArray::New();
+  this->MarkersDumps[n].JLoc = vtkIntArray::New();
+  this->MarkersDumps[n].ZLoc = vtkFloatArray::New();
+  this->MarkersDumps[n].KLoc = vtkIntArray::New();
+  this->MarkersDumps[n].Block = vtkIntArray::New();
+
+  this->Markers[n].Variables = new MarkerMaterialField[this->Markers[n].NumVars];
+  this->MarkersDumps[n].Variables = new vtkFloatArray*[this->Markers[n].NumVars];
+  for (int v = 0; v < this->Markers[n].NumVars; v++)
+  {
+    this->MarkersDumps[n].Variables[v] = vtkFloatArray::New();
+  }
+}
+
 int vtkSpyPlotUniReader::ReadGroupHeaderInformation(vtkSpyPlotIStream* spis)
 {
   // Read group headers. Groups are also time steps
@@ -1342,6 +1406,7 @@ void vtkSpyPlotUniReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DataTypeChanged: " << this->DataTypeChanged << endl;
   os << indent << "NumberOfCellFields: " << this->NumberOfCellFields << endl;
   os << indent << "NeedToCheck: " << this->NeedToCheck << endl;
+  os << indent << "UseInformationCache: " << this->UseInformationCache << endl;
 }
 
 //-----------------------------------------------------------------------------
@@ -1363,6 +1428,10 @@ int vtkSpyPlotUniReader::ReadInformation()
     vtkErrorMacro("FileName not specified");
     return 0;
   }
+  if (this->UseInformationCache && this->LoadCachedInformation())
+  {
+    return 1;
+  }
   vtksys::ifstream ifs(this->FileName, ios::binary | ios::in);
   if (!ifs)
   {
@@ -1424,9 +1493,327 @@ int vtkSpyPlotUniReader::ReadInformation()
   this->CurrentTime = this->TimeRange[0];
   this->HaveInformation = 1;
 
+  if (this->UseInformationCache)
+  {
+    this->AddToInformationCache();
+  }
   return 1;
 }
 
+//-----------------------------------------------------------------------------
+bool vtkSpyPlotUniReader::SaveInformation(vtkMultiProcessStream& stream)
+{
+  if (!this->HaveInformation)
+  {
+    return false;
+  }
+
+  stream << VTK_SPY_PLOT_INFORMATION_MAGIC;
+  stream.Push(this->FileDescription, 128);
+  stream << this->FileVersion << this->SizeOfFilePointer << this->FileCompressionFlag
+         << this->FileProcessorId << this->NumberOfProcessors << this->IGM
+         << this->NumberOfDimensions << this->NumberOfMaterials << this->MaximumNumberOfMaterials;
+  stream.Push(this->GlobalMin, 3);
+  stream.Push(this->GlobalMax, 3);
+  stream << this->NumberOfBlocks << this->MaximumNumberOfLevels << this->MarkersOn;
+  if (this->MarkersOn)
+  {
+    for (int n = 0; n < this->NumberOfMaterials; n++)
+    {
+      const MaterialMarker& marker = this->Markers[n];
+      stream << marker.NumMarks << marker.NumRealMarks;
+      if (marker.NumMarks > 0)
+      {
+        stream << marker.NumVars;
+        stream.Push(reinterpret_cast<unsigned char*>(marker.Variables),
+          static_cast<unsigned int>(sizeof(MarkerMaterialField) * marker.NumVars));
+      }
+    }
+  }
+
+  // Fields definitions are plain structs, ship them as bytes.
+  stream << this->NumberOfPossibleCellFields << this->NumberOfPossibleMaterialFields;
+  stream.Push(reinterpret_cast<unsigned char*>(this->CellFields),
+    static_cast<unsigned int>(sizeof(CellMaterialField) * this->NumberOfPossibleCellFields));
+  stream.Push(reinterpret_cast<unsigned char*>(this->MaterialFields),
+    static_cast<unsigned int>(sizeof(CellMaterialField) * this->NumberOfPossibleMaterialFields));
+
+  const unsigned int numDumps = static_cast<unsigned int>(this->NumberOfDataDumps);
+  stream << this->NumberOfDataDumps;
+  stream.Push(this->DumpCycle, numDumps);
+  stream.Push(this->DumpTime, numDumps);
+  if (this->FileVersion >= 102)
+  {
+    stream.Push(this->DumpDT, numDumps);
+  }
+  stream.Push(this->DumpOffset, numDumps);
+
+  for (int dump = 0; dump < this->NumberOfDataDumps; ++dump)
+  {
+    const DataDump* dp = this->DataDumps + dump;
+    stream << dp->NumVars;
+    stream.Push(dp->SavedVariables, static_cast<unsigned int>(dp->NumVars));
+    stream.Push(dp->SavedVariableOffsets, static_cast<unsigned int>(dp->NumVars));
+    for (int var = 0; var < dp->NumVars; ++var)
+    {
+      const Variable* variable = dp->Variables + var;
+      stream << std::string(variable->Name) << variable->Material << variable->Index;
+    }
+    stream << dp->NumberOfTracers;
+    if (dp->NumberOfTracers > 0)
+    {
+      stream.Push(
+        dp->TracerCoord->GetPointer(0), static_cast<unsigned int>(3 * dp->NumberOfTracers));
+      stream.Push(
+        dp->TracerBlock->GetPointer(0), static_cast<unsigned int>(4 * dp->NumberOfTracers));
+    }
+    stream << dp->NumberOfBlocks << dp->ActualNumberOfBlocks << dp->BlocksOffset
+           << dp->SavedBlocksGeometryOffset;
+    stream.Push(dp->SavedBlockAllocatedStates, static_cast<unsigned int>(dp->NumberOfBlocks));
+  }
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSpyPlotUniReader::LoadInformation(vtkMultiProcessStream& stream)
+{
+  if (this->HaveInformation)
+  {
+    return false;
+  }
+  if (!this->CellArraySelection)
+  {
+    vtkErrorMacro("Cell array selection not specified");
+    return false;
+  }
+
+  int magic;
+  stream >> magic;
+  if (magic != VTK_SPY_PLOT_INFORMATION_MAGIC)
+  {
+    vtkErrorMacro("Unexpected meta-data stream for file: " << this->FileName);
+    return false;
+  }
+
+  unsigned int size = 128;
+  char* description = this->FileDescription;
+  stream.Pop(description, size);
+  stream >> this->FileVersion >> this->SizeOfFilePointer >> this->FileCompressionFlag >>
+    this->FileProcessorId >> this->NumberOfProcessors >> this->IGM >> this->NumberOfDimensions >>
+    this->NumberOfMaterials >> this->MaximumNumberOfMaterials;
+  double* bounds = this->GlobalMin;
+  size = 3;
+  stream.Pop(bounds, size);
+  bounds = this->GlobalMax;
+  stream.Pop(bounds, size);
+  stream >> this->NumberOfBlocks >> this->MaximumNumberOfLevels >> this->MarkersOn;
+  if (this->MarkersOn)
+  {
+    this->Markers = new MaterialMarker[this->NumberOfMaterials];
+    this->MarkersDumps = new MarkerDump[this->NumberOfMaterials];
+    for (int n = 0; n < this->NumberOfMaterials; n++)
+    {
+      MaterialMarker& marker = this->Markers[n];
+      stream >> marker.NumMarks >> marker.NumRealMarks;
+      if (marker.NumMarks > 0)
+      {
+        stream >> marker.NumVars;
+        this->AllocateMarkerArrays(n);
+        unsigned char* fields = reinterpret_cast<unsigned char*>(marker.Variables);
+        size = static_cast<unsigned int>(sizeof(MarkerMaterialField) * marker.NumVars);
+        stream.Pop(fields, size);
+      }
+    }
+  }
+
+  stream >> this->NumberOfPossibleCellFields >> this->NumberOfPossibleMaterialFields;
+  this->CellFields = new CellMaterialField[this->NumberOfPossibleCellFields];
+  this->MaterialFields = new CellMaterialField[this->NumberOfPossibleMaterialFields];
+  unsigned char* fields = reinterpret_cast<unsigned char*>(this->CellFields);
+  size = static_cast<unsigned int>(sizeof(CellMaterialField) * this->NumberOfPossibleCellFields);
+  stream.Pop(fields, size);
+  fields = reinterpret_cast<unsigned char*>(this->MaterialFields);
+  size =
+    static_cast<unsigned int>(sizeof(CellMaterialField) * this->NumberOfPossibleMaterialFields);
+  stream.Pop(fields, size);
+
+  stream >> this->NumberOfDataDumps;
+  const unsigned int numDumps = static_cast<unsigned int>(this->NumberOfDataDumps);
+  this->DumpCycle = new int[numDumps];
+  this->DumpTime = new double[numDumps];
+  this->DumpOffset = new vtkTypeInt64[numDumps];
+  size = numDumps;
+  stream.Pop(this->DumpCycle, size);
+  stream.Pop(this->DumpTime, size);
+  if (this->FileVersion >= 102)
+  {
+    this->DumpDT = new double[numDumps];
+    stream.Pop(this->DumpDT, size);
+  }
+  stream.Pop(this->DumpOffset, size);
+
+  this->DataDumps = new DataDump[numDumps];
+  memset(this->DataDumps, 0, sizeof(DataDump) * numDumps);
+  for (int dump = 0; dump < this->NumberOfDataDumps; ++dump)
+  {
+    DataDump* dp = this->DataDumps + dump;
+    stream >> dp->NumVars;
+    dp->SavedVariables = new int[dp->NumVars];
+    dp->SavedVariableOffsets = new vtkTypeInt64[dp->NumVars];
+    size = static_cast<unsigned int>(dp->NumVars);
+    stream.Pop(dp->SavedVariables, size);
+    stream.Pop(dp->SavedVariableOffsets, size);
+    dp->Variables = new Variable[dp->NumVars];
+    for (int var = 0; var < dp->NumVars; ++var)
+    {
+      Variable* variable = dp->Variables + var;
+      std::string name;
+      stream >> name >> variable->Material >> variable->Index;
+      variable->Name = new char[name.size() + 1];
+      strcpy(variable->Name, name.c_str());
+      variable->MaterialField = variable->Index >= 0 ? this->MaterialFields + variable->Material
+                                                     : this->CellFields + variable->Material;
+      variable->DataBlocks = nullptr;
+      variable->GhostCellsFixed = nullptr;
+      if (!this->CellArraySelection->ArrayExists(variable->Name))
+      {
+        this->CellArraySelection->DisableArray(variable->Name);
+      }
+    }
+    stream >> dp->NumberOfTracers;
+    if (dp->NumberOfTracers > 0)
+    {
+      dp->TracerCoord = vtkFloatArray::New();
+      dp->TracerCoord->SetNumberOfComponents(3);
+      dp->TracerCoord->SetNumberOfTuples(dp->NumberOfTracers);
+      float* coords = dp->TracerCoord->GetPointer(0);
+      size = static_cast<unsigned int>(3 * dp->NumberOfTracers);
+      stream.Pop(coords, size);
+      dp->TracerBlock = vtkIntArray::New();
+      dp->TracerBlock->SetNumberOfComponents(4);
+      dp->TracerBlock->SetNumberOfTuples(dp->NumberOfTracers);
+      int* blocks = dp->TracerBlock->GetPointer(0);
+      size = static_cast<unsigned int>(4 * dp->NumberOfTracers);
+      stream.Pop(blocks, size);
+    }
+    stream >> dp->NumberOfBlocks >> dp->ActualNumberOfBlocks >> dp->BlocksOffset >>
+      dp->SavedBlocksGeometryOffset;
+    dp->SavedBlockAllocatedStates = new unsigned char[dp->NumberOfBlocks];
+    size = static_cast<unsigned int>(dp->NumberOfBlocks);
+    stream.Pop(dp->SavedBlockAllocatedStates, size);
+  }
+
+  this->Blocks = new vtkSpyPlotBlock[this->NumberOfBlocks];
+
+  this->TimeStepRange[1] = this->NumberOfDataDumps - 1;
+  this->TimeRange[0] = this->DumpTime[0];
+  this->TimeRange[1] = this->DumpTime[this->NumberOfDataDumps - 1];
+  this->NumberOfCellFields = this->CellArraySelection->GetNumberOfArrays();
+  this->CurrentTime = this->TimeRange[0];
+  this->HaveInformation = 1;
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkSpyPlotUniReader::LoadCachedInformation()
+{
+  vtkSpyPlotInformationCache& cache = GetInformationCache();
+  vtkMultiProcessStream stream;
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    auto iter = cache.Entries.find(this->FileName);
+    if (iter == cache.Entries.end())
+    {
+      return false;
+    }
+    if (iter->second.ModifiedTime != vtksys::SystemTools::ModifiedTime(this->FileName) ||
+      iter->second.FileSize != vtksys::SystemTools::FileLength(this->FileName))
+    {
+      // The file changed on disk since it was parsed.
+      cache.Erase(iter);
+      return false;
+    }
+    cache.UseOrder.splice(cache.UseOrder.begin(), cache.UseOrder, iter->second.UsePosition);
+    stream.SetRawData(iter->second.RawData);
+  }
+  vtkDebugMacro("Using cached meta-data for " << this->FileName);
+  return this->LoadInformation(stream);
+}
+
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::AddToInformationCache()
+{
+  vtkMultiProcessStream stream;
+  if (!this->SaveInformation(stream))
+  {
+    return;
+  }
+  vtkSpyPlotInformationCacheEntry entry;
+  entry.ModifiedTime = vtksys::SystemTools::ModifiedTime(this->FileName);
+  entry.FileSize = vtksys::SystemTools::FileLength(this->FileName);
+  stream.GetRawData(entry.RawData);
+
+  vtkSpyPlotInformationCache& cache = GetInformationCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  auto iter = cache.Entries.find(this->FileName);
+  if (iter != cache.Entries.end())
+  {
+    cache.Erase(iter);
+  }
+  if (entry.RawData.size() > cache.Limit)
+  {
+    return;
+  }
+  cache.UseOrder.push_front(this->FileName);
+  entry.UsePosition = cache.UseOrder.begin();
+  cache.Size += entry.RawData.size();
+  cache.Entries[this->FileName] = std::move(entry);
+  cache.Trim();
+}
+
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::ClearInformationCache()
+{
+  vtkSpyPlotInformationCache& cache = GetInformationCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Entries.clear();
+  cache.UseOrder.clear();
+  cache.Size = 0;
+}
+
+//-----------------------------------------------------------------------------
+void vtkSpyPlotUniReader::SetInformationCacheLimit(size_t bytes)
+{
+  vtkSpyPlotInformationCache& cache = GetInformationCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Limit = bytes;
+  cache.Trim();
+}
+
+//-----------------------------------------------------------------------------
+size_t vtkSpyPlotUniReader::GetInformationCacheLimit()
+{
+  vtkSpyPlotInformationCache& cache = GetInformationCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return cache.Limit;
+}
+
+//-----------------------------------------------------------------------------
+size_t vtkSpyPlotUniReader::GetInformationCacheSize()
+{
+  vtkSpyPlotInformationCache& cache = GetInformationCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return cache.Size;
+}
+
+//-----------------------------------------------------------------------------
+int vtkSpyPlotUniReader::GetInformationCacheNumberOfEntries()
+{
+  vtkSpyPlotInformationCache& cache = GetInformationCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  return static_cast<int>(cache.Entries.size());
+}
+
 //-----------------------------------------------------------------------------
 int vtkSpyPlotUniReader::ReadCellVariableInfo(vtkSpyPlotIStream* spis)
 {
@@ -30,6 +30,7 @@ class vtkDataArraySelection;
 class vtkDataArray;
 class vtkFloatArray;
 class vtkIntArray;
+class vtkMultiProcessStream;
 class vtkUnsignedCharArray;
 class vtkSpyPlotIStream;
 
@@ -55,6 +56,58 @@ public:
    */
   virtual int ReadInformation();
 
+  ///@{
+  /**
+   * Serialize/deserialize the meta-data collected by ReadInformation(), i.e.
+   * the header, the field definitions, the dump tables, the variable offsets
+   * and the block allocation tables. A successful LoadInformation() leaves
+   * the reader in the same state as ReadInformation() without opening the
+   * file. LoadInformation() fails if the reader already has its meta-data.
+   */
+  bool SaveInformation(vtkMultiProcessStream& stream);
+  bool LoadInformation(vtkMultiProcessStream& stream);
+  ///@}
+
+  /**
+   * Returns true if the meta-data has been read or loaded.
+   */
+  bool GetHaveInformation() const { return this->HaveInformation != 0; }
+
+  ///@{
+  /**
+   * When set, ReadInformation() first looks for the file's meta-data in a
+   * cache shared by all readers of the process, and adds the meta-data it
+   * parses to that cache. Entries are validated against the file's
+   * modification time and size. Default is true.
+   */
+  vtkSetMacro(UseInformationCache, bool);
+  vtkGetMacro(UseInformationCache, bool);
+  ///@}
+
+  /**
+   * Discard all entries of the process-wide meta-data cache.
+   */
+  static void ClearInformationCache();
+
+  ///@{
+  /**
+   * Maximum number of bytes of meta-data kept in the process-wide cache.
+   * When adding an entry would exceed it, the least recently used entries are
+   * discarded. Default is 64 MiB.
+   */
+  static void SetInformationCacheLimit(size_t bytes);
+  static size_t GetInformationCacheLimit();
+  ///@}
+
+  ///@{
+  /**
+   * Number of bytes and number of files currently held by the process-wide
+   * meta-data cache.
+   */
+  static size_t GetInformationCacheSize();
+  static int GetInformationCacheNumberOfEntries();
+  ///@}
+
   /**
    * Make sure that actual data (including grid blocks) is current
    * else it will read in the required data from file
@@ -243,6 +296,10 @@ private:
 
   vtkDataArray* GetMaterialField(const int& block, const int& materialIndex, const char* Id);
 
+  void AllocateMarkerArrays(int material);
+  bool LoadCachedInformation();
+  void AddToInformationCache();
+
   // Header information
   char FileDescription[128];
   int FileVersion;
@@ -296,6 +353,8 @@ private:
   // optimize this
   int NeedToCheck;
 
+  bool UseInformationCache;
+
   int DataTypeChanged;
   int DownConvertVolumeFraction;
 
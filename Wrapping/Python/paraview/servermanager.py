@@ -1933,10 +1933,21 @@ class ProxyManager(object):
         return getattr(self.SMProxyManager, name)
 
     def LoadState(self, filename, loader=None, location=vtkPVSession.CLIENT):
-        self.SMProxyManager.LoadXMLState(filename, loader, location)
+        if location == vtkPVSession.CLIENT and filename.endswith(".pvsmb"):
+            self.SMProxyManager.LoadBinaryState(filename, loader)
+        else:
+            self.SMProxyManager.LoadXMLState(filename, loader, location)
 
     def SaveState(self, filename, location=vtkPVSession.CLIENT):
-        self.SMProxyManager.SaveXMLState(filename, location)
+        """Saves the state in `filename`. The compact binary form is used when
+        `filename` has the ".pvsmb" extension; it is only supported on the
+        client."""
+        if filename.endswith(".pvsmb"):
+            if location != vtkPVSession.CLIENT:
+                raise RuntimeError("Binary states can only be saved on the client.")
+            self.SMProxyManager.SaveBinaryState(filename)
+        else:
+            self.SMProxyManager.SaveXMLState(filename, location)
 
 
 class PropertyIterator(object):
@@ -2154,6 +2165,35 @@ class Connection(object):
             self.close()
 
 
+class PushBatch(object):
+    """Context manager that batches the state pushed to the server(s) by the
+    proxies modified in its scope. With a remote connection, the property
+    updates are sent as a single message when the outermost batch ends and
+    successive updates of the same proxy are folded together. Requests that
+    need the server to be up to date, such as updating the pipeline or
+    fetching data information, still see all the changes made before them.
+
+        with servermanager.PushBatch():
+            sphere.Radius = 2
+            sphere.ThetaResolution = 32
+    """
+
+    def __init__(self, session=None):
+        if not session and ActiveConnection:
+            session = ActiveConnection.Session
+        self.Session = session
+
+    def __enter__(self):
+        if self.Session:
+            self.Session.BeginPushBatch()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        if self.Session:
+            self.Session.EndPushBatch()
+        return False
+
+
 def SaveState(filename, location=vtkPVSession.CLIENT):
     """Given a state filename, saves the state of objects registered
     with the proxy manager."""
@@ -779,8 +779,9 @@ def Show(proxy=None, view=None, representationType=None, **params):
     rep = controller.Show(proxy, proxy.Port, view, representationType)
     if rep == None:
         raise RuntimeError("Could not create a representation object for proxy %s" % proxy.GetXMLLabel())
-    for param in params.keys():
-        setattr(rep, param, params[param])
+    with servermanager.PushBatch():
+        for param in params.keys():
+            setattr(rep, param, params[param])
     return rep
 
 
@@ -968,9 +969,10 @@ def SetProperties(proxy=None, **params):
     if not proxy:
         proxy = active_objects.source
     properties = proxy.ListProperties()
-    for param in params.keys():
-        pyproxy = servermanager._getPyProxy(proxy)
-        pyproxy.__setattr__(param, params[param])
+    with servermanager.PushBatch():
+        for param in params.keys():
+            pyproxy = servermanager._getPyProxy(proxy)
+            pyproxy.__setattr__(param, params[param])
 
 
 # -----------------------------------------------------------------------------
@@ -1262,9 +1264,27 @@ def GetRepresentations():
 def UpdatePipeline(time=None, proxy=None):
     """Updates (executes) the given pipeline object for the given time as
     necessary (i.e. if it did not already execute). If no source is provided,
-    the active source is used instead."""
+    the active source is used instead.
+
+    `proxy` can also be a list of pipeline objects. They are then updated with
+    a single request to the server, which updates independent branches of the
+    pipeline concurrently when the `EnableConcurrentPipelineUpdates` general
+    setting is on."""
     if not proxy:
         proxy = active_objects.source
+    if isinstance(proxy, (list, tuple)):
+        sources = servermanager.vtk.vtkCollection()
+        for source in proxy:
+            sources.AddItem(source.SMProxy)
+        if time:
+            servermanager.vtkSMSourceProxy.UpdatePipelines(sources, time)
+        else:
+            servermanager.vtkSMSourceProxy.UpdatePipelines(sources)
+        # as in SourceProxy.UpdatePipeline, for progress to work properly.
+        if servermanager.ActiveConnection and servermanager.ActiveConnection.IsRemote():
+            for source in proxy:
+                source.SMProxy.GetDataInformation()
+        return
     if time:
         proxy.UpdatePipeline(time)
     else:
@@ -2937,35 +2957,37 @@ def _create_func(key, module, skipRegisteration=False):
             # Instantiate the actual object from the given module.
             px = paraview._backwardscompatibilityhelper.GetProxy(module, key, no_update=True)
 
-        # preinitialize the proxy.
-        controller.PreInitializeProxy(px)
-
-        # Make sure non-keyword arguments are valid
-        for inp in input:
-            if inp != None and not isinstance(inp, servermanager.Proxy):
-                if px.GetProperty("Input") != None:
-                    raise RuntimeError("Expecting a proxy as input.")
+        # batch the states pushed while setting up the proxy.
+        with servermanager.PushBatch():
+            # preinitialize the proxy.
+            controller.PreInitializeProxy(px)
+
+            # Make sure non-keyword arguments are valid
+            for inp in input:
+                if inp != None and not isinstance(inp, servermanager.Proxy):
+                    if px.GetProperty("Input") != None:
+                        raise RuntimeError("Expecting a proxy as input.")
+                    else:
+                        raise RuntimeError("This function does not accept non-keyword arguments.")
+
+            # Assign inputs
+            inputName = servermanager.vtkSMCoreUtilities.GetInputPropertyName(px.SMProxy, 0)
+
+            if px.GetProperty(inputName) != None:
+                if len(input) > 0:
+                    px.SetPropertyWithName(inputName, input)
                 else:
-                    raise RuntimeError("This function does not accept non-keyword arguments.")
-
-        # Assign inputs
-        inputName = servermanager.vtkSMCoreUtilities.GetInputPropertyName(px.SMProxy, 0)
-
-        if px.GetProperty(inputName) != None:
-            if len(input) > 0:
-                px.SetPropertyWithName(inputName, input)
+                    # If no input is specified, try the active pipeline object
+                    if px.GetProperty(inputName).GetRepeatable() and active_objects.get_selected_sources():
+                        px.SetPropertyWithName(inputName, active_objects.get_selected_sources())
+                    elif active_objects.source:
+                        px.SetPropertyWithName(inputName, active_objects.source)
             else:
-                # If no input is specified, try the active pipeline object
-                if px.GetProperty(inputName).GetRepeatable() and active_objects.get_selected_sources():
-                    px.SetPropertyWithName(inputName, active_objects.get_selected_sources())
-                elif active_objects.source:
-                    px.SetPropertyWithName(inputName, active_objects.source)
-        else:
-            if len(input) > 0:
-                raise RuntimeError("This function does not expect an input.")
+                if len(input) > 0:
+                    raise RuntimeError("This function does not expect an input.")
 
-        # Pass all the named arguments as property,value pairs
-        SetProperties(px, **params)
+            # Pass all the named arguments as property,value pairs
+            SetProperties(px, **params)
 
         # post initialize
         controller.PostInitializeProxy(px)